@@ -867,6 +867,73 @@ static void new_generator_unicodedata_decompose_ccc_qc(const std::string& file1,
     }
 }
 
+static void new_generator_nfkc_casefold(const std::string& file1, const std::string& file2, const std::string& file3)
+{
+    // https://www.unicode.org/reports/tr44/#DerivedNormalizationProps.txt
+    // https://www.unicode.org/reports/tr44/#NFKC_Casefold
+    std::ifstream input("DerivedNormalizationProps.txt", std::ios::binary);
+    ASSERTX(input.is_open());
+
+    std::map<uint32_t, uint32_t> map;
+
+    for (uint32_t i = 0; i <= 0x10FFFF; ++i)
+        map[i] = 0;
+
+    // The mappings are in NFC so the code must decompose them to NFD when needed.
+    // Empty mapping (number 0) means the code point must be removed (Default_Ignorable_Code_Point)
+    // that is why offset 0 is reserved for no mapping.
+    std::vector<uint32_t> vec(1, 0);
+    std::map<std::vector<uint32_t>, uint32_t> offsets;
+
+    std::string line;
+    while (std::getline(input, line))
+    {
+        std::size_t semicolon = line.find(';');
+
+        if (semicolon != std::string::npos && line.find("; NFKC_CF;", semicolon) == semicolon)
+        {
+            uint32_t c1 = (uint32_t)strtoul(line.c_str(), 0, 16);
+            uint32_t c2 = c1;
+            std::size_t dots = line.find("..");
+            if (dots != std::string::npos && dots < semicolon)
+                c2 = (uint32_t)strtoul(line.c_str()+dots+2, 0, 16);
+
+            std::size_t begin = semicolon + 10;
+            std::size_t end = line.find('#', begin);
+            std::string mapping = line.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+
+            std::vector<uint32_t> cps;
+            for (std::size_t i = 0; i < mapping.size(); ++i)
+            {
+                if (mapping[i] != ' ' && (i == 0 || mapping[i-1] == ' '))
+                    cps.push_back((uint32_t)strtoul(mapping.c_str()+i, 0, 16));
+            }
+
+            ASSERTX(cps.size() <= 18); // Max is 18 (U+FDFA)
+
+            // Many code points have the same mapping so store it once
+            if (offsets.count(cps) == 0)
+            {
+                offsets[cps] = (uint32_t)vec.size();
+                vec.push_back((uint32_t)cps.size());
+                vec.insert(vec.end(), cps.begin(), cps.end());
+            }
+            const uint32_t offset = offsets.at(cps);
+
+            for (uint32_t c = c1; c <= c2; ++c)
+            {
+                ASSERTX(map.at(c) == 0);
+                map.at(c) = offset;
+            }
+        }
+    }
+
+    ASSERTX(vec.size() > 1);
+
+    new_generator_output(file1, file2, 8, 16, true, map, 0x10FFFF);
+    new_generator_output2(file3, vec);
+}
+
 static void new_generator_output3(const std::string& file, const std::vector<std::vector<uint32_t>>& vec)
 {
     std::ofstream output(file);
@@ -2072,6 +2139,7 @@ static void new_generator()
     new_generator_unicodedata_decompose_ccc_qc("new_stage1_decomp_nfd.txt", "new_stage2_decomp_nfd.txt", "new_stage3_decomp_nfd.txt", false);
     new_generator_unicodedata_decompose_ccc_qc("new_stage1_decomp_nfkd.txt", "new_stage2_decomp_nfkd.txt", "new_stage3_decomp_nfkd.txt", true,
                                                "new_stage1_ccc_qc.txt", "new_stage2_ccc_qc.txt");
+    new_generator_nfkc_casefold("new_stage1_nfkc_cf.txt", "new_stage2_nfkc_cf.txt", "new_stage3_nfkc_cf.txt");
 
     new_generator_segment_grapheme("new_stage1_segment_grapheme.txt", "new_stage2_segment_grapheme.txt");
     new_generator_segment_word("new_stage1_segment_word.txt", "new_stage2_segment_word.txt");
@@ -2192,6 +2260,9 @@ static void new_merger()
     new_merger_replace_string(data1, data2, "new_stage1_decomp_nfkd.txt");
     new_merger_replace_string(data1, data2, "new_stage2_decomp_nfkd.txt");
     new_merger_replace_string(data1, data2, "new_stage3_decomp_nfkd.txt");
+    new_merger_replace_string(data1, data2, "new_stage1_nfkc_cf.txt");
+    new_merger_replace_string(data1, data2, "new_stage2_nfkc_cf.txt");
+    new_merger_replace_string(data1, data2, "new_stage3_nfkc_cf.txt");
     new_merger_replace_string(data1, data2, "new_stage1_comp_cp1.txt");
     new_merger_replace_string(data1, data2, "new_stage2_comp_cp1.txt");
     new_merger_replace_string(data1, data2, "new_stage1_comp_cp2.txt");
@@ -12,6 +12,7 @@
 #include "conv.h"
 #include "ranges.h"
 #include "ranges_conv.h"
+#include "offset_index.h"
 
 #ifndef UNI_ALGO_DISABLE_CASE
 #include "case.h"
@@ -7,16 +7,72 @@
 
 #include <string>
 #include <string_view>
+#include <array>
+#include <vector>
+#include <iterator>
 #include <cassert>
+#if __cplusplus >= 202002L || _MSVC_LANG >= 202002L
+#include <span>
+#endif
 
 #include "config.h"
 #include "internal/safe_layer.h"
 #include "internal/error.h"
+#include "internal/conv_policy.h"
 
 #include "impl/impl_conv.h"
+#include "impl/impl_iter.h"
 
 namespace una {
 
+namespace detail { struct conv_state_access; }
+
+// The result of conversion functions that write to a buffer (*_into functions)
+// read is the number of code units that were read from the source
+// written is the number of code units that were written to the buffer
+// error is only used by strict functions and error position is in the source
+// read == 0 and written == 0 for a non-empty source means the buffer is smaller than 4 code units
+struct conv_result
+{
+    std::size_t read = 0;
+    std::size_t written = 0;
+    una::error error;
+};
+
+// Ill-formed sequence that is found by diagnostic functions (una::diag namespace)
+// pos is the position of the sequence in the source and count is the number of code units in it,
+// the sequence is replaced with one U+FFFD the same as in lenient conversion functions.
+struct conv_issue
+{
+    enum class kind : unsigned char
+    {
+        truncated = 1,    // The sequence ends too early, or a high surrogate at the end in UTF-16
+        overlong = 2,     // Overlong encoding in UTF-8
+        surrogate = 3,    // Encoded surrogate in UTF-8 and UTF-32 or a lone surrogate in UTF-16
+        out_of_range = 4, // The code point is greater than U+10FFFF
+        invalid = 5,      // The code unit cannot start a sequence in UTF-8 (continuation or 0xF8-0xFF)
+    };
+
+    std::size_t pos = 0;
+    std::size_t count = 0;
+    kind type = kind::invalid;
+};
+
+// The state for conversion functions that write to a buffer (*_into functions)
+// Incomplete sequence at the end of the source is stored in the state (up to 3 code units)
+// and it will be completed by the next call, an empty source means the end of the input.
+class conv_state
+{
+    friend struct detail::conv_state_access;
+private:
+    std::array<detail::type_codept, 3> units{};
+    std::size_t count = 0;
+public:
+    uaiw_constexpr conv_state() noexcept = default;
+    uaiw_constexpr bool empty() const noexcept { return count == 0; }
+    uaiw_constexpr void reset() noexcept { count = 0; }
+};
+
 namespace detail {
 
 // Implementation details
@@ -24,6 +80,8 @@ namespace detail {
 // back_inserter was always 10-30% slower in tests even with reserve so it uses resize approach.
 // Also it doesn't use 2-pass approach: calculate converted string size and then the actual conversion.
 // This is obviously at least 50% slower, so it uses 1-pass with shrink_to_fit after.
+// The 2-pass approach is still available in una::exact functions for the cases when
+// the overallocation matters more than the performance (see t_utf_exact below).
 
 template<typename Dst, typename Alloc, typename Src, size_t SizeX,
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
@@ -183,356 +241,2181 @@ uaiw_constexpr bool t_valid(const Src& src, una::error& error)
     return ret;
 }
 
-} // namespace detail
-
-// Template functions
+// Length
 
-template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-utf8to16(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+template<typename Src, size_t(*FnLength)(typename Src::const_iterator, typename Src::const_iterator)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+template<typename Src, size_t(*FnLength)(typename Src::const_pointer, typename Src::const_pointer)>
+#else // Safe layer
+template<typename Src, size_t(*FnLength)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>)>
+#endif
+uaiw_constexpr std::size_t t_length(const Src& src)
 {
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
-
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source);
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    return FnLength(src.cbegin(), src.cend());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    return FnLength(src.data(), src.data() + src.size());
+#else // Safe layer
+    return FnLength(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()});
+#endif
 }
-template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
-uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
-utf16to8(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source);
-}
-template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
-uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
-utf8to32(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+// Exact size conversion
+// This is 2-pass approach that is mentioned at the beginning of the file.
+// It is slower but the memory is allocated only once and without the overallocation
+// so it is only used for the conversions where the result can be much bigger than the source.
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source);
-}
-template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
-uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
-utf32to8(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+template<typename Dst, typename Alloc, typename Src,
+    size_t(*FnLength)(typename Src::const_iterator, typename Src::const_iterator),
+    size_t(*FnUTF)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+template<typename Dst, typename Alloc, typename Src,
+    size_t(*FnLength)(typename Src::const_pointer, typename Src::const_pointer),
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*)>
+#else // Safe layer
+template<typename Dst, typename Alloc, typename Src,
+    size_t(*FnLength)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>),
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*)>
+#endif
+uaiw_constexpr Dst t_utf_exact(const Alloc& alloc, const Src& src)
 {
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+    Dst dst{alloc};
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source);
-}
-template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
-uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
-utf16to32(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+    if (src.size())
+    {
+        const std::size_t length = t_length<Src, FnLength>(src);
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source);
-}
-template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-utf32to16(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+        if (length > dst.max_size()) // Overflow protection
+        {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source);
-}
+        // The length is always exact so there is no need to resize after the conversion
 
-// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        dst.resize(length);
+        FnUTF(src.cbegin(), src.cend(), dst.begin(), nullptr);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        dst.resize(length);
+        FnUTF(src.data(), src.data() + src.size(), dst.data(), nullptr);
+#else // Safe layer
+#  if !defined(__cpp_lib_string_resize_and_overwrite)
+        dst.resize(length);
+        FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst.data(), dst.size()}, nullptr);
+#  else
+        dst.resize_and_overwrite(length, [&src](typename Dst::pointer p, std::size_t n) noexcept -> std::size_t {
+            return FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{p, n}, nullptr);
+        });
+#  endif
+#endif
+    }
 
-inline uaiw_constexpr std::u16string utf8to16u(std::string_view source)
-{
-    return utf8to16<char, char16_t>(source);
-}
-inline uaiw_constexpr std::string utf16to8(std::u16string_view source)
-{
-    return utf16to8<char16_t, char>(source);
-}
-inline uaiw_constexpr std::u32string utf8to32u(std::string_view source)
-{
-    return utf8to32<char, char32_t>(source);
-}
-inline uaiw_constexpr std::string utf32to8(std::u32string_view source)
-{
-    return utf32to8<char32_t, char>(source);
-}
-inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source)
-{
-    return utf16to32<char16_t, char32_t>(source);
-}
-inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source)
-{
-    return utf32to16<char32_t, char16_t>(source);
+    return dst;
 }
 
-#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
-inline uaiw_constexpr std::wstring utf8to16(std::string_view source)
-{
-    return utf8to16<char, wchar_t>(source);
-}
-inline uaiw_constexpr std::string utf16to8(std::wstring_view source)
-{
-    return utf16to8<wchar_t, char>(source);
-}
-inline uaiw_constexpr std::u32string utf16to32u(std::wstring_view source)
+// Conversion to a buffer
+// The conversion is done by chunks that always fit into the buffer using the usual conversion functions.
+// A chunk can be split only where it doesn't change the result: before a code unit that
+// cannot continue a sequence (a lead or ASCII in UTF-8, not a low surrogate in UTF-16)
+// or after max sequence length - 1 continuation code units in a row.
+// That means the result is always the same as the result of the conversion of the whole string.
+
+struct conv_state_access
 {
-    return utf16to32<wchar_t, char32_t>(source);
-}
-inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source)
+    static uaiw_constexpr std::array<type_codept, 3>& units(conv_state& s) noexcept { return s.units; }
+    static uaiw_constexpr std::size_t& count(conv_state& s) noexcept { return s.count; }
+};
+
+// Iterator types of impl conversion functions, they are needed to instantiate
+// the functions with an error policy explicitly (see una::conv_policy)
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+template<typename Src> using t_conv_in  = typename Src::const_iterator;
+template<typename Src> using t_conv_end = typename Src::const_iterator;
+template<typename Dst> using t_conv_out = typename Dst::iterator;
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+template<typename Src> using t_conv_in  = typename Src::const_pointer;
+template<typename Src> using t_conv_end = typename Src::const_pointer;
+template<typename Dst> using t_conv_out = typename Dst::pointer;
+#else // Safe layer
+template<typename Src> using t_conv_in  = safe::in<typename Src::const_pointer>;
+template<typename Src> using t_conv_end = safe::end<typename Src::const_pointer>;
+template<typename Dst> using t_conv_out = safe::out<typename Dst::pointer>;
+#endif
+
+// Skip and stop policies never write more than the default replacement
+template<char32_t Policy, std::size_t SizeX, std::size_t SizeXPolicy>
+inline constexpr std::size_t t_conv_x = (Policy == conv_policy::replace ||
+    Policy == conv_policy::skip || Policy == conv_policy::stop) ? SizeX : SizeXPolicy;
+
+template<int UTF>
+inline constexpr std::size_t t_into_max_len = (UTF == 8) ? 4 : (UTF == 16) ? 2 : 1;
+
+template<int UTF, typename Src>
+uaiw_constexpr bool t_into_is_trail(Src c)
 {
-    return utf32to16<char32_t, wchar_t>(source);
+    // Continuation code unit in UTF-8 or low surrogate in UTF-16
+    if constexpr (UTF == 8)
+        return (static_cast<type_codept>(c) & 0xC0) == 0x80;
+    else if constexpr (UTF == 16)
+        return (static_cast<type_codept>(c) & 0xFC00) == 0xDC00;
+    else
+        return false;
 }
-#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
-inline uaiw_constexpr std::wstring utf8to32(std::string_view source)
+
+template<int UTF, typename Src>
+uaiw_constexpr std::size_t t_into_split(std::basic_string_view<Src> src, std::size_t pos, std::size_t end)
 {
-    return utf8to32<char, wchar_t>(source);
+    // Find a split point at or before end but not before pos
+    if (!t_into_is_trail<UTF>(src[end]))
+        return end;
+    for (std::size_t i = end; i > pos && end - i < t_into_max_len<UTF> - 1; --i)
+    {
+        if (!t_into_is_trail<UTF>(src[i - 1]))
+            return i - 1;
+    }
+    return end;
 }
-inline uaiw_constexpr std::string utf32to8(std::wstring_view source)
+
+template<int UTF, typename Src>
+uaiw_constexpr std::size_t t_into_tail(std::basic_string_view<Src> src, std::size_t pos)
 {
-    return utf32to8<wchar_t, char>(source);
+    // The length of an incomplete sequence at the end of the source
+    if constexpr (UTF == 8)
+    {
+        for (std::size_t i = src.size(); i > pos && src.size() - i < 3; --i)
+        {
+            if (!t_into_is_trail<UTF>(src[i - 1]))
+            {
+                const type_codept c = static_cast<type_codept>(src[i - 1]) & 0xFF;
+                const std::size_t need = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 1;
+                return (src.size() - (i - 1) < need) ? src.size() - (i - 1) : 0;
+            }
+        }
+    }
+    else if constexpr (UTF == 16)
+    {
+        if (src.size() > pos && (static_cast<type_codept>(src[src.size() - 1]) & 0xFC00) == 0xD800)
+            return 1;
+    }
+    return 0;
 }
-inline uaiw_constexpr std::wstring utf16to32(std::u16string_view source)
+
+template<typename Src, typename Dst,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+uaiw_constexpr std::size_t t_into_call(std::basic_string_view<Src> src, Dst* dst, std::size_t size, size_t* error)
 {
-    return utf16to32<char16_t, wchar_t>(source);
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    static_cast<void>(size);
+    return FnUTF(src.cbegin(), src.cend(), dst, error);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    static_cast<void>(size);
+    return FnUTF(src.data(), src.data() + src.size(), dst, error);
+#else // Safe layer
+    return FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst, size}, error);
+#endif
 }
-inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source)
+
+template<int UTF, std::size_t SizeX, typename Src, typename Dst,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+uaiw_constexpr conv_result t_utf_into(std::basic_string_view<Src> src, Dst* dst, std::size_t size,
+                                      conv_state* state, bool strict)
 {
-    return utf32to16<wchar_t, char16_t>(source);
-}
-#endif // WCHAR_MAX >= 0x7FFFFFFF
+    conv_result result;
 
-namespace strict {
+    std::size_t err = impl_npos;
+    size_t* const error = strict ? &err : nullptr;
+    const bool flush = !state || src.empty();
 
-// Template functions
+    // Buffer for a sequence that doesn't fit into a chunk
+    std::array<Dst, t_into_max_len<UTF> * SizeX> buf{};
 
-template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-utf8to16(std::basic_string_view<UTF8> source, una::error& error, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    std::size_t pos = 0;
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source, error);
-}
-template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
-uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
-utf16to8(std::basic_string_view<UTF16> source, una::error& error, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    // Complete the sequence from the previous call first
+    if (state && conv_state_access::count(*state))
+    {
+        std::array<Src, t_into_max_len<UTF>> tmp{};
+
+        const std::size_t count = conv_state_access::count(*state);
+        std::size_t end = 0;
+        for (; end < count; ++end)
+            tmp[end] = static_cast<Src>(conv_state_access::units(*state)[end]);
+        for (; end < tmp.size() && end - count < src.size() && t_into_is_trail<UTF>(src[end - count]); ++end)
+            tmp[end] = src[end - count];
+
+        // Still incomplete so just store it
+        if (!flush && end - count == src.size() &&
+            t_into_tail<UTF>(std::basic_string_view<Src>{tmp.data(), end}, 0) == end)
+        {
+            for (std::size_t i = count; i < end; ++i)
+                conv_state_access::units(*state)[i] = static_cast<type_codept>(tmp[i]);
+            conv_state_access::count(*state) = end;
+            result.read = src.size();
+            return result;
+        }
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source, error);
-}
-template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
-uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
-utf8to32(std::basic_string_view<UTF8> source, una::error& error, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+        const std::size_t n = t_into_call<Src, Dst, FnUTF>(std::basic_string_view<Src>{tmp.data(), end}, buf.data(), buf.size(), error);
+        if (n > size)
+            return result; // The buffer is full
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source, error);
-}
-template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
-uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
-utf32to8(std::basic_string_view<UTF32> source, una::error& error, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF8>);
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+        for (std::size_t i = 0; i < n; ++i)
+            dst[i] = buf[i];
+        result.written = n;
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source, error);
-}
-template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
-uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
-utf16to32(std::basic_string_view<UTF16> source, una::error& error, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+        conv_state_access::count(*state) = 0;
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source, error);
-}
-template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-utf32to16(std::basic_string_view<UTF32> source, una::error& error, const Alloc& alloc = Alloc())
-{
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
-    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+        if (err != impl_npos)
+        {
+            result.read = (err < count) ? 0 : err - count;
+            result.error = una::error{una::error::code::ill_formed_utf, result.read};
+            return result;
+        }
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source, error);
-}
+        pos = end - count;
+    }
 
-// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+    while (pos < src.size())
+    {
+        const std::size_t avail = size - result.written;
 
-inline uaiw_constexpr std::u16string utf8to16u(std::string_view source, una::error& error)
-{
-    return utf8to16<char, char16_t>(source, error);
-}
-inline uaiw_constexpr std::string utf16to8(std::u16string_view source, una::error& error)
-{
-    return utf16to8<char16_t, char>(source, error);
-}
-inline uaiw_constexpr std::u32string utf8to32u(std::string_view source, una::error& error)
-{
-    return utf8to32<char, char32_t>(source, error);
-}
+        std::size_t end = pos + ((src.size() - pos < avail / SizeX) ? src.size() - pos : avail / SizeX);
+        if (end < src.size())
+            end = t_into_split<UTF>(src, pos, end);
+        else if (!flush)
+            end -= t_into_tail<UTF>(src, pos);
+
+        if (end == pos) // The sequence doesn't fit into a chunk or incomplete sequence at the end
+        {
+            end = pos + 1;
+            while (end < src.size() && end - pos < t_into_max_len<UTF> && t_into_is_trail<UTF>(src[end]))
+                ++end;
+
+            if (!flush && end == src.size() && t_into_tail<UTF>(src, pos) == end - pos)
+            {
+                for (std::size_t i = pos; i < end; ++i)
+                    conv_state_access::units(*state)[i - pos] = static_cast<type_codept>(src[i]);
+                conv_state_access::count(*state) = end - pos;
+                pos = end;
+                break;
+            }
+
+            const std::size_t n = t_into_call<Src, Dst, FnUTF>(src.substr(pos, end - pos), buf.data(), buf.size(), error);
+            if (n > avail)
+                break; // The buffer is full
+
+            for (std::size_t i = 0; i < n; ++i)
+                dst[result.written + i] = buf[i];
+            result.written += n;
+        }
+        else
+        {
+            result.written += t_into_call<Src, Dst, FnUTF>(src.substr(pos, end - pos), dst + result.written, avail, error);
+        }
+
+        if (err != impl_npos)
+        {
+            result.read = pos + err;
+            result.error = una::error{una::error::code::ill_formed_utf, result.read};
+            return result;
+        }
+
+        pos = end;
+    }
+
+    result.read = pos;
+
+    return result;
+}
+
+// Batch conversion
+// All strings are converted back to back into one string (the arena) with the usual conversion
+// functions so it is one allocation for all strings instead of one allocation and one shrink_to_fit
+// per string. The arena is resized to the maximum possible size of the results and then to the actual size.
+// The arena is not shrunk and the result is appended to it, so the same arena can be reused for many batches.
+// Only a forward range can be passed twice to compute the size first, an input range is passed once
+// and the arena grows for every string so it is a few allocations in this case.
+
+template<typename Range, typename = void>
+struct batch_is_forward : std::false_type {};
+template<typename Range>
+struct batch_is_forward<Range, std::void_t<typename std::iterator_traits<
+    decltype(std::begin(std::declval<const Range&>()))>::iterator_category>>
+    : std::is_convertible<typename std::iterator_traits<
+        decltype(std::begin(std::declval<const Range&>()))>::iterator_category, std::forward_iterator_tag> {};
+
+template<std::size_t SizeX, typename Src, typename Dst, typename Alloc, typename Range,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+uaiw_constexpr std::vector<std::size_t> t_utf_batch(const Range& sources, std::basic_string<Dst, std::char_traits<Dst>, Alloc>& arena)
+{
+    std::vector<std::size_t> offsets;
+
+    std::size_t pos = arena.size();
+
+    if constexpr (batch_is_forward<Range>::value)
+    {
+        const std::size_t limit = (arena.max_size() - pos) / SizeX;
+
+        std::size_t length = 0;
+        std::size_t count = 0;
+        for (const auto& source : sources)
+        {
+            const std::size_t size = std::basic_string_view<Src>{source}.size();
+
+            if (size > limit - length) // Overflow protection
+            {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+                throw std::bad_alloc();
+#else
+                std::abort();
+#endif
+            }
+
+            length += size;
+            ++count;
+        }
+
+        offsets.reserve(count + 1);
+        arena.resize(pos + length * SizeX);
+    }
+
+    for (const auto& source : sources)
+    {
+        const std::basic_string_view<Src> src{source};
+
+        if constexpr (!batch_is_forward<Range>::value)
+        {
+            if (src.size() > (arena.max_size() - pos) / SizeX) // Overflow protection
+            {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+                throw std::bad_alloc();
+#else
+                std::abort();
+#endif
+            }
+
+            arena.resize(pos + src.size() * SizeX);
+        }
+
+        offsets.push_back(pos);
+        pos += t_into_call<Src, Dst, FnUTF>(src, arena.data() + pos, src.size() * SizeX, nullptr);
+    }
+    offsets.push_back(pos);
+
+    arena.resize(pos);
+
+    return offsets;
+}
+
+// Diagnostic conversion and validation
+// The usual strict functions are called again and again from the position after the last ill-formed sequence
+// so every code unit is still processed only once and the fast paths of the functions are used for valid parts.
+// The length of an ill-formed sequence is the same as in lenient mode (maximal subpart in UTF-8).
+
+template<int UTF, typename Src>
+uaiw_constexpr conv_issue t_diag_issue(std::basic_string_view<Src> src, std::size_t pos)
+{
+    using kind = conv_issue::kind;
+
+    const type_codept c = static_cast<type_codept>(src[pos]);
+
+    if constexpr (UTF == 8)
+    {
+        type_codept codepoint = 0;
+        const std::size_t count = static_cast<std::size_t>(
+            inline_iter_utf8(src.cbegin() + static_cast<std::ptrdiff_t>(pos), src.cend(), &codepoint, impl_iter_replacement) -
+            (src.cbegin() + static_cast<std::ptrdiff_t>(pos)));
+
+        const type_codept b0 = c & 0xFF;
+        const type_codept b1 = (pos + 1 < src.size()) ? (static_cast<type_codept>(src[pos + 1]) & 0xFF) : 0;
+
+        kind type = kind::truncated;
+        if (b0 <= 0xBF || b0 >= 0xF8)
+            type = kind::invalid;
+        else if (b0 <= 0xC1 || (b0 == 0xE0 && b1 >= 0x80 && b1 <= 0x9F) || (b0 == 0xF0 && b1 >= 0x80 && b1 <= 0x8F))
+            type = kind::overlong;
+        else if (b0 == 0xED && b1 >= 0xA0 && b1 <= 0xBF)
+            type = kind::surrogate;
+        else if (b0 >= 0xF5 || (b0 == 0xF4 && b1 >= 0x90 && b1 <= 0xBF))
+            type = kind::out_of_range;
+
+        return conv_issue{pos, count, type};
+    }
+    else if constexpr (UTF == 16)
+    {
+        const type_codept h = c & 0xFFFF;
+        const bool at_end = (h >= 0xD800 && h <= 0xDBFF && pos + 1 == src.size());
+        return conv_issue{pos, 1, at_end ? kind::truncated : kind::surrogate};
+    }
+    else
+    {
+        const type_codept u = c & 0xFFFFFFFF;
+        return conv_issue{pos, 1, (u >= 0xD800 && u <= 0xDFFF) ? kind::surrogate : kind::out_of_range};
+    }
+}
+
+template<int UTF, std::size_t SizeX, typename Src, typename Dst, typename Alloc,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+uaiw_constexpr std::basic_string<Dst, std::char_traits<Dst>, Alloc>
+t_utf_diag(const Alloc& alloc, std::basic_string_view<Src> src, std::vector<conv_issue>& issues)
+{
+    std::basic_string<Dst, std::char_traits<Dst>, Alloc> dst{alloc};
+
+    if (src.empty())
+        return dst;
+
+    if (src.size() > dst.max_size() / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    dst.resize(src.size() * SizeX);
+
+    std::size_t pos = 0;
+    std::size_t written = 0;
+
+    while (true)
+    {
+        std::size_t err = impl_npos;
+        written += t_into_call<Src, Dst, FnUTF>(src.substr(pos), dst.data() + written, dst.size() - written, &err);
+
+        if (err == impl_npos)
+            break;
+
+        const conv_issue issue = t_diag_issue<UTF>(src, pos + err);
+        issues.push_back(issue);
+        pos = issue.pos + issue.count;
+
+        // Replacement char U+FFFD
+        if constexpr (sizeof(Dst) == sizeof(char))
+        {
+            dst[written++] = static_cast<Dst>(0xEF);
+            dst[written++] = static_cast<Dst>(0xBF);
+            dst[written++] = static_cast<Dst>(0xBD);
+        }
+        else
+            dst[written++] = static_cast<Dst>(0xFFFD);
+    }
+
+    dst.resize(written);
+
+#ifndef UNI_ALGO_NO_SHRINK_TO_FIT
+    dst.shrink_to_fit();
+#endif
+
+    return dst;
+}
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+template<int UTF, typename Src, bool(*FnValid)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+template<int UTF, typename Src, bool(*FnValid)(const Src*, const Src*, size_t*)>
+#else // Safe layer
+template<int UTF, typename Src, bool(*FnValid)(safe::in<const Src*>, safe::end<const Src*>, size_t*)>
+#endif
+uaiw_constexpr bool t_valid_diag(std::basic_string_view<Src> src, std::vector<conv_issue>& issues)
+{
+    bool ret = true;
+
+    for (std::size_t pos = 0; pos < src.size();)
+    {
+        const std::basic_string_view<Src> part = src.substr(pos);
+        std::size_t err = impl_npos;
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        if (FnValid(part.cbegin(), part.cend(), &err))
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        if (FnValid(part.data(), part.data() + part.size(), &err))
+#else // Safe layer
+        if (FnValid(safe::in{part.data(), part.size()}, safe::end{part.data() + part.size()}, &err))
+#endif
+            break;
+
+        const conv_issue issue = t_diag_issue<UTF>(src, pos + err);
+        issues.push_back(issue);
+        pos = issue.pos + issue.count;
+        ret = false;
+    }
+
+    return ret;
+}
+
+// In place sanitization of UTF-8
+
+template<typename UTF8, typename Alloc>
+uaiw_constexpr bool t_sanitize_utf8(std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& str)
+{
+    using view_t = std::basic_string_view<UTF8>;
+
+    una::error error;
+    if (t_valid<view_t, impl_is_valid_utf8>(view_t{str}, error))
+        return false;
+
+    // Valid text before the first ill-formed sequence is never touched
+    const std::size_t first = error.pos();
+    const std::size_t size = str.size();
+
+    // U+FFFD is 3 bytes and an ill-formed sequence (maximal subpart) is 1-3 bytes
+    // so the string only grows, find the growth first to know where the result ends
+    std::size_t growth = 0;
+    for (std::size_t pos = first; pos < size;)
+    {
+        const view_t src{str};
+        const auto it = src.cbegin() + static_cast<std::ptrdiff_t>(pos);
+        type_codept c = 0;
+        const std::size_t count = static_cast<std::size_t>(inline_iter_utf8(it, src.cend(), &c, impl_iter_replacement) - it);
+
+        growth += 3 - count;
+        pos += count;
+
+        if (t_valid<view_t, impl_is_valid_utf8>(src.substr(pos), error))
+            break;
+
+        pos += error.pos();
+    }
+
+    if (growth > str.max_size() - size) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    // The string is reallocated only if the capacity is not enough, then the rest of the string
+    // is moved to the end and converted in place so the result is always behind the source.
+    str.resize(size + growth);
+    UTF8* data = str.data();
+    std::char_traits<UTF8>::move(data + first + growth, data + first, size - first);
+    t_into_call<UTF8, UTF8, impl_utf8to8>(view_t{data + first + growth, size - first}, data + first, size + growth - first, nullptr);
+
+    return true;
+}
+
+// Automatic decoding
+// The encoding is detected by BOM or if there is no BOM by NUL bytes at the beginning of the source,
+// text in UTF-16 and UTF-32 almost always contains them (every ASCII code point has them)
+// and text in UTF-8 almost never, so the source without NUL bytes is always UTF-8.
+// But NUL is still valid in UTF-8 so a few NUL bytes do not make valid UTF-8 something else,
+// only a regular pattern does: every code unit in UTF-32 has a zero high byte and the next byte
+// is <= 0x10 or at least half of UTF-16 code units have NUL bytes at the same parity that tells
+// the byte order. Without the pattern only the source that is not valid UTF-8 is decoded
+// as UTF-16 by the parity of NUL bytes.
+
+enum class decode_as : unsigned char {utf8, utf16le, utf16be, utf32le, utf32be};
+
+struct decode_detected
+{
+    decode_as encoding = decode_as::utf8;
+    std::size_t bom = 0;
+};
+
+// The number of bytes that are used by the heuristic
+inline constexpr std::size_t decode_sample = 1024;
+
+inline uaiw_constexpr decode_detected t_decode_detect(std::string_view src)
+{
+    auto byte = [&src](std::size_t i) { return static_cast<type_codept>(src[i]) & 0xFF; };
+
+    if (src.size() >= 3 && byte(0) == 0xEF && byte(1) == 0xBB && byte(2) == 0xBF)
+        return {decode_as::utf8, 3};
+    if (src.size() >= 4 && byte(0) == 0xFF && byte(1) == 0xFE && byte(2) == 0x00 && byte(3) == 0x00)
+        return {decode_as::utf32le, 4};
+    if (src.size() >= 4 && byte(0) == 0x00 && byte(1) == 0x00 && byte(2) == 0xFE && byte(3) == 0xFF)
+        return {decode_as::utf32be, 4};
+    if (src.size() >= 2 && byte(0) == 0xFF && byte(1) == 0xFE)
+        return {decode_as::utf16le, 2};
+    if (src.size() >= 2 && byte(0) == 0xFE && byte(1) == 0xFF)
+        return {decode_as::utf16be, 2};
+
+    const std::size_t size = (src.size() < decode_sample) ? src.size() : decode_sample;
+
+    std::size_t zeros_even = 0;
+    std::size_t zeros_odd = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (byte(i) == 0)
+            ++((i % 2) ? zeros_odd : zeros_even);
+    }
+
+    if (zeros_even + zeros_odd < 2) // Any code unit in UTF-32 and ASCII in UTF-16 have 2 NUL bytes
+        return {decode_as::utf8, 0};
+
+    if (src.size() % 4 == 0)
+    {
+        bool le = true;
+        bool be = true;
+        for (std::size_t i = 0; i + 3 < size; i += 4)
+        {
+            if (byte(i + 3) != 0 || byte(i + 2) > 0x10)
+                le = false;
+            if (byte(i) != 0 || byte(i + 1) > 0x10)
+                be = false;
+        }
+
+        if (le)
+            return {decode_as::utf32le, 0};
+        if (be)
+            return {decode_as::utf32be, 0};
+    }
+
+    const std::size_t zeros_max = (zeros_odd > zeros_even) ? zeros_odd : zeros_even;
+    const std::size_t zeros_min = (zeros_odd > zeros_even) ? zeros_even : zeros_odd;
+
+    const bool regular = zeros_max * 4 >= size && zeros_min * 4 <= zeros_max;
+
+    if (!regular && t_valid<std::string_view, impl_is_valid_utf8>(src))
+        return {decode_as::utf8, 0};
+
+    if (zeros_odd > zeros_even)
+        return {decode_as::utf16le, 0};
+    if (zeros_even > zeros_odd)
+        return {decode_as::utf16be, 0};
+
+    return {decode_as::utf8, 0};
+}
+
+} // namespace detail
+
+// Template functions
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source);
+}
+
+// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+
+inline uaiw_constexpr std::u16string utf8to16u(std::string_view source)
+{
+    return utf8to16<char, char16_t>(source);
+}
+inline uaiw_constexpr std::string utf16to8(std::u16string_view source)
+{
+    return utf16to8<char16_t, char>(source);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::string_view source)
+{
+    return utf8to32<char, char32_t>(source);
+}
+inline uaiw_constexpr std::string utf32to8(std::u32string_view source)
+{
+    return utf32to8<char32_t, char>(source);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source)
+{
+    return utf16to32<char16_t, char32_t>(source);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source)
+{
+    return utf32to16<char32_t, char16_t>(source);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to16(std::string_view source)
+{
+    return utf8to16<char, wchar_t>(source);
+}
+inline uaiw_constexpr std::string utf16to8(std::wstring_view source)
+{
+    return utf16to8<wchar_t, char>(source);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::wstring_view source)
+{
+    return utf16to32<wchar_t, char32_t>(source);
+}
+inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source)
+{
+    return utf32to16<char32_t, wchar_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to32(std::string_view source)
+{
+    return utf8to32<char, wchar_t>(source);
+}
+inline uaiw_constexpr std::string utf32to8(std::wstring_view source)
+{
+    return utf32to8<wchar_t, char>(source);
+}
+inline uaiw_constexpr std::wstring utf16to32(std::u16string_view source)
+{
+    return utf16to32<char16_t, wchar_t>(source);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source)
+{
+    return utf32to16<wchar_t, char16_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+// Conversion functions with an error policy (see una::conv_policy) as the first template parameter
+// The policy is applied at compile time in the error path of the conversion so the default
+// replacement has no overhead, stop policy returns the part of the string before the first error.
+
+template<char32_t Policy, typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(detail::is_conv_policy<Policy>);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using src_t = std::basic_string_view<UTF8>;
+    using dst_t = std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>;
+
+    return detail::t_utf<dst_t, Alloc, src_t, detail::t_conv_x<Policy, detail::impl_x_utf8to16, detail::impl_x_utf8to16_policy>,
+            detail::impl_utf8to16<detail::t_conv_in<src_t>, detail::t_conv_end<src_t>, detail::t_conv_out<dst_t>, true, Policy>>(alloc, source);
+}
+template<char32_t Policy, typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(detail::is_conv_policy<Policy>);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using src_t = std::basic_string_view<UTF16>;
+    using dst_t = std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>;
+
+    return detail::t_utf<dst_t, Alloc, src_t, detail::t_conv_x<Policy, detail::impl_x_utf16to8, detail::impl_x_utf16to8_policy>,
+            detail::impl_utf16to8<detail::t_conv_in<src_t>, detail::t_conv_end<src_t>, detail::t_conv_out<dst_t>, true, Policy>>(alloc, source);
+}
+template<char32_t Policy, typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(detail::is_conv_policy<Policy>);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    using src_t = std::basic_string_view<UTF8>;
+    using dst_t = std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>;
+
+    return detail::t_utf<dst_t, Alloc, src_t, detail::t_conv_x<Policy, detail::impl_x_utf8to32, detail::impl_x_utf8to32_policy>,
+            detail::impl_utf8to32<detail::t_conv_in<src_t>, detail::t_conv_end<src_t>, detail::t_conv_out<dst_t>, true, Policy>>(alloc, source);
+}
+template<char32_t Policy, typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(detail::is_conv_policy<Policy>);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    using src_t = std::basic_string_view<UTF32>;
+    using dst_t = std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>;
+
+    return detail::t_utf<dst_t, Alloc, src_t, detail::t_conv_x<Policy, detail::impl_x_utf32to8, detail::impl_x_utf32to8_policy>,
+            detail::impl_utf32to8<detail::t_conv_in<src_t>, detail::t_conv_end<src_t>, detail::t_conv_out<dst_t>, true, Policy>>(alloc, source);
+}
+template<char32_t Policy, typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(detail::is_conv_policy<Policy>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    using src_t = std::basic_string_view<UTF16>;
+    using dst_t = std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>;
+
+    return detail::t_utf<dst_t, Alloc, src_t, detail::t_conv_x<Policy, detail::impl_x_utf16to32, detail::impl_x_utf16to32_policy>,
+            detail::impl_utf16to32<detail::t_conv_in<src_t>, detail::t_conv_end<src_t>, detail::t_conv_out<dst_t>, true, Policy>>(alloc, source);
+}
+template<char32_t Policy, typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(detail::is_conv_policy<Policy>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    using src_t = std::basic_string_view<UTF32>;
+    using dst_t = std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>;
+
+    return detail::t_utf<dst_t, Alloc, src_t, detail::t_conv_x<Policy, detail::impl_x_utf32to16, detail::impl_x_utf32to16_policy>,
+            detail::impl_utf32to16<detail::t_conv_in<src_t>, detail::t_conv_end<src_t>, detail::t_conv_out<dst_t>, true, Policy>>(alloc, source);
+}
+
+// Short functions with an error policy for std::string, std::wstring, std::u16string, std::u32string
+
+template<char32_t Policy>
+uaiw_constexpr std::u16string utf8to16u(std::string_view source)
+{
+    return utf8to16<Policy, char, char16_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::string utf16to8(std::u16string_view source)
+{
+    return utf16to8<Policy, char16_t, char>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u32string utf8to32u(std::string_view source)
+{
+    return utf8to32<Policy, char, char32_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::string utf32to8(std::u32string_view source)
+{
+    return utf32to8<Policy, char32_t, char>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u32string utf16to32u(std::u16string_view source)
+{
+    return utf16to32<Policy, char16_t, char32_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u16string utf32to16u(std::u32string_view source)
+{
+    return utf32to16<Policy, char32_t, char16_t>(source);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+template<char32_t Policy>
+uaiw_constexpr std::wstring utf8to16(std::string_view source)
+{
+    return utf8to16<Policy, char, wchar_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::string utf16to8(std::wstring_view source)
+{
+    return utf16to8<Policy, wchar_t, char>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u32string utf16to32u(std::wstring_view source)
+{
+    return utf16to32<Policy, wchar_t, char32_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::wstring utf32to16(std::u32string_view source)
+{
+    return utf32to16<Policy, char32_t, wchar_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+template<char32_t Policy>
+uaiw_constexpr std::wstring utf8to32(std::string_view source)
+{
+    return utf8to32<Policy, char, wchar_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::string utf32to8(std::wstring_view source)
+{
+    return utf32to8<Policy, wchar_t, char>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::wstring utf16to32(std::u16string_view source)
+{
+    return utf16to32<Policy, char16_t, wchar_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u16string utf32to16u(std::wstring_view source)
+{
+    return utf32to16<Policy, wchar_t, char16_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+// Conversion functions from UTF-16BE/LE and UTF-32BE/LE bytes to UTF-8
+// The byte order is handled during the conversion so there is no separate byte swap pass.
+// An incomplete code unit at the end of the source (odd trailing byte in UTF-16 etc.)
+// is ill-formed and replaced with U+FFFD, error position in strict functions is in bytes.
+
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16be_bytes_to8(std::basic_string_view<Byte> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf16bytes_to8, detail::impl_utf16be_to8>(alloc, source);
+}
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16le_bytes_to8(std::basic_string_view<Byte> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf16bytes_to8, detail::impl_utf16le_to8>(alloc, source);
+}
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32be_bytes_to8(std::basic_string_view<Byte> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf32bytes_to8, detail::impl_utf32be_to8>(alloc, source);
+}
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32le_bytes_to8(std::basic_string_view<Byte> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf32bytes_to8, detail::impl_utf32le_to8>(alloc, source);
+}
+
+// Short non-template functions for std::string
+
+inline uaiw_constexpr std::string utf16be_bytes_to8(std::string_view source)
+{
+    return utf16be_bytes_to8<char, char>(source);
+}
+inline uaiw_constexpr std::string utf16le_bytes_to8(std::string_view source)
+{
+    return utf16le_bytes_to8<char, char>(source);
+}
+inline uaiw_constexpr std::string utf32be_bytes_to8(std::string_view source)
+{
+    return utf32be_bytes_to8<char, char>(source);
+}
+inline uaiw_constexpr std::string utf32le_bytes_to8(std::string_view source)
+{
+    return utf32le_bytes_to8<char, char>(source);
+}
+
+namespace strict {
+
+// Template functions
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source, error);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source, error);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source, error);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source, error);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source, error);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source, error);
+}
+
+// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+
+inline uaiw_constexpr std::u16string utf8to16u(std::string_view source, una::error& error)
+{
+    return utf8to16<char, char16_t>(source, error);
+}
+inline uaiw_constexpr std::string utf16to8(std::u16string_view source, una::error& error)
+{
+    return utf16to8<char16_t, char>(source, error);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::string_view source, una::error& error)
+{
+    return utf8to32<char, char32_t>(source, error);
+}
 inline uaiw_constexpr std::string utf32to8(std::u32string_view source, una::error& error)
 {
-    return utf32to8<char32_t, char>(source, error);
+    return utf32to8<char32_t, char>(source, error);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source, una::error& error)
+{
+    return utf16to32<char16_t, char32_t>(source, error);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source, una::error& error)
+{
+    return utf32to16<char32_t, char16_t>(source, error);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to16(std::string_view source, una::error& error)
+{
+    return utf8to16<char, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::string utf16to8(std::wstring_view source, una::error& error)
+{
+    return utf16to8<wchar_t, char>(source, error);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::wstring_view source, una::error& error)
+{
+    return utf16to32<wchar_t, char32_t>(source, error);
+}
+inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source, una::error& error)
+{
+    return utf32to16<char32_t, wchar_t>(source, error);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to32(std::string_view source, una::error& error)
+{
+    return utf8to32<char, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::string utf32to8(std::wstring_view source, una::error& error)
+{
+    return utf32to8<wchar_t, char>(source, error);
+}
+inline uaiw_constexpr std::wstring utf16to32(std::u16string_view source, una::error& error)
+{
+    return utf16to32<char16_t, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source, una::error& error)
+{
+    return utf32to16<wchar_t, char16_t>(source, error);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+// Conversion functions from UTF-16BE/LE and UTF-32BE/LE bytes to UTF-8
+
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16be_bytes_to8(std::basic_string_view<Byte> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf16bytes_to8, detail::impl_utf16be_to8>(alloc, source, error);
+}
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16le_bytes_to8(std::basic_string_view<Byte> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf16bytes_to8, detail::impl_utf16le_to8>(alloc, source, error);
+}
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32be_bytes_to8(std::basic_string_view<Byte> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf32bytes_to8, detail::impl_utf32be_to8>(alloc, source, error);
+}
+template<typename Byte, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32le_bytes_to8(std::basic_string_view<Byte> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<Byte> && sizeof(Byte) == sizeof(char));
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<Byte>,
+            detail::impl_x_utf32bytes_to8, detail::impl_utf32le_to8>(alloc, source, error);
+}
+
+// Short non-template functions for std::string
+
+inline uaiw_constexpr std::string utf16be_bytes_to8(std::string_view source, una::error& error)
+{
+    return utf16be_bytes_to8<char, char>(source, error);
+}
+inline uaiw_constexpr std::string utf16le_bytes_to8(std::string_view source, una::error& error)
+{
+    return utf16le_bytes_to8<char, char>(source, error);
+}
+inline uaiw_constexpr std::string utf32be_bytes_to8(std::string_view source, una::error& error)
+{
+    return utf32be_bytes_to8<char, char>(source, error);
+}
+inline uaiw_constexpr std::string utf32le_bytes_to8(std::string_view source, una::error& error)
+{
+    return utf32le_bytes_to8<char, char>(source, error);
+}
+
+} // namespace strict
+
+namespace exact {
+
+// The same as conversion functions but the memory is allocated only once
+// without the overallocation, slower but can be useful for large strings.
+// Only for the conversions where the result can be bigger than the source.
+
+// Template functions
+
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_exact<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_utf8_length_from_utf16, detail::impl_utf16to8>(alloc, source);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_exact<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_utf8_length_from_utf32, detail::impl_utf32to8>(alloc, source);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_exact<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_utf16_length_from_utf32, detail::impl_utf32to16>(alloc, source);
+}
+
+// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+
+inline uaiw_constexpr std::string utf16to8(std::u16string_view source)
+{
+    return utf16to8<char16_t, char>(source);
+}
+inline uaiw_constexpr std::string utf32to8(std::u32string_view source)
+{
+    return utf32to8<char32_t, char>(source);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source)
+{
+    return utf32to16<char32_t, char16_t>(source);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::string utf16to8(std::wstring_view source)
+{
+    return utf16to8<wchar_t, char>(source);
+}
+inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source)
+{
+    return utf32to16<char32_t, wchar_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::string utf32to8(std::wstring_view source)
+{
+    return utf32to8<wchar_t, char>(source);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source)
+{
+    return utf32to16<wchar_t, char16_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+} // namespace exact
+
+namespace batch {
+
+// Convert many strings into one string (the arena) back to back, useful for many short strings
+// because it is one allocation for all of them instead of one allocation per string.
+// Range is any range of strings or string views (a single-pass range is passed only once),
+// the results are appended to the arena and the function returns the offsets of the results
+// in the arena (the number of strings + 1)
+// so the result number i is arena[offsets[i], offsets[i + 1]).
+// The arena is not shrunk after the conversion so it can be reused for the next batch.
+
+// Template functions
+
+template<typename UTF8, typename UTF16, typename Range, typename Alloc>
+uaiw_constexpr std::vector<std::size_t>
+utf8to16(const Range& sources, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& arena)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_batch<detail::impl_x_utf8to16, UTF8, UTF16, Alloc, Range, detail::impl_utf8to16>(sources, arena);
+}
+template<typename UTF16, typename UTF8, typename Range, typename Alloc>
+uaiw_constexpr std::vector<std::size_t>
+utf16to8(const Range& sources, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& arena)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_batch<detail::impl_x_utf16to8, UTF16, UTF8, Alloc, Range, detail::impl_utf16to8>(sources, arena);
+}
+template<typename UTF8, typename UTF32, typename Range, typename Alloc>
+uaiw_constexpr std::vector<std::size_t>
+utf8to32(const Range& sources, std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>& arena)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_batch<detail::impl_x_utf8to32, UTF8, UTF32, Alloc, Range, detail::impl_utf8to32>(sources, arena);
+}
+template<typename UTF32, typename UTF8, typename Range, typename Alloc>
+uaiw_constexpr std::vector<std::size_t>
+utf32to8(const Range& sources, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& arena)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_batch<detail::impl_x_utf32to8, UTF32, UTF8, Alloc, Range, detail::impl_utf32to8>(sources, arena);
+}
+template<typename UTF16, typename UTF32, typename Range, typename Alloc>
+uaiw_constexpr std::vector<std::size_t>
+utf16to32(const Range& sources, std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>& arena)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_batch<detail::impl_x_utf16to32, UTF16, UTF32, Alloc, Range, detail::impl_utf16to32>(sources, arena);
+}
+template<typename UTF32, typename UTF16, typename Range, typename Alloc>
+uaiw_constexpr std::vector<std::size_t>
+utf32to16(const Range& sources, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& arena)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_batch<detail::impl_x_utf32to16, UTF32, UTF16, Alloc, Range, detail::impl_utf32to16>(sources, arena);
+}
+
+// Short functions for std::string, std::u16string, std::u32string
+
+template<typename Range>
+uaiw_constexpr std::vector<std::size_t> utf8to16u(const Range& sources, std::u16string& arena)
+{
+    return utf8to16<char, char16_t>(sources, arena);
+}
+template<typename Range>
+uaiw_constexpr std::vector<std::size_t> utf16to8(const Range& sources, std::string& arena)
+{
+    return utf16to8<char16_t, char>(sources, arena);
+}
+template<typename Range>
+uaiw_constexpr std::vector<std::size_t> utf8to32u(const Range& sources, std::u32string& arena)
+{
+    return utf8to32<char, char32_t>(sources, arena);
+}
+template<typename Range>
+uaiw_constexpr std::vector<std::size_t> utf32to8(const Range& sources, std::string& arena)
+{
+    return utf32to8<char32_t, char>(sources, arena);
+}
+template<typename Range>
+uaiw_constexpr std::vector<std::size_t> utf16to32u(const Range& sources, std::u32string& arena)
+{
+    return utf16to32<char16_t, char32_t>(sources, arena);
+}
+template<typename Range>
+uaiw_constexpr std::vector<std::size_t> utf32to16u(const Range& sources, std::u16string& arena)
+{
+    return utf32to16<char32_t, char16_t>(sources, arena);
+}
+
+} // namespace batch
+
+namespace diag {
+
+// The same as lenient conversion and validation functions but every ill-formed sequence
+// is also appended to the vector of issues with its position and kind (see una::conv_issue),
+// the result of conversion functions is always the same as the result of lenient functions.
+
+// Template functions
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, std::vector<una::conv_issue>& issues, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_diag<8, detail::impl_x_utf8to16, UTF8, UTF16, Alloc, detail::impl_utf8to16>(alloc, source, issues);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, std::vector<una::conv_issue>& issues, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_diag<16, detail::impl_x_utf16to8, UTF16, UTF8, Alloc, detail::impl_utf16to8>(alloc, source, issues);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, std::vector<una::conv_issue>& issues, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_diag<8, detail::impl_x_utf8to32, UTF8, UTF32, Alloc, detail::impl_utf8to32>(alloc, source, issues);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, std::vector<una::conv_issue>& issues, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_diag<32, detail::impl_x_utf32to8, UTF32, UTF8, Alloc, detail::impl_utf32to8>(alloc, source, issues);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, std::vector<una::conv_issue>& issues, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_diag<16, detail::impl_x_utf16to32, UTF16, UTF32, Alloc, detail::impl_utf16to32>(alloc, source, issues);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, std::vector<una::conv_issue>& issues, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_diag<32, detail::impl_x_utf32to16, UTF32, UTF16, Alloc, detail::impl_utf32to16>(alloc, source, issues);
+}
+template<typename UTF8>
+uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source, std::vector<una::conv_issue>& issues)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_valid_diag<8, UTF8, detail::impl_is_valid_utf8>(source, issues);
+}
+template<typename UTF16>
+uaiw_constexpr bool is_valid_utf16(std::basic_string_view<UTF16> source, std::vector<una::conv_issue>& issues)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_valid_diag<16, UTF16, detail::impl_is_valid_utf16>(source, issues);
+}
+template<typename UTF32>
+uaiw_constexpr bool is_valid_utf32(std::basic_string_view<UTF32> source, std::vector<una::conv_issue>& issues)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_valid_diag<32, UTF32, detail::impl_is_valid_utf32>(source, issues);
+}
+
+// Short non-template functions for std::string, std::u16string, std::u32string
+
+inline uaiw_constexpr std::u16string utf8to16u(std::string_view source, std::vector<una::conv_issue>& issues)
+{
+    return utf8to16<char, char16_t>(source, issues);
+}
+inline uaiw_constexpr std::string utf16to8(std::u16string_view source, std::vector<una::conv_issue>& issues)
+{
+    return utf16to8<char16_t, char>(source, issues);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::string_view source, std::vector<una::conv_issue>& issues)
+{
+    return utf8to32<char, char32_t>(source, issues);
+}
+inline uaiw_constexpr std::string utf32to8(std::u32string_view source, std::vector<una::conv_issue>& issues)
+{
+    return utf32to8<char32_t, char>(source, issues);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source, std::vector<una::conv_issue>& issues)
+{
+    return utf16to32<char16_t, char32_t>(source, issues);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source, std::vector<una::conv_issue>& issues)
+{
+    return utf32to16<char32_t, char16_t>(source, issues);
+}
+inline uaiw_constexpr bool is_valid_utf8(std::string_view source, std::vector<una::conv_issue>& issues)
+{
+    return is_valid_utf8<char>(source, issues);
+}
+inline uaiw_constexpr bool is_valid_utf16(std::u16string_view source, std::vector<una::conv_issue>& issues)
+{
+    return is_valid_utf16<char16_t>(source, issues);
+}
+inline uaiw_constexpr bool is_valid_utf32(std::u32string_view source, std::vector<una::conv_issue>& issues)
+{
+    return is_valid_utf32<char32_t>(source, issues);
+}
+
+} // namespace diag
+
+template<typename UTF8>
+uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_valid<std::basic_string_view<UTF8>, detail::impl_is_valid_utf8>(source);
+}
+
+template<typename UTF16>
+uaiw_constexpr bool is_valid_utf16(std::basic_string_view<UTF16> source)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_valid<std::basic_string_view<UTF16>, detail::impl_is_valid_utf16>(source);
+}
+
+template<typename UTF32>
+uaiw_constexpr bool is_valid_utf32(std::basic_string_view<UTF32> source)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_valid<std::basic_string_view<UTF32>, detail::impl_is_valid_utf32>(source);
+}
+
+template<typename UTF8>
+uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_valid<std::basic_string_view<UTF8>, detail::impl_is_valid_utf8>(source, error);
+}
+
+template<typename UTF16>
+uaiw_constexpr bool is_valid_utf16(std::basic_string_view<UTF16> source, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_valid<std::basic_string_view<UTF16>, detail::impl_is_valid_utf16>(source, error);
+}
+
+template<typename UTF32>
+uaiw_constexpr bool is_valid_utf32(std::basic_string_view<UTF32> source, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_valid<std::basic_string_view<UTF32>, detail::impl_is_valid_utf32>(source, error);
+}
+
+inline uaiw_constexpr bool is_valid_utf8(std::string_view source)
+{
+    return is_valid_utf8<char>(source);
+}
+inline uaiw_constexpr bool is_valid_utf16(std::u16string_view source)
+{
+    return is_valid_utf16<char16_t>(source);
+}
+inline uaiw_constexpr bool is_valid_utf32(std::u32string_view source)
+{
+    return is_valid_utf32<char32_t>(source);
+}
+inline uaiw_constexpr bool is_valid_utf8(std::string_view source, una::error& error)
+{
+    return is_valid_utf8<char>(source, error);
+}
+inline uaiw_constexpr bool is_valid_utf16(std::u16string_view source, una::error& error)
+{
+    return is_valid_utf16<char16_t>(source, error);
+}
+inline uaiw_constexpr bool is_valid_utf32(std::u32string_view source, una::error& error)
+{
+    return is_valid_utf32<char32_t>(source, error);
+}
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr bool is_valid_utf16(std::wstring_view source)
+{
+    return is_valid_utf16<wchar_t>(source);
+}
+inline uaiw_constexpr bool is_valid_utf16(std::wstring_view source, una::error& error)
+{
+    return is_valid_utf16<wchar_t>(source, error);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr bool is_valid_utf32(std::wstring_view source)
+{
+    return is_valid_utf32<wchar_t>(source);
+}
+inline uaiw_constexpr bool is_valid_utf32(std::wstring_view source, una::error& error)
+{
+    return is_valid_utf32<wchar_t>(source, error);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+// Replace ill-formed sequences in UTF-8 string with U+FFFD in place, the result is the same
+// as the result of lenient conversion functions. Returns false if the string is valid, the string
+// is not modified then. The string is reallocated only if its capacity is not enough for the result.
+
+template<typename UTF8, typename Alloc>
+uaiw_constexpr bool sanitize_utf8(std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& source)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_sanitize_utf8(source);
+}
+
+// The length of a string after the conversion (the same as the conversion functions in lenient mode)
+// can be used to allocate the memory for the conversion, see una::exact functions too.
+
+template<typename UTF16>
+uaiw_constexpr std::size_t utf8_length_from_utf16(std::basic_string_view<UTF16> source)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_length<std::basic_string_view<UTF16>, detail::impl_utf8_length_from_utf16>(source);
+}
+
+template<typename UTF32>
+uaiw_constexpr std::size_t utf8_length_from_utf32(std::basic_string_view<UTF32> source)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_length<std::basic_string_view<UTF32>, detail::impl_utf8_length_from_utf32>(source);
+}
+
+template<typename UTF32>
+uaiw_constexpr std::size_t utf16_length_from_utf32(std::basic_string_view<UTF32> source)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_length<std::basic_string_view<UTF32>, detail::impl_utf16_length_from_utf32>(source);
+}
+
+inline uaiw_constexpr std::size_t utf8_length_from_utf16(std::u16string_view source)
+{
+    return utf8_length_from_utf16<char16_t>(source);
+}
+inline uaiw_constexpr std::size_t utf8_length_from_utf32(std::u32string_view source)
+{
+    return utf8_length_from_utf32<char32_t>(source);
+}
+inline uaiw_constexpr std::size_t utf16_length_from_utf32(std::u32string_view source)
+{
+    return utf16_length_from_utf32<char32_t>(source);
+}
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::size_t utf8_length_from_utf16(std::wstring_view source)
+{
+    return utf8_length_from_utf16<wchar_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::size_t utf8_length_from_utf32(std::wstring_view source)
+{
+    return utf8_length_from_utf32<wchar_t>(source);
+}
+inline uaiw_constexpr std::size_t utf16_length_from_utf32(std::wstring_view source)
+{
+    return utf16_length_from_utf32<wchar_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+template<typename UTF8>
+uaiw_constexpr std::size_t utf16_length_from_utf8(std::basic_string_view<UTF8> source)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_length<std::basic_string_view<UTF8>, detail::impl_utf16_length_from_utf8>(source);
+}
+
+inline uaiw_constexpr std::size_t utf16_length_from_utf8(std::string_view source)
+{
+    return utf16_length_from_utf8<char>(source);
+}
+
+// The number of code points in a string (the same as the length of the result of
+// UTF-32 conversion functions in lenient mode so every ill-formed sequence is counted
+// as one code point because it is replaced with U+FFFD)
+
+template<typename UTF8>
+uaiw_constexpr std::size_t count_codepoints_utf8(std::basic_string_view<UTF8> source)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_length<std::basic_string_view<UTF8>, detail::impl_utf32_length_from_utf8>(source);
+}
+
+template<typename UTF16>
+uaiw_constexpr std::size_t count_codepoints_utf16(std::basic_string_view<UTF16> source)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_length<std::basic_string_view<UTF16>, detail::impl_utf32_length_from_utf16>(source);
+}
+
+inline uaiw_constexpr std::size_t count_codepoints_utf8(std::string_view source)
+{
+    return count_codepoints_utf8<char>(source);
+}
+inline uaiw_constexpr std::size_t count_codepoints_utf16(std::u16string_view source)
+{
+    return count_codepoints_utf16<char16_t>(source);
+}
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::size_t count_codepoints_utf16(std::wstring_view source)
+{
+    return count_codepoints_utf16<wchar_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF
+
+// Conversion functions that write to a buffer instead of a string.
+// The conversion stops when the buffer is full, conv_result::read tells where to continue.
+// The buffer must hold at least 4 code units that is enough for any sequence in any encoding,
+// read == 0 and written == 0 without an error means the next sequence doesn't fit into the buffer
+// so a smaller buffer may never make progress and the caller must not call it again with the same buffer.
+// With conv_state an incomplete sequence at the end of the source is kept in the state
+// and completed by the next call, call the function with an empty source at the end of the input.
+// The result is always the same as the result of the conversion of the whole string.
+
+template<typename UTF8, typename UTF16>
+uaiw_constexpr conv_result utf8to16_into(std::basic_string_view<UTF8> source, UTF16* dst, std::size_t size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_into<8, detail::impl_x_utf8to16, UTF8, UTF16, detail::impl_utf8to16>(source, dst, size, nullptr, false);
+}
+template<typename UTF8, typename UTF16>
+uaiw_constexpr conv_result utf8to16_into(std::basic_string_view<UTF8> source, UTF16* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_into<8, detail::impl_x_utf8to16, UTF8, UTF16, detail::impl_utf8to16>(source, dst, size, &state, false);
+}
+template<typename UTF16, typename UTF8>
+uaiw_constexpr conv_result utf16to8_into(std::basic_string_view<UTF16> source, UTF8* dst, std::size_t size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_into<16, detail::impl_x_utf16to8, UTF16, UTF8, detail::impl_utf16to8>(source, dst, size, nullptr, false);
 }
-inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source, una::error& error)
+template<typename UTF16, typename UTF8>
+uaiw_constexpr conv_result utf16to8_into(std::basic_string_view<UTF16> source, UTF8* dst, std::size_t size, conv_state& state)
 {
-    return utf16to32<char16_t, char32_t>(source, error);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_into<16, detail::impl_x_utf16to8, UTF16, UTF8, detail::impl_utf16to8>(source, dst, size, &state, false);
 }
-inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source, una::error& error)
+template<typename UTF8, typename UTF32>
+uaiw_constexpr conv_result utf8to32_into(std::basic_string_view<UTF8> source, UTF32* dst, std::size_t size)
 {
-    return utf32to16<char32_t, char16_t>(source, error);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<8, detail::impl_x_utf8to32, UTF8, UTF32, detail::impl_utf8to32>(source, dst, size, nullptr, false);
 }
+template<typename UTF8, typename UTF32>
+uaiw_constexpr conv_result utf8to32_into(std::basic_string_view<UTF8> source, UTF32* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
-inline uaiw_constexpr std::wstring utf8to16(std::string_view source, una::error& error)
+    return detail::t_utf_into<8, detail::impl_x_utf8to32, UTF8, UTF32, detail::impl_utf8to32>(source, dst, size, &state, false);
+}
+template<typename UTF32, typename UTF8>
+uaiw_constexpr conv_result utf32to8_into(std::basic_string_view<UTF32> source, UTF8* dst, std::size_t size)
 {
-    return utf8to16<char, wchar_t>(source, error);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<32, detail::impl_x_utf32to8, UTF32, UTF8, detail::impl_utf32to8>(source, dst, size, nullptr, false);
 }
-inline uaiw_constexpr std::string utf16to8(std::wstring_view source, una::error& error)
+template<typename UTF32, typename UTF8>
+uaiw_constexpr conv_result utf32to8_into(std::basic_string_view<UTF32> source, UTF8* dst, std::size_t size, conv_state& state)
 {
-    return utf16to8<wchar_t, char>(source, error);
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<32, detail::impl_x_utf32to8, UTF32, UTF8, detail::impl_utf32to8>(source, dst, size, &state, false);
 }
-inline uaiw_constexpr std::u32string utf16to32u(std::wstring_view source, una::error& error)
+template<typename UTF16, typename UTF32>
+uaiw_constexpr conv_result utf16to32_into(std::basic_string_view<UTF16> source, UTF32* dst, std::size_t size)
 {
-    return utf16to32<wchar_t, char32_t>(source, error);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<16, detail::impl_x_utf16to32, UTF16, UTF32, detail::impl_utf16to32>(source, dst, size, nullptr, false);
 }
-inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source, una::error& error)
+template<typename UTF16, typename UTF32>
+uaiw_constexpr conv_result utf16to32_into(std::basic_string_view<UTF16> source, UTF32* dst, std::size_t size, conv_state& state)
 {
-    return utf32to16<char32_t, wchar_t>(source, error);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<16, detail::impl_x_utf16to32, UTF16, UTF32, detail::impl_utf16to32>(source, dst, size, &state, false);
 }
-#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
-inline uaiw_constexpr std::wstring utf8to32(std::string_view source, una::error& error)
+template<typename UTF32, typename UTF16>
+uaiw_constexpr conv_result utf32to16_into(std::basic_string_view<UTF32> source, UTF16* dst, std::size_t size)
 {
-    return utf8to32<char, wchar_t>(source, error);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<32, detail::impl_x_utf32to16, UTF32, UTF16, detail::impl_utf32to16>(source, dst, size, nullptr, false);
 }
-inline uaiw_constexpr std::string utf32to8(std::wstring_view source, una::error& error)
+template<typename UTF32, typename UTF16>
+uaiw_constexpr conv_result utf32to16_into(std::basic_string_view<UTF32> source, UTF16* dst, std::size_t size, conv_state& state)
 {
-    return utf32to8<wchar_t, char>(source, error);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<32, detail::impl_x_utf32to16, UTF32, UTF16, detail::impl_utf32to16>(source, dst, size, &state, false);
 }
-inline uaiw_constexpr std::wstring utf16to32(std::u16string_view source, una::error& error)
+
+#ifdef __cpp_lib_span
+
+inline uaiw_constexpr conv_result utf8to16_into(std::string_view source, std::span<char16_t> dst)
 {
-    return utf16to32<char16_t, wchar_t>(source, error);
+    return utf8to16_into<char, char16_t>(source, dst.data(), dst.size());
 }
-inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source, una::error& error)
+inline uaiw_constexpr conv_result utf8to16_into(std::string_view source, std::span<char16_t> dst, conv_state& state)
 {
-    return utf32to16<wchar_t, char16_t>(source, error);
+    return utf8to16_into<char, char16_t>(source, dst.data(), dst.size(), state);
+}
+inline uaiw_constexpr conv_result utf16to8_into(std::u16string_view source, std::span<char> dst)
+{
+    return utf16to8_into<char16_t, char>(source, dst.data(), dst.size());
+}
+inline uaiw_constexpr conv_result utf16to8_into(std::u16string_view source, std::span<char> dst, conv_state& state)
+{
+    return utf16to8_into<char16_t, char>(source, dst.data(), dst.size(), state);
+}
+inline uaiw_constexpr conv_result utf8to32_into(std::string_view source, std::span<char32_t> dst)
+{
+    return utf8to32_into<char, char32_t>(source, dst.data(), dst.size());
+}
+inline uaiw_constexpr conv_result utf8to32_into(std::string_view source, std::span<char32_t> dst, conv_state& state)
+{
+    return utf8to32_into<char, char32_t>(source, dst.data(), dst.size(), state);
+}
+inline uaiw_constexpr conv_result utf32to8_into(std::u32string_view source, std::span<char> dst)
+{
+    return utf32to8_into<char32_t, char>(source, dst.data(), dst.size());
+}
+inline uaiw_constexpr conv_result utf32to8_into(std::u32string_view source, std::span<char> dst, conv_state& state)
+{
+    return utf32to8_into<char32_t, char>(source, dst.data(), dst.size(), state);
+}
+inline uaiw_constexpr conv_result utf16to32_into(std::u16string_view source, std::span<char32_t> dst)
+{
+    return utf16to32_into<char16_t, char32_t>(source, dst.data(), dst.size());
+}
+inline uaiw_constexpr conv_result utf16to32_into(std::u16string_view source, std::span<char32_t> dst, conv_state& state)
+{
+    return utf16to32_into<char16_t, char32_t>(source, dst.data(), dst.size(), state);
+}
+inline uaiw_constexpr conv_result utf32to16_into(std::u32string_view source, std::span<char16_t> dst)
+{
+    return utf32to16_into<char32_t, char16_t>(source, dst.data(), dst.size());
+}
+inline uaiw_constexpr conv_result utf32to16_into(std::u32string_view source, std::span<char16_t> dst, conv_state& state)
+{
+    return utf32to16_into<char32_t, char16_t>(source, dst.data(), dst.size(), state);
 }
-#endif // WCHAR_MAX >= 0x7FFFFFFF
 
-} // namespace strict
+#endif // __cpp_lib_span
 
-template<typename UTF8>
-uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source)
+namespace strict {
+
+// In strict functions conv_result::read and conv_result::error.pos() point to the ill-formed sequence
+// and the buffer contains the result up to the ill-formed sequence.
+
+template<typename UTF8, typename UTF16>
+uaiw_constexpr conv_result utf8to16_into(std::basic_string_view<UTF8> source, UTF16* dst, std::size_t size)
 {
     static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_valid<std::basic_string_view<UTF8>, detail::impl_is_valid_utf8>(source);
+    return detail::t_utf_into<8, detail::impl_x_utf8to16, UTF8, UTF16, detail::impl_utf8to16>(source, dst, size, nullptr, true);
 }
+template<typename UTF8, typename UTF16>
+uaiw_constexpr conv_result utf8to16_into(std::basic_string_view<UTF8> source, UTF16* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-template<typename UTF16>
-uaiw_constexpr bool is_valid_utf16(std::basic_string_view<UTF16> source)
+    return detail::t_utf_into<8, detail::impl_x_utf8to16, UTF8, UTF16, detail::impl_utf8to16>(source, dst, size, &state, true);
+}
+template<typename UTF16, typename UTF8>
+uaiw_constexpr conv_result utf16to8_into(std::basic_string_view<UTF16> source, UTF8* dst, std::size_t size)
 {
+    static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_valid<std::basic_string_view<UTF16>, detail::impl_is_valid_utf16>(source);
+    return detail::t_utf_into<16, detail::impl_x_utf16to8, UTF16, UTF8, detail::impl_utf16to8>(source, dst, size, nullptr, true);
 }
+template<typename UTF16, typename UTF8>
+uaiw_constexpr conv_result utf16to8_into(std::basic_string_view<UTF16> source, UTF8* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-template<typename UTF32>
-uaiw_constexpr bool is_valid_utf32(std::basic_string_view<UTF32> source)
+    return detail::t_utf_into<16, detail::impl_x_utf16to8, UTF16, UTF8, detail::impl_utf16to8>(source, dst, size, &state, true);
+}
+template<typename UTF8, typename UTF32>
+uaiw_constexpr conv_result utf8to32_into(std::basic_string_view<UTF8> source, UTF32* dst, std::size_t size)
 {
+    static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_valid<std::basic_string_view<UTF32>, detail::impl_is_valid_utf32>(source);
+    return detail::t_utf_into<8, detail::impl_x_utf8to32, UTF8, UTF32, detail::impl_utf8to32>(source, dst, size, nullptr, true);
 }
+template<typename UTF8, typename UTF32>
+uaiw_constexpr conv_result utf8to32_into(std::basic_string_view<UTF8> source, UTF32* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-template<typename UTF8>
-uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source, una::error& error)
+    return detail::t_utf_into<8, detail::impl_x_utf8to32, UTF8, UTF32, detail::impl_utf8to32>(source, dst, size, &state, true);
+}
+template<typename UTF32, typename UTF8>
+uaiw_constexpr conv_result utf32to8_into(std::basic_string_view<UTF32> source, UTF8* dst, std::size_t size)
 {
     static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_valid<std::basic_string_view<UTF8>, detail::impl_is_valid_utf8>(source, error);
+    return detail::t_utf_into<32, detail::impl_x_utf32to8, UTF32, UTF8, detail::impl_utf32to8>(source, dst, size, nullptr, true);
 }
+template<typename UTF32, typename UTF8>
+uaiw_constexpr conv_result utf32to8_into(std::basic_string_view<UTF32> source, UTF8* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-template<typename UTF16>
-uaiw_constexpr bool is_valid_utf16(std::basic_string_view<UTF16> source, una::error& error)
+    return detail::t_utf_into<32, detail::impl_x_utf32to8, UTF32, UTF8, detail::impl_utf32to8>(source, dst, size, &state, true);
+}
+template<typename UTF16, typename UTF32>
+uaiw_constexpr conv_result utf16to32_into(std::basic_string_view<UTF16> source, UTF32* dst, std::size_t size)
 {
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_valid<std::basic_string_view<UTF16>, detail::impl_is_valid_utf16>(source, error);
+    return detail::t_utf_into<16, detail::impl_x_utf16to32, UTF16, UTF32, detail::impl_utf16to32>(source, dst, size, nullptr, true);
 }
+template<typename UTF16, typename UTF32>
+uaiw_constexpr conv_result utf16to32_into(std::basic_string_view<UTF16> source, UTF32* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-template<typename UTF32>
-uaiw_constexpr bool is_valid_utf32(std::basic_string_view<UTF32> source, una::error& error)
+    return detail::t_utf_into<16, detail::impl_x_utf16to32, UTF16, UTF32, detail::impl_utf16to32>(source, dst, size, &state, true);
+}
+template<typename UTF32, typename UTF16>
+uaiw_constexpr conv_result utf32to16_into(std::basic_string_view<UTF32> source, UTF16* dst, std::size_t size)
 {
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_valid<std::basic_string_view<UTF32>, detail::impl_is_valid_utf32>(source, error);
+    return detail::t_utf_into<32, detail::impl_x_utf32to16, UTF32, UTF16, detail::impl_utf32to16>(source, dst, size, nullptr, true);
+}
+template<typename UTF32, typename UTF16>
+uaiw_constexpr conv_result utf32to16_into(std::basic_string_view<UTF32> source, UTF16* dst, std::size_t size, conv_state& state)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_into<32, detail::impl_x_utf32to16, UTF32, UTF16, detail::impl_utf32to16>(source, dst, size, &state, true);
 }
 
-inline uaiw_constexpr bool is_valid_utf8(std::string_view source)
+#ifdef __cpp_lib_span
+
+inline uaiw_constexpr conv_result utf8to16_into(std::string_view source, std::span<char16_t> dst)
 {
-    return is_valid_utf8<char>(source);
+    return strict::utf8to16_into<char, char16_t>(source, dst.data(), dst.size());
 }
-inline uaiw_constexpr bool is_valid_utf16(std::u16string_view source)
+inline uaiw_constexpr conv_result utf8to16_into(std::string_view source, std::span<char16_t> dst, conv_state& state)
 {
-    return is_valid_utf16<char16_t>(source);
+    return strict::utf8to16_into<char, char16_t>(source, dst.data(), dst.size(), state);
 }
-inline uaiw_constexpr bool is_valid_utf32(std::u32string_view source)
+inline uaiw_constexpr conv_result utf16to8_into(std::u16string_view source, std::span<char> dst)
 {
-    return is_valid_utf32<char32_t>(source);
+    return strict::utf16to8_into<char16_t, char>(source, dst.data(), dst.size());
 }
-inline uaiw_constexpr bool is_valid_utf8(std::string_view source, una::error& error)
+inline uaiw_constexpr conv_result utf16to8_into(std::u16string_view source, std::span<char> dst, conv_state& state)
 {
-    return is_valid_utf8<char>(source, error);
+    return strict::utf16to8_into<char16_t, char>(source, dst.data(), dst.size(), state);
 }
-inline uaiw_constexpr bool is_valid_utf16(std::u16string_view source, una::error& error)
+inline uaiw_constexpr conv_result utf8to32_into(std::string_view source, std::span<char32_t> dst)
 {
-    return is_valid_utf16<char16_t>(source, error);
+    return strict::utf8to32_into<char, char32_t>(source, dst.data(), dst.size());
 }
-inline uaiw_constexpr bool is_valid_utf32(std::u32string_view source, una::error& error)
+inline uaiw_constexpr conv_result utf8to32_into(std::string_view source, std::span<char32_t> dst, conv_state& state)
 {
-    return is_valid_utf32<char32_t>(source, error);
+    return strict::utf8to32_into<char, char32_t>(source, dst.data(), dst.size(), state);
 }
-#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
-inline uaiw_constexpr bool is_valid_utf16(std::wstring_view source)
+inline uaiw_constexpr conv_result utf32to8_into(std::u32string_view source, std::span<char> dst)
 {
-    return is_valid_utf16<wchar_t>(source);
+    return strict::utf32to8_into<char32_t, char>(source, dst.data(), dst.size());
 }
-inline uaiw_constexpr bool is_valid_utf16(std::wstring_view source, una::error& error)
+inline uaiw_constexpr conv_result utf32to8_into(std::u32string_view source, std::span<char> dst, conv_state& state)
 {
-    return is_valid_utf16<wchar_t>(source, error);
+    return strict::utf32to8_into<char32_t, char>(source, dst.data(), dst.size(), state);
 }
-#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
-inline uaiw_constexpr bool is_valid_utf32(std::wstring_view source)
+inline uaiw_constexpr conv_result utf16to32_into(std::u16string_view source, std::span<char32_t> dst)
 {
-    return is_valid_utf32<wchar_t>(source);
+    return strict::utf16to32_into<char16_t, char32_t>(source, dst.data(), dst.size());
 }
-inline uaiw_constexpr bool is_valid_utf32(std::wstring_view source, una::error& error)
+inline uaiw_constexpr conv_result utf16to32_into(std::u16string_view source, std::span<char32_t> dst, conv_state& state)
 {
-    return is_valid_utf32<wchar_t>(source, error);
+    return strict::utf16to32_into<char16_t, char32_t>(source, dst.data(), dst.size(), state);
 }
-#endif // WCHAR_MAX >= 0x7FFFFFFF
+inline uaiw_constexpr conv_result utf32to16_into(std::u32string_view source, std::span<char16_t> dst)
+{
+    return strict::utf32to16_into<char32_t, char16_t>(source, dst.data(), dst.size());
+}
+inline uaiw_constexpr conv_result utf32to16_into(std::u32string_view source, std::span<char16_t> dst, conv_state& state)
+{
+    return strict::utf32to16_into<char32_t, char16_t>(source, dst.data(), dst.size(), state);
+}
+
+#endif // __cpp_lib_span
+
+} // namespace strict
+
+// Converter for the input that comes by parts (chunks) for example from a socket or a file.
+// An incomplete sequence at the end of a chunk is kept (up to 3 code units) and completed by the next chunk
+// so the result is always the same as the result of the conversion of the whole input.
+// The encoding is deduced from the size of the types: 1 - UTF-8, 2 - UTF-16, 4 - UTF-32
+// Example: una::stream_converter<char, char16_t> converter;
+// for (...) converter.convert(chunk, result); converter.finish(result);
+
+template<typename From, typename To>
+class stream_converter
+{
+    static_assert(std::is_integral_v<From> && std::is_integral_v<To>);
+    static_assert(sizeof(From) == 1 || sizeof(From) == 2 || sizeof(From) == 4);
+    static_assert(sizeof(To) == 1 || sizeof(To) == 2 || sizeof(To) == 4);
+    static_assert(sizeof(From) != sizeof(To));
+
+private:
+    static constexpr std::size_t size_x = (sizeof(From) == 1) ? 1 : (sizeof(From) == 2) ? ((sizeof(To) == 1) ? 3 : 1) :
+                                          ((sizeof(To) == 1) ? 4 : 2);
+
+    conv_state state;
+
+    uaiw_constexpr conv_result into(std::basic_string_view<From> source, To* dst, std::size_t size)
+    {
+        if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+            return utf8to16_into<From, To>(source, dst, size, state);
+        else if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+            return utf16to8_into<From, To>(source, dst, size, state);
+        else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+            return utf8to32_into<From, To>(source, dst, size, state);
+        else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+            return utf32to8_into<From, To>(source, dst, size, state);
+        else if constexpr (sizeof(From) == 2 && sizeof(To) == 4)
+            return utf16to32_into<From, To>(source, dst, size, state);
+        else
+            return utf32to16_into<From, To>(source, dst, size, state);
+    }
+    template<typename Alloc>
+    uaiw_constexpr void append(std::basic_string_view<From> source, std::basic_string<To, std::char_traits<To>, Alloc>& dst)
+    {
+        // Up to 3 code units from the previous chunk + the chunk
+        const std::size_t length = source.size() + 3;
+
+        if (length > (dst.max_size() - dst.size()) / size_x) // Overflow protection
+        {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+
+        const std::size_t pos = dst.size();
+        dst.resize(pos + length * size_x);
+        dst.resize(pos + into(source, dst.data() + pos, length * size_x).written);
+    }
+
+public:
+    uaiw_constexpr stream_converter() noexcept = default;
+
+    // Convert the chunk and append the result to dst
+    template<typename Alloc>
+    uaiw_constexpr void convert(std::basic_string_view<From> chunk, std::basic_string<To, std::char_traits<To>, Alloc>& dst)
+    {
+        if (!chunk.empty())
+            append(chunk, dst);
+    }
+    // Must be called at the end of the input, an incomplete sequence is converted to U+FFFD
+    template<typename Alloc>
+    uaiw_constexpr void finish(std::basic_string<To, std::char_traits<To>, Alloc>& dst)
+    {
+        if (!state.empty())
+            append(std::basic_string_view<From>{}, dst);
+    }
+    // Check if an incomplete sequence from the previous chunk is waiting for the next chunk
+    uaiw_constexpr bool pending() const noexcept { return !state.empty(); }
+    // Drop an incomplete sequence and start over
+    uaiw_constexpr void reset() noexcept { state.reset(); }
+};
+
+// Decode the bytes of a text in an unknown Unicode encoding (for example the content of a file),
+// UTF-8, UTF-16LE/BE and UTF-32LE/BE are detected by BOM or if there is no BOM heuristically
+// by NUL bytes at the beginning of the text (see t_decode_detect), BOM is not included in the result.
+// The result is the same as the result of the lenient conversion from the detected encoding
+// and UTF-8 without BOM is only validated and copied if it is valid.
+
+inline uaiw_constexpr std::string decode_auto(std::string_view source)
+{
+    const detail::decode_detected detected = detail::t_decode_detect(source);
+    source.remove_prefix(detected.bom);
+
+    switch (detected.encoding)
+    {
+    case detail::decode_as::utf16le: return utf16le_bytes_to8(source);
+    case detail::decode_as::utf16be: return utf16be_bytes_to8(source);
+    case detail::decode_as::utf32le: return utf32le_bytes_to8(source);
+    case detail::decode_as::utf32be: return utf32be_bytes_to8(source);
+    case detail::decode_as::utf8: break;
+    }
+
+    std::string result{source};
+    sanitize_utf8(result);
+    return result;
+}
+inline uaiw_constexpr std::u16string decode_auto_utf16(std::string_view source)
+{
+    const detail::decode_detected detected = detail::t_decode_detect(source);
+    source.remove_prefix(detected.bom);
+
+    // UTF-16 and UTF-32 bytes are decoded to UTF-16 directly without UTF-8 in the middle
+    using alloc_t = std::allocator<char16_t>;
+
+    switch (detected.encoding)
+    {
+    case detail::decode_as::utf16le:
+        return detail::t_utf<std::u16string, alloc_t, std::string_view,
+                detail::impl_x_utf16bytes_to16, detail::impl_utf16le_to16>(alloc_t{}, source);
+    case detail::decode_as::utf16be:
+        return detail::t_utf<std::u16string, alloc_t, std::string_view,
+                detail::impl_x_utf16bytes_to16, detail::impl_utf16be_to16>(alloc_t{}, source);
+    case detail::decode_as::utf32le:
+        return detail::t_utf<std::u16string, alloc_t, std::string_view,
+                detail::impl_x_utf32bytes_to16, detail::impl_utf32le_to16>(alloc_t{}, source);
+    case detail::decode_as::utf32be:
+        return detail::t_utf<std::u16string, alloc_t, std::string_view,
+                detail::impl_x_utf32bytes_to16, detail::impl_utf32be_to16>(alloc_t{}, source);
+    case detail::decode_as::utf8: break;
+    }
 
+    return utf8to16u(source);
+}
 
 #ifdef __cpp_lib_char8_t
 
@@ -553,6 +2436,27 @@ inline uaiw_constexpr std::u8string utf32to8u(std::u32string_view source)
     return utf32to8<char32_t, char8_t>(source);
 }
 
+template<char32_t Policy>
+uaiw_constexpr std::u16string utf8to16u(std::u8string_view source)
+{
+    return utf8to16<Policy, char8_t, char16_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u8string utf16to8u(std::u16string_view source)
+{
+    return utf16to8<Policy, char16_t, char8_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u32string utf8to32u(std::u8string_view source)
+{
+    return utf8to32<Policy, char8_t, char32_t>(source);
+}
+template<char32_t Policy>
+uaiw_constexpr std::u8string utf32to8u(std::u32string_view source)
+{
+    return utf32to8<Policy, char32_t, char8_t>(source);
+}
+
 inline uaiw_constexpr bool is_valid_utf8(std::u8string_view source)
 {
     return is_valid_utf8<char8_t>(source);
@@ -562,6 +2466,15 @@ inline uaiw_constexpr bool is_valid_utf8(std::u8string_view source, una::error&
     return is_valid_utf8<char8_t>(source, error);
 }
 
+inline uaiw_constexpr std::size_t utf16_length_from_utf8(std::u8string_view source)
+{
+    return utf16_length_from_utf8<char8_t>(source);
+}
+inline uaiw_constexpr std::size_t count_codepoints_utf8(std::u8string_view source)
+{
+    return count_codepoints_utf8<char8_t>(source);
+}
+
 #if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
 inline uaiw_constexpr std::wstring utf8to16(std::u8string_view source)
 {
@@ -582,6 +2495,23 @@ inline uaiw_constexpr std::u8string utf32to8u(std::wstring_view source)
 }
 #endif // WCHAR_MAX >= 0x7FFFFFFF
 
+inline uaiw_constexpr std::u8string utf16be_bytes_to8u(std::string_view source)
+{
+    return utf16be_bytes_to8<char, char8_t>(source);
+}
+inline uaiw_constexpr std::u8string utf16le_bytes_to8u(std::string_view source)
+{
+    return utf16le_bytes_to8<char, char8_t>(source);
+}
+inline uaiw_constexpr std::u8string utf32be_bytes_to8u(std::string_view source)
+{
+    return utf32be_bytes_to8<char, char8_t>(source);
+}
+inline uaiw_constexpr std::u8string utf32le_bytes_to8u(std::string_view source)
+{
+    return utf32le_bytes_to8<char, char8_t>(source);
+}
+
 namespace strict {
 
 inline uaiw_constexpr std::u16string utf8to16u(std::u8string_view source, una::error& error)
@@ -621,8 +2551,50 @@ inline uaiw_constexpr std::u8string utf32to8u(std::wstring_view source, una::err
 }
 #endif // WCHAR_MAX >= 0x7FFFFFFF
 
+inline uaiw_constexpr std::u8string utf16be_bytes_to8u(std::string_view source, una::error& error)
+{
+    return utf16be_bytes_to8<char, char8_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf16le_bytes_to8u(std::string_view source, una::error& error)
+{
+    return utf16le_bytes_to8<char, char8_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf32be_bytes_to8u(std::string_view source, una::error& error)
+{
+    return utf32be_bytes_to8<char, char8_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf32le_bytes_to8u(std::string_view source, una::error& error)
+{
+    return utf32le_bytes_to8<char, char8_t>(source, error);
+}
+
 } // namespace strict
 
+namespace exact {
+
+inline uaiw_constexpr std::u8string utf16to8u(std::u16string_view source)
+{
+    return utf16to8<char16_t, char8_t>(source);
+}
+inline uaiw_constexpr std::u8string utf32to8u(std::u32string_view source)
+{
+    return utf32to8<char32_t, char8_t>(source);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::u8string utf16to8u(std::wstring_view source)
+{
+    return utf16to8<wchar_t, char8_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::u8string utf32to8u(std::wstring_view source)
+{
+    return utf32to8<wchar_t, char8_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+} // namespace exact
+
 #endif // __cpp_lib_char8_t
 
 } // namespace una
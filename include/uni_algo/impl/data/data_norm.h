@@ -11265,6 +11265,4166 @@ uaix_const_data uaix_data_array(type_codept, stage3_decomp_nfkd, 14970) = {
 1,40709,1,40719,1,40726,1,40763,
 1,173568};
 
+uaix_const_data uaix_data_array(unsigned char, stage1_nfkc_cf, 8704) = {
+0,1,2,3,4,5,6,7,
+8,9,10,11,12,13,13,13,
+13,13,14,15,16,13,17,13,
+13,13,13,13,18,19,20,21,
+13,22,23,13,13,13,13,24,
+13,13,13,13,13,13,13,25,
+26,13,13,13,13,13,13,13,
+13,27,28,29,30,31,32,33,
+34,35,36,37,38,13,39,13,
+40,41,13,13,13,13,13,13,
+13,13,13,13,42,43,13,13,
+44,45,46,13,13,47,48,49,
+50,51,52,53,54,55,56,57,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,58,59,60,61,
+13,13,13,13,13,13,62,63,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,64,65,66,67,68,69,
+70,71,72,73,74,75,76,77,
+13,13,13,13,13,13,13,13,
+78,79,80,81,13,13,13,82,
+13,13,13,13,13,13,13,13,
+13,83,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,84,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,85,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,86,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,87,88,13,13,13,13,
+89,90,91,92,93,94,95,96,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+97,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,98,13,13,13,13,13,
+13,13,13,13,99,100,13,13,
+13,13,101,102,103,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,104,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+105,106,107,108,109,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+110,110,110,110,110,110,110,110,
+110,110,110,110,110,110,110,110,
+110,110,110,110,110,110,110,110,
+110,110,110,110,110,110,110,110,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13};
+
+uaix_const_data uaix_data_array(unsigned short, stage2_nfkc_cf, 14208) = {
+/* Block: 0 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,1,3,5,7,9,11,13,
+15,17,19,21,23,25,27,29,
+31,33,35,37,39,41,43,45,
+47,49,51,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 1 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+53,0,0,0,0,0,0,0,
+55,0,1,0,0,58,0,59,
+0,0,62,64,66,69,0,0,
+71,74,29,0,76,80,84,0,
+88,90,92,94,96,98,100,102,
+104,106,108,110,112,114,116,118,
+120,122,124,126,128,130,132,0,
+134,136,138,140,142,144,146,148,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 2 */
+151,0,153,0,155,0,157,0,
+159,0,161,0,163,0,165,0,
+167,0,169,0,171,0,173,0,
+175,0,177,0,179,0,181,0,
+183,0,185,0,187,0,189,0,
+191,0,193,0,195,0,197,0,
+199,0,202,202,205,0,207,0,
+0,209,0,211,0,213,0,215,
+215,218,0,220,0,222,0,224,
+0,226,229,0,231,0,233,0,
+235,0,237,0,239,0,241,0,
+243,0,245,0,247,0,249,0,
+251,0,253,0,255,0,257,0,
+259,0,261,0,263,0,265,0,
+267,0,269,0,271,0,273,0,
+275,277,0,279,0,281,0,37,
+/* Block: 3 */
+0,283,285,0,287,0,289,291,
+0,293,295,297,0,0,299,301,
+303,305,0,307,309,0,311,313,
+315,0,0,0,317,319,0,321,
+323,0,325,0,327,0,329,331,
+0,333,0,0,335,0,337,339,
+0,341,343,345,0,347,0,349,
+351,0,0,0,353,0,0,0,
+0,0,0,0,355,355,355,358,
+358,358,361,361,361,364,0,366,
+0,368,0,370,0,372,0,374,
+0,376,0,378,0,0,380,0,
+382,0,384,0,386,0,388,0,
+390,0,392,0,394,0,396,0,
+0,398,398,398,401,0,403,405,
+407,0,409,0,411,0,413,0,
+/* Block: 4 */
+415,0,417,0,419,0,421,0,
+423,0,425,0,427,0,429,0,
+431,0,433,0,435,0,437,0,
+439,0,441,0,443,0,445,0,
+447,0,449,0,451,0,453,0,
+455,0,457,0,459,0,461,0,
+463,0,465,0,0,0,0,0,
+0,0,467,469,0,471,473,0,
+0,475,0,477,479,481,483,0,
+485,0,487,0,489,0,491,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 5 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+15,493,19,35,495,497,499,45,
+49,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+501,504,507,510,513,516,0,0,
+309,23,37,47,519,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 6 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+521,523,0,525,527,530,0,0,
+0,0,0,0,0,0,0,58,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+532,0,534,0,536,0,538,0,
+0,0,540,0,0,0,543,545,
+/* Block: 7 */
+0,0,0,0,66,547,551,553,
+555,557,559,0,561,0,563,565,
+0,567,569,571,573,575,577,579,
+581,530,583,585,69,587,589,591,
+593,595,0,597,599,601,603,605,
+607,609,611,613,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,597,0,0,0,0,0,
+0,0,0,0,0,0,0,615,
+569,581,601,563,613,603,593,0,
+617,0,619,0,621,0,623,0,
+625,0,627,0,629,0,631,0,
+633,0,635,0,637,0,639,0,
+583,595,597,0,581,575,0,641,
+0,597,643,0,0,645,647,649,
+/* Block: 8 */
+651,653,655,657,659,661,663,665,
+667,669,671,673,675,677,679,681,
+683,685,687,689,691,693,695,697,
+699,701,703,705,707,709,711,713,
+715,717,719,721,723,725,727,729,
+731,733,735,737,739,741,743,745,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+747,0,749,0,751,0,753,0,
+755,0,757,0,759,0,761,0,
+763,0,765,0,767,0,769,0,
+771,0,773,0,775,0,777,0,
+/* Block: 9 */
+779,0,0,0,0,0,0,0,
+0,0,781,0,783,0,785,0,
+787,0,789,0,791,0,793,0,
+795,0,797,0,799,0,801,0,
+803,0,805,0,807,0,809,0,
+811,0,813,0,815,0,817,0,
+819,0,821,0,823,0,825,0,
+827,0,829,0,831,0,833,0,
+835,837,0,839,0,841,0,843,
+0,845,0,847,0,849,0,0,
+851,0,853,0,855,0,857,0,
+859,0,861,0,863,0,865,0,
+867,0,869,0,871,0,873,0,
+875,0,877,0,879,0,881,0,
+883,0,885,0,887,0,889,0,
+891,0,893,0,895,0,897,0,
+/* Block: 10 */
+899,0,901,0,903,0,905,0,
+907,0,909,0,911,0,913,0,
+915,0,917,0,919,0,921,0,
+923,0,925,0,927,0,929,0,
+931,0,933,0,935,0,937,0,
+939,0,941,0,943,0,945,0,
+0,947,949,951,953,955,957,959,
+961,963,965,967,969,971,973,975,
+977,979,981,983,985,987,989,991,
+993,995,997,999,1001,1003,1005,1007,
+1009,1011,1013,1015,1017,1019,1021,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 11 */
+0,0,0,0,0,0,0,1023,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 12 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,58,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,1026,1029,1032,
+1035,0,0,0,0,0,0,0,
+/* Block: 13 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 14 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1038,1041,1044,1047,1050,1053,1056,1059,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 15 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1062,1065,0,1068,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 16 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1071,0,0,1074,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,1077,1080,1083,0,0,1086,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 17 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1089,1092,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 18 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1095,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 19 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1098,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1101,1104,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 20 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,1107,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1109,0,0,0,0,
+0,0,0,0,0,1112,0,0,
+0,0,1115,0,0,0,0,1118,
+0,0,0,0,1121,0,0,0,
+0,0,0,0,0,0,0,0,
+0,1124,0,0,0,0,0,0,
+0,0,0,1127,0,1130,1133,1136,
+1140,1143,0,0,0,0,0,0,
+/* Block: 21 */
+0,1147,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1150,0,0,0,0,
+0,0,0,0,0,1153,0,0,
+0,0,1156,0,0,0,0,1159,
+0,0,0,0,1162,0,0,0,
+0,0,0,0,0,0,0,0,
+0,1165,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 22 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1168,1170,1172,1174,1176,1178,1180,1182,
+1184,1186,1188,1190,1192,1194,1196,1198,
+1200,1202,1204,1206,1208,1210,1212,1214,
+1216,1218,1220,1222,1224,1226,1228,1230,
+1232,1234,1236,1238,1240,1242,0,1244,
+0,0,0,0,0,1246,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1248,0,0,0,
+/* Block: 23 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,58,
+58,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 24 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1250,1252,1254,1256,1258,1260,0,0,
+/* Block: 25 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,58,58,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 26 */
+0,0,0,0,0,0,0,0,
+0,0,0,58,58,58,58,58,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 27 */
+687,691,711,717,719,719,735,749,
+1262,0,0,0,0,0,0,0,
+1264,1266,1268,1270,1272,1274,1276,1278,
+1280,1282,1284,1286,1248,1288,1290,1292,
+1294,1296,1298,1300,1302,1304,1306,1308,
+1310,1312,1314,1316,1318,1320,1322,1324,
+1326,1328,1330,1332,1334,1336,1338,1340,
+1342,1344,1346,0,0,1348,1350,1352,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 28 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1,100,3,0,
+7,9,299,13,15,17,19,21,
+23,25,27,0,29,449,31,35,
+39,41,45,1,1354,1356,1358,3,
+7,9,301,303,1360,13,0,21,
+25,229,29,289,1362,1364,31,39,
+41,1366,317,43,1368,569,571,573,
+603,605,17,35,41,43,569,571,
+595,603,605,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+709,0,0,0,0,0,0,0,
+/* Block: 29 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1370,5,1372,120,1360,
+11,1374,1376,1378,313,311,1380,1382,
+1384,1386,1388,1390,1392,1394,319,1396,
+1398,321,1400,1402,333,1404,479,341,
+1406,343,481,51,1408,1410,349,581,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 30 */
+1412,0,1414,0,1416,0,1418,0,
+1420,0,1422,0,1424,0,1426,0,
+1428,0,1430,0,1432,0,1434,0,
+1436,0,1438,0,1440,0,1442,0,
+1444,0,1446,0,1448,0,1450,0,
+1452,0,1454,0,1456,0,1458,0,
+1460,0,1462,0,1464,0,1466,0,
+1468,0,1470,0,1472,0,1474,0,
+1476,0,1478,0,1480,0,1482,0,
+1484,0,1486,0,1488,0,1490,0,
+1492,0,1494,0,1496,0,1498,0,
+1500,0,1502,0,1504,0,1506,0,
+1508,0,1510,0,1512,0,1514,0,
+1516,0,1518,0,1520,0,1522,0,
+1524,0,1526,0,1528,0,1530,0,
+1532,0,1534,0,1536,0,1538,0,
+/* Block: 31 */
+1540,0,1542,0,1544,0,1546,0,
+1548,0,1550,0,1552,0,1554,0,
+1556,0,1558,0,1560,0,0,0,
+0,0,1562,1508,0,0,148,0,
+1565,0,1567,0,1569,0,1571,0,
+1573,0,1575,0,1577,0,1579,0,
+1581,0,1583,0,1585,0,1587,0,
+1589,0,1591,0,1593,0,1595,0,
+1597,0,1599,0,1601,0,1603,0,
+1605,0,1607,0,1609,0,1611,0,
+1613,0,1615,0,1617,0,1619,0,
+1621,0,1623,0,1625,0,1627,0,
+1629,0,1631,0,1633,0,1635,0,
+1637,0,1639,0,1641,0,1643,0,
+1645,0,1647,0,1649,0,1651,0,
+1653,0,1655,0,1657,0,1659,0,
+/* Block: 32 */
+0,0,0,0,0,0,0,0,
+1661,1663,1665,1667,1669,1671,1673,1675,
+0,0,0,0,0,0,0,0,
+1677,1679,1681,1683,1685,1687,0,0,
+0,0,0,0,0,0,0,0,
+1689,1691,1693,1695,1697,1699,1701,1703,
+0,0,0,0,0,0,0,0,
+1705,1707,1709,1711,1713,1715,1717,1719,
+0,0,0,0,0,0,0,0,
+1721,1723,1725,1727,1729,1731,0,0,
+0,0,0,0,0,0,0,0,
+0,1733,0,1735,0,1737,0,1739,
+0,0,0,0,0,0,0,0,
+1741,1743,1745,1747,1749,1751,1753,1755,
+0,551,0,555,0,557,0,559,
+0,561,0,563,0,565,0,0,
+/* Block: 33 */
+1757,1760,1763,1766,1769,1772,1775,1778,
+1757,1760,1763,1766,1769,1772,1775,1778,
+1781,1784,1787,1790,1793,1796,1799,1802,
+1781,1784,1787,1790,1793,1796,1799,1802,
+1805,1808,1811,1814,1817,1820,1823,1826,
+1805,1808,1811,1814,1817,1820,1823,1826,
+0,0,1829,1832,1835,0,0,1838,
+1841,1843,1845,551,1832,1847,530,1847,
+1850,1853,1857,1860,1863,0,0,1866,
+1869,555,1871,557,1860,1873,1877,1881,
+0,0,0,1885,0,0,0,0,
+1887,1889,1891,559,0,1893,1897,1901,
+0,0,0,1905,0,0,0,0,
+1907,1909,1911,563,1913,1915,547,1919,
+0,0,1921,1924,1927,0,0,1930,
+1933,561,1935,565,1924,66,1937,0,
+/* Block: 34 */
+53,53,53,53,53,53,53,53,
+53,53,53,58,58,58,58,58,
+0,1940,0,0,0,0,0,1942,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1945,1947,1950,0,
+0,0,58,58,58,58,58,53,
+0,0,0,1954,1957,0,1961,1964,
+0,0,0,0,1968,0,1971,0,
+0,0,0,0,0,0,0,1974,
+1977,1980,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1983,
+0,0,0,0,0,0,0,53,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+1988,17,0,0,1990,1992,1994,1996,
+1998,2000,2002,2004,2006,2008,2010,27,
+/* Block: 35 */
+1988,74,62,64,1990,1992,1994,1996,
+1998,2000,2002,2004,2006,2008,2010,0,
+1,9,29,47,301,15,21,23,
+25,27,31,37,39,0,0,0,
+0,0,0,0,0,0,0,0,
+2012,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 36 */
+2015,2019,5,2023,0,2026,2030,303,
+0,2034,13,15,15,15,15,189,
+17,17,23,23,0,27,2037,0,
+0,31,33,35,35,35,0,0,
+2040,2043,2047,0,51,0,609,0,
+51,0,21,98,3,5,0,9,
+9,11,2050,25,29,2052,2054,2056,
+2058,17,0,2060,593,571,571,593,
+2064,0,0,0,0,7,7,9,
+17,19,0,0,0,0,0,0,
+2066,2070,2074,2079,2083,2087,2091,2095,
+2099,2103,2107,2111,2115,2119,2123,2127,
+17,2130,2133,2137,43,2140,2143,2147,
+2152,47,2155,2158,23,5,7,25,
+17,2130,2133,2137,43,2140,2143,2147,
+2152,47,2155,2158,23,5,7,25,
+/* Block: 37 */
+0,0,0,2162,0,0,0,0,
+0,2164,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 38 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,2168,2171,0,2175,
+2178,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 39 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,2182,2184,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 40 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+74,62,64,1990,1992,1994,1996,1998,
+2000,2186,2189,2192,2195,2198,2201,2204,
+2207,2210,2213,2216,2219,2223,2227,2231,
+2235,2239,2243,2247,2251,2255,2260,2265,
+/* Block: 41 */
+2270,2275,2280,2285,2290,2295,2300,2305,
+2310,2313,2316,2319,2322,2325,2328,2331,
+2334,2337,2341,2345,2349,2353,2357,2361,
+2365,2369,2373,2377,2381,2385,2389,2393,
+2397,2401,2405,2409,2413,2417,2421,2425,
+2429,2433,2437,2441,2445,2449,2453,2457,
+2461,2465,2469,2473,2477,2481,1,3,
+5,7,9,11,13,15,17,19,
+21,23,25,27,29,31,33,35,
+37,39,41,43,45,47,49,51,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+49,51,1988,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 42 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,2485,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,2490,2494,2497,0,
+0,0,0,0,0,0,0,0,
+/* Block: 43 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,2501,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 44 */
+2504,2506,2508,2510,2512,2514,2516,2518,
+2520,2522,2524,2526,2528,2530,2532,2534,
+2536,2538,2540,2542,2544,2546,2548,2550,
+2552,2554,2556,2558,2560,2562,2564,2566,
+2568,2570,2572,2574,2576,2578,2580,2582,
+2584,2586,2588,2590,2592,2594,2596,2598,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+2600,0,2602,2604,2606,0,0,2608,
+0,2610,0,2612,0,1356,1392,1354,
+1370,0,2614,0,0,2616,0,0,
+0,0,0,0,19,43,2618,2620,
+/* Block: 45 */
+2622,0,2624,0,2626,0,2628,0,
+2630,0,2632,0,2634,0,2636,0,
+2638,0,2640,0,2642,0,2644,0,
+2646,0,2648,0,2650,0,2652,0,
+2654,0,2656,0,2658,0,2660,0,
+2662,0,2664,0,2666,0,2668,0,
+2670,0,2672,0,2674,0,2676,0,
+2678,0,2680,0,2682,0,2684,0,
+2686,0,2688,0,2690,0,2692,0,
+2694,0,2696,0,2698,0,2700,0,
+2702,0,2704,0,2706,0,2708,0,
+2710,0,2712,0,2714,0,2716,0,
+2718,0,2720,0,0,0,0,0,
+0,0,0,2722,0,2724,0,0,
+0,0,2726,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 46 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2728,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 47 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2730,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,2732,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 48 */
+2734,2736,2738,2740,2742,2744,2746,2748,
+2750,2752,2754,2756,2758,2760,2762,2764,
+2766,2768,2770,2772,2774,2776,2778,2780,
+2782,2784,2786,2788,2790,2792,2794,2796,
+2798,2800,2802,2804,2806,2808,2810,2812,
+2814,2816,2818,2820,2822,2824,2826,2828,
+2830,2832,2834,2836,2838,2840,2842,2844,
+2846,2848,2850,2852,2854,2856,2858,2860,
+2862,2864,2866,2868,2870,2872,2874,2876,
+2878,2880,2882,2884,2886,2888,2890,2892,
+2894,2896,2898,2900,2902,2904,2906,2908,
+2910,2912,2914,2916,2918,2920,2922,2924,
+2926,2928,2930,2932,2934,2936,2938,2940,
+2942,2944,2946,2948,2950,2952,2954,2956,
+2958,2960,2962,2964,2966,2968,2970,2972,
+2974,2976,2978,2980,2982,2984,2986,2988,
+/* Block: 49 */
+2990,2992,2994,2996,2998,3000,3002,3004,
+3006,3008,3010,3012,3014,3016,3018,3020,
+3022,3024,3026,3028,3030,3032,3034,3036,
+3038,3040,3042,3044,3046,3048,3050,3052,
+3054,3056,3058,3060,3062,3064,3066,3068,
+3070,3072,3074,3076,3078,3080,3082,3084,
+3086,3088,3090,3092,3094,3096,3098,3100,
+3102,3104,3106,3108,3110,3112,3114,3116,
+3118,3120,3122,3124,3126,3128,3130,3132,
+3134,3136,3138,3140,3142,3144,3146,3148,
+3150,3152,3154,3156,3158,3160,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 50 */
+53,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,3162,0,
+2780,3164,3166,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 51 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,3168,3171,0,0,3174,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3177,
+/* Block: 52 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,3180,3182,3184,3186,3188,3190,3192,
+3194,3196,3198,3200,3202,3204,3206,3208,
+3210,3212,3214,3216,3218,3220,3222,3224,
+3226,3228,3230,3232,3234,3236,3238,3240,
+3242,3244,3246,3248,3250,3252,3254,3256,
+3258,3260,3262,3264,3266,3268,3270,3272,
+3274,3276,3278,3280,58,3282,3284,3286,
+3288,3290,3292,3294,3296,3298,3300,3302,
+3304,3306,3308,3310,3312,3314,3316,3318,
+3320,3322,3324,3326,3328,3330,3332,3334,
+/* Block: 53 */
+3336,3338,3340,3342,3344,3346,3348,3350,
+3352,3354,3356,3358,3360,3362,3364,0,
+0,0,2734,2746,3366,3368,3370,3372,
+3374,3376,2742,3378,3380,3382,3384,2750,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 54 */
+3386,3390,3394,3398,3402,3406,3410,3414,
+3418,3422,3426,3430,3434,3438,3442,3446,
+3450,3454,3458,3462,3466,3470,3474,3478,
+3482,3486,3490,3494,3498,3502,3507,0,
+3512,3516,3520,3524,3528,3532,3536,3540,
+3544,3548,3552,3556,3560,3564,3568,3572,
+3576,3580,3584,3588,3592,3596,3600,3604,
+3608,3612,3616,3620,3624,3628,3632,3636,
+3640,3644,3648,3652,3656,3658,2866,3660,
+0,0,0,0,0,0,0,0,
+3662,3666,3669,3672,3675,3678,3681,3684,
+3687,3690,3693,3696,3699,3702,3705,3708,
+3180,3186,3192,3196,3212,3214,3220,3224,
+3226,3230,3232,3234,3236,3238,3711,3713,
+3715,3717,3719,3721,3723,3725,3727,3729,
+3731,3733,3735,3737,3739,3742,3745,0,
+/* Block: 55 */
+2734,2746,3366,3368,3747,3749,3751,2756,
+3753,2780,2880,2904,2902,2882,3066,2796,
+2876,3755,3757,3759,3761,3763,3765,3767,
+3769,3771,3773,2808,3775,3777,3779,3781,
+3783,3785,3787,3789,3370,3372,3374,3791,
+3793,3795,3797,3799,3801,3803,3805,3807,
+3809,3811,3814,3817,3820,3823,3826,3829,
+3832,3835,3838,3841,3844,3847,3850,3853,
+3856,3859,3862,3865,3868,3871,3874,3877,
+3880,3883,3887,3891,3895,3898,3902,3905,
+3909,3911,3913,3915,3917,3919,3921,3923,
+3925,3927,3929,3931,3933,3935,3937,3939,
+3941,3943,3945,3947,3949,3951,3953,3955,
+3957,3959,3961,3963,3965,3967,3969,3971,
+3973,3975,3977,3979,3981,3983,3985,3987,
+3989,3991,3993,3995,3997,3999,4001,4003,
+/* Block: 56 */
+4006,4011,4016,4021,4025,4030,4034,4038,
+4044,4049,4053,4057,4061,4066,4071,4075,
+4079,4082,4086,4091,4096,4099,4105,4112,
+4118,4122,4128,4134,4139,4143,4147,4151,
+4156,4162,4167,4171,4175,4179,4182,4185,
+4188,4191,4195,4199,4205,4209,4214,4220,
+4224,4227,4230,4236,4241,4247,4251,4257,
+4260,4264,4268,4272,4276,4280,4285,4289,
+4292,4296,4300,4304,4309,4313,4317,4321,
+4327,4332,4335,4341,4344,4349,4354,4358,
+4362,4366,4371,4374,4378,4383,4386,4392,
+4396,4399,4402,4405,4408,4411,4414,4417,
+4420,4423,4426,4430,4434,4438,4442,4446,
+4450,4454,4458,4462,4466,4470,4474,4478,
+4482,4486,4490,4493,4496,4500,4503,4506,
+4509,4513,4517,4520,4523,4526,4529,4532,
+/* Block: 57 */
+4537,4540,4543,4546,4549,4552,4555,4558,
+4561,4565,4570,4573,4576,4579,4582,4585,
+4588,4591,4595,4599,4603,4607,4610,4613,
+4616,4619,4622,4625,4628,4631,4634,4637,
+4641,4645,4648,4652,4656,4660,4663,4667,
+4671,4537,4676,4680,4684,4688,4692,4698,
+4705,4708,4711,4714,4717,4720,4723,4726,
+4729,4726,4732,4735,4738,4741,4744,4741,
+4747,4750,4753,4758,4761,4764,4767,4772,
+4776,4779,4782,4785,4788,4791,4634,4794,
+4797,4800,4803,4807,4555,4810,4814,4818,
+4821,4826,4830,4833,4836,4839,4842,4846,
+4850,4853,4856,4859,4862,4865,4868,4871,
+4874,4877,4881,4885,4889,4893,4897,4901,
+4905,4909,4913,4917,4921,4925,4929,4933,
+4937,4941,4945,4949,4953,4957,4961,4965,
+/* Block: 58 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+4969,0,4971,0,4973,0,4975,0,
+4977,0,1262,0,4979,0,4981,0,
+4983,0,4985,0,4987,0,4989,0,
+4991,0,4993,0,4995,0,4997,0,
+4999,0,5001,0,5003,0,5005,0,
+5007,0,5009,0,5011,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 59 */
+5013,0,5015,0,5017,0,5019,0,
+5021,0,5023,0,5025,0,5027,0,
+5029,0,5031,0,5033,0,5035,0,
+5037,0,5039,0,735,739,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 60 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,5041,0,5043,0,5045,0,
+5047,0,5049,0,5051,0,5053,0,
+0,0,5055,0,5057,0,5059,0,
+5061,0,5063,0,5065,0,5067,0,
+5069,0,5071,0,5073,0,5075,0,
+5077,0,5079,0,5081,0,5083,0,
+5085,0,5087,0,5089,0,5091,0,
+5093,0,5095,0,5097,0,5099,0,
+5101,0,5103,0,5105,0,5107,0,
+5109,0,5111,0,5113,0,5115,0,
+5115,0,0,0,0,0,0,0,
+0,5117,0,5119,0,5121,5123,0,
+/* Block: 61 */
+5125,0,5127,0,5129,0,5131,0,
+0,0,0,5133,0,1378,0,0,
+5135,0,5137,0,0,0,5139,0,
+5141,0,5143,0,5145,0,5147,0,
+5149,0,5151,0,5153,0,5155,0,
+5157,0,493,1360,1376,5159,1380,0,
+5161,5163,1384,5165,5167,0,5169,0,
+5171,0,5173,0,5175,0,5177,0,
+5179,0,5181,0,5183,1402,5185,5187,
+0,5189,0,0,0,0,0,0,
+5191,0,0,0,0,0,5193,0,
+5195,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,5,11,33,5197,0,0,
+189,237,0,0,0,0,0,0,
+/* Block: 62 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,5045,5199,2602,5201,
+0,0,0,0,0,0,0,0,
+0,5203,0,0,0,0,0,0,
+5205,5207,5209,5211,5213,5215,5217,5219,
+5221,5223,5225,5227,5229,5231,5233,5235,
+/* Block: 63 */
+5237,5239,5241,5243,5245,5247,5249,5251,
+5253,5255,5257,5259,5261,5263,5265,5267,
+5269,5271,5273,5275,5277,5279,5281,5283,
+5285,5287,5289,5291,5293,5295,5297,5299,
+5301,5303,5305,5307,5309,5311,5313,5315,
+5317,5319,5321,5323,5325,5327,5329,5331,
+5333,5335,5337,5339,5341,5343,5345,5347,
+5349,5351,5353,5355,5357,5359,5361,5363,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 64 */
+5365,5367,3050,5369,5371,5373,5375,3158,
+3158,5377,3066,5379,5381,5383,5385,5387,
+5389,5391,5393,5395,5397,5399,5401,5403,
+5405,5407,5409,5411,5413,5415,5417,5419,
+5421,5423,5425,5427,5429,5431,5433,5435,
+5437,5439,5441,5443,5445,5447,5449,5451,
+5453,5455,5457,5459,2982,5461,5463,5465,
+5467,5469,5471,5473,5475,5477,5479,5481,
+3128,5483,5485,5487,5489,5491,5493,5495,
+5497,5499,5501,5503,5505,5507,5509,5511,
+5513,5515,5517,5519,5521,5523,5525,5527,
+5529,5531,5533,5535,5397,5537,5539,5541,
+5543,5545,5547,5549,5551,5553,5555,5557,
+5559,5561,5563,5565,5567,5569,5571,5573,
+5575,3054,5577,5579,5581,5583,5585,5587,
+5589,5591,5593,5595,5597,5599,5601,5603,
+/* Block: 65 */
+5605,2808,5607,5609,5611,5613,5615,5617,
+5619,5621,2770,5623,5625,5627,5629,5631,
+5633,5635,5637,5639,5641,5643,5645,5647,
+5649,5651,5653,5655,5657,5659,5661,5663,
+5665,5573,5667,5669,5671,5673,5675,5677,
+5679,5681,5541,5683,5685,5687,5689,5691,
+5693,5695,5697,5699,5701,5703,5705,5707,
+5709,5711,5713,5715,5717,5719,5721,5397,
+5723,5725,5727,5729,3156,5731,5733,5735,
+5737,5739,5741,5743,5745,5747,5749,5751,
+5753,3749,5755,5757,5759,5761,5763,5765,
+5767,5769,5771,5545,5773,5775,5777,5779,
+5781,5783,5785,5787,5789,5791,5793,5795,
+5797,3064,5799,5801,5803,5805,5807,5809,
+5811,5813,5815,5817,5819,5821,5823,2966,
+5825,5827,5829,5831,5833,5835,5837,5839,
+/* Block: 66 */
+5841,5843,5845,5847,5849,5851,5853,5855,
+3020,5857,3026,5859,5861,5863,0,0,
+5865,0,5867,0,0,5869,5871,5873,
+5875,5877,5879,5881,5883,5885,2980,0,
+5887,0,5889,0,0,5891,5893,0,
+0,0,5895,5897,5899,5901,5903,5905,
+5907,5909,5911,5913,5915,5917,5919,5921,
+5923,5925,5927,5929,2822,5931,5933,5935,
+5937,5939,5941,5943,5945,5947,5949,5951,
+5953,5955,5957,5959,3759,5961,5963,5965,
+5967,3767,5969,5971,5973,5975,5977,5645,
+5979,5981,5983,5985,5987,5989,5989,5991,
+5993,5995,5997,5999,6001,6003,6005,5891,
+6007,6009,6011,6013,6015,6017,0,0,
+6019,6021,6023,6025,6027,6029,6031,6033,
+5919,6035,6037,6039,5865,6041,6043,6045,
+/* Block: 67 */
+6047,6049,6051,6053,6055,6057,6059,6061,
+6063,5935,6065,5937,6067,6069,6071,6073,
+6075,5867,5439,6077,6079,2888,5575,5741,
+6081,6083,5951,6085,5953,6087,6089,6091,
+5871,6093,6095,6097,6099,6101,5873,6103,
+6105,6107,6109,6111,6113,5977,6115,6117,
+5645,6119,5985,6121,6123,6125,6127,6129,
+5995,6131,5889,6133,5997,5537,6135,5999,
+6137,6003,6139,6141,6143,6145,6147,6007,
+5883,6149,6009,6151,6011,6153,3158,6155,
+6157,6159,6161,6163,6165,6167,6169,6171,
+6173,6175,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 68 */
+6177,6180,6183,6186,6190,6194,6194,0,
+0,0,0,0,0,0,0,0,
+0,0,0,6197,6200,6203,6206,6209,
+0,0,0,0,0,6212,0,6215,
+6218,2052,2058,6220,6222,6224,6226,6228,
+6230,2002,6232,6235,6238,6242,6246,6249,
+6252,6255,6258,6261,6264,6267,6270,0,
+6273,6276,6279,6282,6285,0,6288,0,
+6291,6294,0,6297,6300,0,6303,6306,
+6309,6312,6315,6318,6321,6324,6327,6330,
+6333,6333,6335,6335,6335,6335,6337,6337,
+6337,6337,6339,6339,6339,6339,6341,6341,
+6341,6341,6343,6343,6343,6343,6345,6345,
+6345,6345,6347,6347,6347,6347,6349,6349,
+6349,6349,6351,6351,6351,6351,6353,6353,
+6353,6353,6355,6355,6355,6355,6357,6357,
+/* Block: 69 */
+6357,6357,6359,6359,6361,6361,6363,6363,
+6365,6365,6367,6367,6369,6369,6371,6371,
+6371,6371,6373,6373,6373,6373,6375,6375,
+6375,6375,6377,6377,6377,6377,6379,6379,
+6381,6381,6381,6381,6383,6383,6385,6385,
+6385,6385,6387,6387,6387,6387,6389,6389,
+6391,6391,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,6393,6393,6393,6393,6395,
+6395,6397,6397,6399,6399,1032,6401,6401,
+6403,6403,6405,6405,6407,6407,6407,6407,
+6409,6409,6411,6411,6414,6414,6417,6417,
+6420,6420,6423,6423,6426,6426,6429,6429,
+6429,6432,6432,6432,6435,6435,6435,6435,
+/* Block: 70 */
+6437,6440,6443,6432,6446,6449,6452,6455,
+6458,6461,6464,6467,6470,6473,6476,6479,
+6482,6485,6488,6491,6494,6497,6500,6503,
+6506,6509,6512,6515,6518,6521,6524,6527,
+6530,6533,6536,6539,6542,6545,6548,6551,
+6554,6557,6560,6563,6566,6569,6572,6575,
+6578,6581,6584,6587,6590,6593,6596,6599,
+6602,6605,6608,6611,6614,6617,6620,6623,
+6626,6629,6632,6635,6638,6641,6644,6647,
+6650,6653,6656,6659,6662,6665,6668,6671,
+6674,6677,6680,6683,6686,6689,6692,6695,
+6698,6701,6704,6707,6710,6713,6716,6720,
+6724,6728,6732,6736,6740,6743,6443,6746,
+6432,6446,6749,6752,6458,6755,6461,6464,
+6758,6761,6476,6764,6479,6482,6767,6770,
+6488,6773,6491,6494,6581,6584,6593,6596,
+/* Block: 71 */
+6599,6611,6614,6617,6620,6632,6635,6638,
+6776,6650,6779,6782,6668,6785,6671,6674,
+6713,6788,6791,6698,6794,6701,6704,6437,
+6440,6797,6443,6800,6449,6452,6455,6458,
+6803,6467,6470,6473,6476,6806,6488,6497,
+6500,6503,6506,6509,6515,6518,6521,6524,
+6527,6530,6809,6533,6536,6539,6542,6545,
+6548,6554,6557,6560,6563,6566,6569,6572,
+6575,6578,6587,6590,6602,6605,6608,6611,
+6614,6623,6626,6629,6632,6812,6641,6644,
+6647,6650,6659,6662,6665,6668,6815,6677,
+6680,6818,6689,6692,6695,6698,6821,6443,
+6800,6458,6803,6476,6806,6488,6824,6527,
+6827,6830,6833,6611,6614,6632,6668,6815,
+6698,6821,6836,6840,6844,6848,6851,6854,
+6857,6860,6863,6866,6869,6872,6875,6878,
+/* Block: 72 */
+6881,6884,6887,6890,6893,6896,6899,6902,
+6905,6908,6911,6914,6830,6917,6920,6923,
+6926,6848,6851,6854,6857,6860,6863,6866,
+6869,6872,6875,6878,6881,6884,6887,6890,
+6893,6896,6899,6902,6905,6908,6911,6914,
+6830,6917,6920,6923,6926,6908,6911,6914,
+6830,6827,6833,6551,6518,6521,6524,6908,
+6911,6914,6551,6554,6929,6929,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+6932,6936,6936,6940,6944,6948,6952,6956,
+6960,6960,6964,6968,6972,6976,6980,6984,
+6984,6988,6992,6992,6996,6996,7000,7004,
+7004,7008,7012,7012,7016,7016,7020,7024,
+7024,7028,7028,7032,7036,7040,7044,7044,
+7048,7052,7056,7060,7064,7064,7068,7072,
+/* Block: 73 */
+7076,7080,7084,7088,7088,7092,7092,7096,
+7096,7100,7104,7108,7112,7116,7120,7124,
+0,0,7128,7132,7136,7140,7144,7148,
+7148,7152,7156,7160,7164,7164,7168,7172,
+7176,7180,7184,7188,7192,7196,7200,7204,
+7208,7212,7216,7220,7224,7228,7232,7236,
+7240,7244,7248,7252,7068,7076,7256,7260,
+7264,7268,7272,7276,7272,7264,7280,7284,
+7288,7292,7296,7276,7040,7000,7300,7304,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+7308,7312,7316,7321,7326,7331,7336,7341,
+7346,7351,7355,7374,7383,0,0,0,
+/* Block: 74 */
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+7388,7390,7392,7394,543,7396,7398,7400,
+7402,1950,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1947,7404,7406,7408,7408,2008,2010,7410,
+7412,7414,7416,7418,7420,7422,7424,2182,
+2184,7426,7428,7430,7432,0,0,7434,
+7436,1971,1971,1971,1971,7408,7408,7408,
+7388,7390,1945,0,543,7394,7398,7396,
+7404,2008,2010,7410,7412,7414,7416,7438,
+7440,7442,2002,7444,7446,7448,2006,0,
+7450,7452,7454,7456,0,0,0,0,
+7458,7461,7464,0,7467,0,7470,7473,
+7476,7479,7482,7485,7488,7491,7494,7497,
+/* Block: 75 */
+7500,7502,7502,7504,7504,7506,7506,7508,
+7508,7510,7510,7510,7510,7512,7512,7514,
+7514,7514,7514,7516,7516,7518,7518,7518,
+7518,7520,7520,7520,7520,7522,7522,7522,
+7522,7524,7524,7524,7524,7526,7526,7526,
+7526,7528,7528,7530,7530,7532,7532,7534,
+7534,7536,7536,7536,7536,7538,7538,7538,
+7538,7540,7540,7540,7540,7542,7542,7542,
+7542,7544,7544,7544,7544,7546,7546,7546,
+7546,7548,7548,7548,7548,7550,7550,7550,
+7550,7552,7552,7552,7552,7554,7554,7554,
+7554,7556,7556,7556,7556,7558,7558,7558,
+7558,7560,7560,7560,7560,7562,7562,7562,
+7562,7564,7564,7564,7564,7566,7566,6409,
+6409,7568,7568,7568,7568,7570,7570,7573,
+7573,7576,7576,7579,7579,0,0,58,
+/* Block: 76 */
+0,7396,7582,7438,7452,7454,7440,7584,
+2008,2010,7442,2002,7388,7444,1945,7586,
+1988,74,62,64,1990,1992,1994,1996,
+1998,2000,7394,543,7446,2006,7448,7398,
+7456,1,3,5,7,9,11,13,
+15,17,19,21,23,25,27,29,
+31,33,35,37,39,41,43,45,
+47,49,51,7434,7450,7436,7588,7408,
+1919,1,3,5,7,9,11,13,
+15,17,19,21,23,25,27,29,
+31,33,35,37,39,41,43,45,
+47,49,51,7410,7590,7412,7592,7594,
+7596,7392,7426,7428,7390,7598,4001,7600,
+7602,7604,7606,7608,7610,7612,7614,7616,
+7618,3909,3911,3913,3915,3917,3919,3921,
+3923,3925,3927,3929,3931,3933,3935,3937,
+/* Block: 77 */
+3939,3941,3943,3945,3947,3949,3951,3953,
+3955,3957,3959,3961,3963,3965,3967,3969,
+3971,3973,3975,3977,3979,3981,3983,3985,
+3987,3989,3991,3993,3995,7620,7622,7624,
+58,3180,3182,3184,3186,3188,3190,3192,
+3194,3196,3198,3200,3202,3204,3206,3208,
+3210,3212,3214,3216,3218,3220,3222,3224,
+3226,3228,3230,3232,3234,3236,3238,0,
+0,0,3240,3242,3244,3246,3248,3250,
+0,0,3252,3254,3256,3258,3260,3262,
+0,0,3264,3266,3268,3270,3272,3274,
+0,0,3276,3278,3280,0,0,0,
+7626,7628,7630,59,7632,7634,7636,0,
+7638,7640,7642,7644,7646,7648,7650,0,
+58,58,58,58,58,58,58,58,
+58,0,0,0,0,0,0,0,
+/* Block: 78 */
+7652,7654,7656,7658,7660,7662,7664,7666,
+7668,7670,7672,7674,7676,7678,7680,7682,
+7684,7686,7688,7690,7692,7694,7696,7698,
+7700,7702,7704,7706,7708,7710,7712,7714,
+7716,7718,7720,7722,7724,7726,7728,7730,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 79 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+7732,7734,7736,7738,7740,7742,7744,7746,
+7748,7750,7752,7754,7756,7758,7760,7762,
+7764,7766,7768,7770,7772,7774,7776,7778,
+7780,7782,7784,7786,7788,7790,7792,7794,
+7796,7798,7800,7802,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 80 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+7804,7806,7808,7810,7812,7814,7816,7818,
+7820,7822,7824,0,7826,7828,7830,7832,
+/* Block: 81 */
+7834,7836,7838,7840,7842,7844,7846,7848,
+7850,7852,7854,0,7856,7858,7860,7862,
+7864,7866,7868,0,7870,7872,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 82 */
+0,7874,7876,100,7878,283,0,7880,
+7882,7884,7886,293,295,7888,7890,7892,
+7894,7896,7898,307,7900,189,7902,7904,
+7906,7908,7910,5159,7912,7914,7916,7918,
+7920,7922,134,7924,7926,33,7928,7930,
+2606,7932,329,7934,7936,7938,7940,337,
+7942,0,7944,7946,7948,7950,7952,7954,
+7956,7958,7960,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 83 */
+7962,7964,7966,7968,7970,7972,7974,7976,
+7978,7980,7982,7984,7986,7988,7990,7992,
+7994,7996,7998,8000,8002,8004,8006,8008,
+8010,8012,8014,8016,8018,8020,8022,8024,
+8026,8028,8030,8032,8034,8036,8038,8040,
+8042,8044,8046,8048,8050,8052,8054,8056,
+8058,8060,8062,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 84 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+8064,8066,8068,8070,8072,8074,8076,8078,
+8080,8082,8084,8086,8088,8090,8092,8094,
+8096,8098,8100,8102,8104,8106,8108,8110,
+8112,8114,8116,8118,8120,8122,8124,8126,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 85 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+8128,8130,8132,8134,8136,8138,8140,8142,
+8144,8146,8148,8150,8152,8154,8156,8158,
+8160,8162,8164,8166,8168,8170,8172,8174,
+8176,8178,8180,8182,8184,8186,8188,8190,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 86 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+58,58,58,58,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 87 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8192,8195,
+8198,8202,8206,8210,8214,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,58,58,58,58,58,
+58,58,58,0,0,0,0,0,
+/* Block: 88 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,8218,8221,8224,8228,8232,
+8236,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 89 */
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+49,51,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+45,47,49,51,1,3,5,7,
+9,11,13,15,17,19,21,23,
+25,27,29,31,33,35,37,39,
+41,43,45,47,49,51,1,3,
+5,7,9,11,13,0,17,19,
+21,23,25,27,29,31,33,35,
+37,39,41,43,45,47,49,51,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+/* Block: 90 */
+49,51,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+45,47,49,51,1,0,5,7,
+0,0,13,0,0,19,21,0,
+0,27,29,31,33,0,37,39,
+41,43,45,47,49,51,1,3,
+5,7,0,11,0,15,17,19,
+21,23,25,27,0,31,33,35,
+37,39,41,43,45,47,49,51,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+49,51,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+/* Block: 91 */
+45,47,49,51,1,3,0,7,
+9,11,13,0,0,19,21,23,
+25,27,29,31,33,0,37,39,
+41,43,45,47,49,0,1,3,
+5,7,9,11,13,15,17,19,
+21,23,25,27,29,31,33,35,
+37,39,41,43,45,47,49,51,
+1,3,0,7,9,11,13,0,
+17,19,21,23,25,0,29,0,
+0,0,37,39,41,43,45,47,
+49,0,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+45,47,49,51,1,3,5,7,
+9,11,13,15,17,19,21,23,
+25,27,29,31,33,35,37,39,
+/* Block: 92 */
+41,43,45,47,49,51,1,3,
+5,7,9,11,13,15,17,19,
+21,23,25,27,29,31,33,35,
+37,39,41,43,45,47,49,51,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+49,51,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+45,47,49,51,1,3,5,7,
+9,11,13,15,17,19,21,23,
+25,27,29,31,33,35,37,39,
+41,43,45,47,49,51,1,3,
+5,7,9,11,13,15,17,19,
+21,23,25,27,29,31,33,35,
+/* Block: 93 */
+37,39,41,43,45,47,49,51,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+49,51,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+45,47,49,51,1,3,5,7,
+9,11,13,15,17,19,21,23,
+25,27,29,31,33,35,37,39,
+41,43,45,47,49,51,1,3,
+5,7,9,11,13,15,17,19,
+21,23,25,27,29,31,33,35,
+37,39,41,43,45,47,49,51,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+/* Block: 94 */
+33,35,37,39,41,43,45,47,
+49,51,1,3,5,7,9,11,
+13,15,17,19,21,23,25,27,
+29,31,33,35,37,39,41,43,
+45,47,49,51,8240,8242,0,0,
+567,569,571,573,575,577,579,581,
+530,583,585,69,587,589,591,593,
+595,581,597,599,601,603,605,607,
+609,8244,567,569,571,573,575,577,
+579,581,530,583,585,69,587,589,
+591,593,595,597,597,599,601,603,
+605,607,609,8246,575,581,583,603,
+595,593,567,569,571,573,575,577,
+579,581,530,583,585,69,587,589,
+591,593,595,581,597,599,601,603,
+605,607,609,8244,567,569,571,573,
+/* Block: 95 */
+575,577,579,581,530,583,585,69,
+587,589,591,593,595,597,597,599,
+601,603,605,607,609,8246,575,581,
+583,603,595,593,567,569,571,573,
+575,577,579,581,530,583,585,69,
+587,589,591,593,595,581,597,599,
+601,603,605,607,609,8244,567,569,
+571,573,575,577,579,581,530,583,
+585,69,587,589,591,593,595,597,
+597,599,601,603,605,607,609,8246,
+575,581,583,603,595,593,567,569,
+571,573,575,577,579,581,530,583,
+585,69,587,589,591,593,595,581,
+597,599,601,603,605,607,609,8244,
+567,569,571,573,575,577,579,581,
+530,583,585,69,587,589,591,593,
+/* Block: 96 */
+595,597,597,599,601,603,605,607,
+609,8246,575,581,583,603,595,593,
+567,569,571,573,575,577,579,581,
+530,583,585,69,587,589,591,593,
+595,581,597,599,601,603,605,607,
+609,8244,567,569,571,573,575,577,
+579,581,530,583,585,69,587,589,
+591,593,595,597,597,599,601,603,
+605,607,609,8246,575,581,583,603,
+595,593,621,621,0,0,1988,74,
+62,64,1990,1992,1994,1996,1998,2000,
+1988,74,62,64,1990,1992,1994,1996,
+1998,2000,1988,74,62,64,1990,1992,
+1994,1996,1998,2000,1988,74,62,64,
+1990,1992,1994,1996,1998,2000,1988,74,
+62,64,1990,1992,1994,1996,1998,2000,
+/* Block: 97 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+683,685,687,689,691,693,695,697,
+699,703,705,707,711,713,715,717,
+719,721,723,725,727,729,731,737,
+741,743,5021,859,663,667,875,817,
+835,683,685,687,689,691,693,695,
+697,699,703,705,711,713,717,721,
+723,725,727,729,731,735,737,787,
+663,661,681,813,4983,819,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 98 */
+8248,8250,8252,8254,8256,8258,8260,8262,
+8264,8266,8268,8270,8272,8274,8276,8278,
+8280,8282,8284,8286,8288,8290,8292,8294,
+8296,8298,8300,8302,8304,8306,8308,8310,
+8312,8314,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 99 */
+7512,7514,7522,7528,0,7566,7534,7524,
+7544,7568,7556,7558,7560,7562,7536,7548,
+7552,7540,7554,7532,7538,7518,7520,7526,
+7530,7542,7546,7550,8316,6379,8318,8320,
+0,7514,7522,0,7564,0,0,7524,
+0,7568,7556,7558,7560,7562,7536,7548,
+7552,7540,7554,0,7538,7518,7520,7526,
+0,7542,0,7550,0,0,0,0,
+0,0,7522,0,0,0,0,7524,
+0,7568,0,7558,0,7562,7536,7548,
+0,7540,7554,0,7538,0,0,7526,
+0,7542,0,7550,0,6379,0,8320,
+0,7514,7522,0,7564,0,0,7524,
+7544,7568,7556,0,7560,7562,7536,7548,
+7552,7540,7554,0,7538,7518,7520,7526,
+0,7542,7546,7550,8316,0,8318,0,
+/* Block: 100 */
+7512,7514,7522,7528,7564,7566,7534,7524,
+7544,7568,0,7558,7560,7562,7536,7548,
+7552,7540,7554,7532,7538,7518,7520,7526,
+7530,7542,7546,7550,0,0,0,0,
+0,7514,7522,7528,0,7566,7534,7524,
+7544,7568,0,7558,7560,7562,7536,7548,
+7552,7540,7554,7532,7538,7518,7520,7526,
+7530,7542,7546,7550,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 101 */
+8322,8325,8328,8331,8334,8337,8340,8343,
+8346,8349,8352,0,0,0,0,0,
+2381,2385,2389,2393,2397,2401,2405,2409,
+2413,2417,2421,2425,2429,2433,2437,2441,
+2445,2449,2453,2457,2461,2465,2469,2473,
+2477,2481,8355,5,35,4764,8359,0,
+1,3,5,7,9,11,13,15,
+17,19,21,23,25,27,29,31,
+33,35,37,39,41,43,45,47,
+49,51,8362,4726,8365,148,8368,8372,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,8375,8378,8381,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 102 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+8384,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 103 */
+8387,8390,3929,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+2860,8393,8395,8397,2746,8399,8401,3382,
+8403,8405,8407,5721,8409,8411,8413,8415,
+8417,8419,2932,8421,8423,8425,8427,8429,
+8431,2734,3366,8433,3791,3372,3793,8435,
+3044,8437,8439,8441,8443,8445,3757,2880,
+8447,8449,8451,8453,0,0,0,0,
+8455,8459,8463,8467,8471,8475,8479,8483,
+8487,0,0,0,0,0,0,0,
+8491,8493,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 104 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1988,74,62,64,1990,1992,1994,1996,
+1998,2000,0,0,0,0,0,0,
+/* Block: 105 */
+8495,8497,8499,8501,8503,5907,8505,8507,
+8509,8511,5909,8513,8515,8517,5911,8519,
+8521,8523,8525,8527,8529,8413,8531,8533,
+8535,8537,8539,6021,8541,2766,8543,8545,
+8547,8549,8449,8551,8553,6031,5913,5915,
+6033,8555,8557,5549,8559,5917,8561,8563,
+8565,8567,8567,8567,8569,8571,8573,8575,
+8577,8579,8581,8583,8585,8587,8589,8591,
+8593,8595,8597,8599,8601,8603,8603,6037,
+8605,8607,8609,8611,5921,8613,8615,8617,
+5841,8619,8621,8623,8625,8627,8629,8631,
+8633,8635,8637,8639,8641,8399,8643,8645,
+8647,8649,8651,8653,8655,8657,8659,8661,
+8663,8665,8667,8667,8669,8671,8673,5541,
+8675,8677,8679,8681,8683,2818,8685,8687,
+2822,8689,8691,8693,8695,8697,8699,8701,
+/* Block: 106 */
+8703,8705,8707,8709,8711,8713,8715,8717,
+8719,8721,8723,8725,8727,8729,5437,8731,
+2842,8733,8733,8735,8737,8737,8739,8741,
+8743,8745,8747,8749,8751,8753,8755,8757,
+8759,8761,8763,5931,8765,8767,8769,8771,
+6061,8771,8773,5935,8775,8777,8779,8781,
+5937,5383,8783,8785,8787,8789,8791,8793,
+8795,8797,8799,8801,8803,8805,8807,8809,
+8811,8813,8815,8817,8819,8821,8823,8825,
+5939,8827,8829,8831,8833,8835,8837,5943,
+8839,8841,8843,8845,8847,8849,8851,8853,
+5439,6077,8855,8857,8859,8861,8863,8865,
+8867,8869,5945,8871,8873,8875,8877,6161,
+8879,8881,8883,8885,8887,8889,8891,8893,
+8895,8897,8899,8901,8903,5575,8905,8907,
+8909,8911,8913,8915,8917,8919,8921,8923,
+/* Block: 107 */
+8925,5947,5741,8927,8929,8931,8933,8935,
+8937,8939,8941,6083,8943,8945,8947,8949,
+8951,8953,8955,8957,6085,8959,8961,8963,
+8965,8967,8969,8971,8973,8975,8977,8979,
+8981,6089,8983,8985,8987,8989,8991,8993,
+8995,8997,8999,9001,9003,9003,9005,9007,
+6093,9009,9011,9013,9015,9017,9019,9021,
+5547,9023,9025,9027,9029,9031,9033,9035,
+6105,9037,9039,9041,9043,9045,9047,9047,
+6107,6165,9049,9051,9053,9055,9057,5473,
+6111,9059,9061,5967,9063,9065,5881,9067,
+9069,5973,9071,9073,9075,9077,9077,9079,
+9081,9083,9085,9087,9089,9091,9093,9095,
+9097,9099,9101,9103,9105,9107,9109,9111,
+9113,9115,9117,9119,9121,9123,9125,9127,
+9129,9131,5985,9133,9135,9137,9139,9141,
+/* Block: 108 */
+9143,9145,9147,9149,9151,9153,9155,9157,
+9159,9161,9163,8735,9165,9167,9169,9171,
+9173,9175,9177,9179,9181,9183,9185,9187,
+5581,9189,9191,9193,9195,9197,9199,5991,
+9201,9203,9205,9207,9209,9211,9213,9215,
+9217,9219,9221,9223,9225,9227,9229,9231,
+9233,9235,9237,9239,5463,9241,9243,9245,
+9247,9249,9251,6125,9253,9255,9257,9259,
+9261,9263,9265,9267,3022,9269,9271,9273,
+9275,9277,9279,9281,9283,9285,9287,9289,
+6135,6137,3036,9291,9293,9295,9297,9299,
+9301,9303,9305,9307,9309,9311,9313,6139,
+9315,9317,9319,9321,9323,9325,9327,9329,
+9331,9333,9335,9337,9339,9341,9343,9345,
+9347,9349,9351,9353,9355,9357,9359,9361,
+9363,9365,9367,9369,9371,9373,6151,6151,
+/* Block: 109 */
+9375,9377,9379,9381,9383,9385,9387,9389,
+9391,9393,6153,9395,9397,9399,9401,9403,
+9405,9407,9409,9411,9413,3132,9415,3140,
+9417,9419,9421,9423,3150,9425,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 110 */
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58,
+58,58,58,58,58,58,58,58};
+
+uaix_const_data uaix_data_array(type_codept, stage3_nfkc_cf, 9427) = {
+0,1,97,1,98,1,99,1,
+100,1,101,1,102,1,103,1,
+104,1,105,1,106,1,107,1,
+108,1,109,1,110,1,111,1,
+112,1,113,1,114,1,115,1,
+116,1,117,1,118,1,119,1,
+120,1,121,1,122,1,32,2,
+32,776,0,2,32,772,1,50,
+1,51,2,32,769,1,956,2,
+32,807,1,49,3,49,8260,52,
+3,49,8260,50,3,51,8260,52,
+1,224,1,225,1,226,1,227,
+1,228,1,229,1,230,1,231,
+1,232,1,233,1,234,1,235,
+1,236,1,237,1,238,1,239,
+1,240,1,241,1,242,1,243,
+1,244,1,245,1,246,1,248,
+1,249,1,250,1,251,1,252,
+1,253,1,254,2,115,115,1,
+257,1,259,1,261,1,263,1,
+265,1,267,1,269,1,271,1,
+273,1,275,1,277,1,279,1,
+281,1,283,1,285,1,287,1,
+289,1,291,1,293,1,295,1,
+297,1,299,1,301,1,303,2,
+105,775,2,105,106,1,309,1,
+311,1,314,1,316,1,318,2,
+108,183,1,322,1,324,1,326,
+1,328,2,700,110,1,331,1,
+333,1,335,1,337,1,339,1,
+341,1,343,1,345,1,347,1,
+349,1,351,1,353,1,355,1,
+357,1,359,1,361,1,363,1,
+365,1,367,1,369,1,371,1,
+373,1,375,1,255,1,378,1,
+380,1,382,1,595,1,387,1,
+389,1,596,1,392,1,598,1,
+599,1,396,1,477,1,601,1,
+603,1,402,1,608,1,611,1,
+617,1,616,1,409,1,623,1,
+626,1,629,1,417,1,419,1,
+421,1,640,1,424,1,643,1,
+429,1,648,1,432,1,650,1,
+651,1,436,1,438,1,658,1,
+441,1,445,2,100,382,2,108,
+106,2,110,106,1,462,1,464,
+1,466,1,468,1,470,1,472,
+1,474,1,476,1,479,1,481,
+1,483,1,485,1,487,1,489,
+1,491,1,493,1,495,2,100,
+122,1,501,1,405,1,447,1,
+505,1,507,1,509,1,511,1,
+513,1,515,1,517,1,519,1,
+521,1,523,1,525,1,527,1,
+529,1,531,1,533,1,535,1,
+537,1,539,1,541,1,543,1,
+414,1,547,1,549,1,551,1,
+553,1,555,1,557,1,559,1,
+561,1,563,1,11365,1,572,1,
+410,1,11366,1,578,1,384,1,
+649,1,652,1,583,1,585,1,
+587,1,589,1,591,1,614,1,
+633,1,635,1,641,2,32,774,
+2,32,775,2,32,778,2,32,
+808,2,32,771,2,32,779,1,
+661,1,768,1,769,1,787,2,
+776,769,1,953,1,881,1,883,
+1,697,1,887,2,32,953,1,
+59,1,1011,3,32,776,769,1,
+940,1,183,1,941,1,942,1,
+943,1,972,1,973,1,974,1,
+945,1,946,1,947,1,948,1,
+949,1,950,1,951,1,952,1,
+954,1,955,1,957,1,958,1,
+959,1,960,1,961,1,963,1,
+964,1,965,1,966,1,967,1,
+968,1,969,1,970,1,971,1,
+983,1,985,1,987,1,989,1,
+991,1,993,1,995,1,997,1,
+999,1,1001,1,1003,1,1005,1,
+1007,1,1016,1,1019,1,891,1,
+892,1,893,1,1104,1,1105,1,
+1106,1,1107,1,1108,1,1109,1,
+1110,1,1111,1,1112,1,1113,1,
+1114,1,1115,1,1116,1,1117,1,
+1118,1,1119,1,1072,1,1073,1,
+1074,1,1075,1,1076,1,1077,1,
+1078,1,1079,1,1080,1,1081,1,
+1082,1,1083,1,1084,1,1085,1,
+1086,1,1087,1,1088,1,1089,1,
+1090,1,1091,1,1092,1,1093,1,
+1094,1,1095,1,1096,1,1097,1,
+1098,1,1099,1,1100,1,1101,1,
+1102,1,1103,1,1121,1,1123,1,
+1125,1,1127,1,1129,1,1131,1,
+1133,1,1135,1,1137,1,1139,1,
+1141,1,1143,1,1145,1,1147,1,
+1149,1,1151,1,1153,1,1163,1,
+1165,1,1167,1,1169,1,1171,1,
+1173,1,1175,1,1177,1,1179,1,
+1181,1,1183,1,1185,1,1187,1,
+1189,1,1191,1,1193,1,1195,1,
+1197,1,1199,1,1201,1,1203,1,
+1205,1,1207,1,1209,1,1211,1,
+1213,1,1215,1,1231,1,1218,1,
+1220,1,1222,1,1224,1,1226,1,
+1228,1,1230,1,1233,1,1235,1,
+1237,1,1239,1,1241,1,1243,1,
+1245,1,1247,1,1249,1,1251,1,
+1253,1,1255,1,1257,1,1259,1,
+1261,1,1263,1,1265,1,1267,1,
+1269,1,1271,1,1273,1,1275,1,
+1277,1,1279,1,1281,1,1283,1,
+1285,1,1287,1,1289,1,1291,1,
+1293,1,1295,1,1297,1,1299,1,
+1301,1,1303,1,1305,1,1307,1,
+1309,1,1311,1,1313,1,1315,1,
+1317,1,1319,1,1321,1,1323,1,
+1325,1,1327,1,1377,1,1378,1,
+1379,1,1380,1,1381,1,1382,1,
+1383,1,1384,1,1385,1,1386,1,
+1387,1,1388,1,1389,1,1390,1,
+1391,1,1392,1,1393,1,1394,1,
+1395,1,1396,1,1397,1,1398,1,
+1399,1,1400,1,1401,1,1402,1,
+1403,1,1404,1,1405,1,1406,1,
+1407,1,1408,1,1409,1,1410,1,
+1411,1,1412,1,1413,1,1414,2,
+1381,1410,2,1575,1652,2,1608,1652,
+2,1735,1652,2,1610,1652,2,2325,
+2364,2,2326,2364,2,2327,2364,2,
+2332,2364,2,2337,2364,2,2338,2364,
+2,2347,2364,2,2351,2364,2,2465,
+2492,2,2466,2492,2,2479,2492,2,
+2610,2620,2,2616,2620,2,2582,2620,
+2,2583,2620,2,2588,2620,2,2603,
+2620,2,2849,2876,2,2850,2876,2,
+3661,3634,2,3789,3762,2,3755,3737,
+2,3755,3745,1,3851,2,3906,4023,
+2,3916,4023,2,3921,4023,2,3926,
+4023,2,3931,4023,2,3904,4021,2,
+3953,3954,2,3953,3956,2,4018,3968,
+3,4018,3953,3968,2,4019,3968,3,
+4019,3953,3968,2,3953,3968,2,3986,
+4023,2,3996,4023,2,4001,4023,2,
+4006,4023,2,4011,4023,2,3984,4021,
+1,11520,1,11521,1,11522,1,11523,
+1,11524,1,11525,1,11526,1,11527,
+1,11528,1,11529,1,11530,1,11531,
+1,11532,1,11533,1,11534,1,11535,
+1,11536,1,11537,1,11538,1,11539,
+1,11540,1,11541,1,11542,1,11543,
+1,11544,1,11545,1,11546,1,11547,
+1,11548,1,11549,1,11550,1,11551,
+1,11552,1,11553,1,11554,1,11555,
+1,11556,1,11557,1,11559,1,11565,
+1,4316,1,5104,1,5105,1,5106,
+1,5107,1,5108,1,5109,1,42571,
+1,4304,1,4305,1,4306,1,4307,
+1,4308,1,4309,1,4310,1,4311,
+1,4312,1,4313,1,4314,1,4315,
+1,4317,1,4318,1,4319,1,4320,
+1,4321,1,4322,1,4323,1,4324,
+1,4325,1,4326,1,4327,1,4328,
+1,4329,1,4330,1,4331,1,4332,
+1,4333,1,4334,1,4335,1,4336,
+1,4337,1,4338,1,4339,1,4340,
+1,4341,1,4342,1,4343,1,4344,
+1,4345,1,4346,1,4349,1,4350,
+1,4351,1,592,1,593,1,7426,
+1,604,1,7446,1,7447,1,7453,
+1,7461,1,594,1,597,1,607,
+1,609,1,613,1,618,1,7547,
+1,669,1,621,1,7557,1,671,
+1,625,1,624,1,627,1,628,
+1,632,1,642,1,427,1,7452,
+1,656,1,657,1,7681,1,7683,
+1,7685,1,7687,1,7689,1,7691,
+1,7693,1,7695,1,7697,1,7699,
+1,7701,1,7703,1,7705,1,7707,
+1,7709,1,7711,1,7713,1,7715,
+1,7717,1,7719,1,7721,1,7723,
+1,7725,1,7727,1,7729,1,7731,
+1,7733,1,7735,1,7737,1,7739,
+1,7741,1,7743,1,7745,1,7747,
+1,7749,1,7751,1,7753,1,7755,
+1,7757,1,7759,1,7761,1,7763,
+1,7765,1,7767,1,7769,1,7771,
+1,7773,1,7775,1,7777,1,7779,
+1,7781,1,7783,1,7785,1,7787,
+1,7789,1,7791,1,7793,1,7795,
+1,7797,1,7799,1,7801,1,7803,
+1,7805,1,7807,1,7809,1,7811,
+1,7813,1,7815,1,7817,1,7819,
+1,7821,1,7823,1,7825,1,7827,
+1,7829,2,97,702,1,7841,1,
+7843,1,7845,1,7847,1,7849,1,
+7851,1,7853,1,7855,1,7857,1,
+7859,1,7861,1,7863,1,7865,1,
+7867,1,7869,1,7871,1,7873,1,
+7875,1,7877,1,7879,1,7881,1,
+7883,1,7885,1,7887,1,7889,1,
+7891,1,7893,1,7895,1,7897,1,
+7899,1,7901,1,7903,1,7905,1,
+7907,1,7909,1,7911,1,7913,1,
+7915,1,7917,1,7919,1,7921,1,
+7923,1,7925,1,7927,1,7929,1,
+7931,1,7933,1,7935,1,7936,1,
+7937,1,7938,1,7939,1,7940,1,
+7941,1,7942,1,7943,1,7952,1,
+7953,1,7954,1,7955,1,7956,1,
+7957,1,7968,1,7969,1,7970,1,
+7971,1,7972,1,7973,1,7974,1,
+7975,1,7984,1,7985,1,7986,1,
+7987,1,7988,1,7989,1,7990,1,
+7991,1,8000,1,8001,1,8002,1,
+8003,1,8004,1,8005,1,8017,1,
+8019,1,8021,1,8023,1,8032,1,
+8033,1,8034,1,8035,1,8036,1,
+8037,1,8038,1,8039,2,7936,953,
+2,7937,953,2,7938,953,2,7939,
+953,2,7940,953,2,7941,953,2,
+7942,953,2,7943,953,2,7968,953,
+2,7969,953,2,7970,953,2,7971,
+953,2,7972,953,2,7973,953,2,
+7974,953,2,7975,953,2,8032,953,
+2,8033,953,2,8034,953,2,8035,
+953,2,8036,953,2,8037,953,2,
+8038,953,2,8039,953,2,8048,953,
+2,945,953,2,940,953,2,8118,
+953,1,8112,1,8113,1,8048,2,
+32,787,2,32,834,3,32,776,
+834,2,8052,953,2,951,953,2,
+942,953,2,8134,953,1,8050,1,
+8052,3,32,787,768,3,32,787,
+769,3,32,787,834,1,912,1,
+8144,1,8145,1,8054,3,32,788,
+768,3,32,788,769,3,32,788,
+834,1,944,1,8160,1,8161,1,
+8058,1,8165,3,32,776,768,1,
+96,2,8060,953,2,969,953,2,
+974,953,2,8182,953,1,8056,1,
+8060,2,32,788,1,8208,2,32,
+819,1,46,2,46,46,3,46,
+46,46,2,8242,8242,3,8242,8242,
+8242,2,8245,8245,3,8245,8245,8245,
+2,33,33,2,32,773,2,63,
+63,2,63,33,2,33,63,4,
+8242,8242,8242,8242,1,48,1,52,
+1,53,1,54,1,55,1,56,
+1,57,1,43,1,8722,1,61,
+1,40,1,41,2,114,115,3,
+97,47,99,3,97,47,115,2,
+176,99,3,99,47,111,3,99,
+47,117,2,176,102,2,110,111,
+2,115,109,3,116,101,108,2,
+116,109,1,8526,1,1488,1,1489,
+1,1490,1,1491,3,102,97,120,
+1,8721,3,49,8260,55,3,49,
+8260,57,4,49,8260,49,48,3,
+49,8260,51,3,50,8260,51,3,
+49,8260,53,3,50,8260,53,3,
+51,8260,53,3,52,8260,53,3,
+49,8260,54,3,53,8260,54,3,
+49,8260,56,3,51,8260,56,3,
+53,8260,56,3,55,8260,56,2,
+49,8260,2,105,105,3,105,105,
+105,2,105,118,2,118,105,3,
+118,105,105,4,118,105,105,105,
+2,105,120,2,120,105,3,120,
+105,105,1,8580,3,48,8260,51,
+2,8747,8747,3,8747,8747,8747,2,
+8750,8750,3,8750,8750,8750,1,12296,
+1,12297,2,49,48,2,49,49,
+2,49,50,2,49,51,2,49,
+52,2,49,53,2,49,54,2,
+49,55,2,49,56,2,49,57,
+2,50,48,3,40,49,41,3,
+40,50,41,3,40,51,41,3,
+40,52,41,3,40,53,41,3,
+40,54,41,3,40,55,41,3,
+40,56,41,3,40,57,41,4,
+40,49,48,41,4,40,49,49,
+41,4,40,49,50,41,4,40,
+49,51,41,4,40,49,52,41,
+4,40,49,53,41,4,40,49,
+54,41,4,40,49,55,41,4,
+40,49,56,41,4,40,49,57,
+41,4,40,50,48,41,2,49,
+46,2,50,46,2,51,46,2,
+52,46,2,53,46,2,54,46,
+2,55,46,2,56,46,2,57,
+46,3,49,48,46,3,49,49,
+46,3,49,50,46,3,49,51,
+46,3,49,52,46,3,49,53,
+46,3,49,54,46,3,49,55,
+46,3,49,56,46,3,49,57,
+46,3,50,48,46,3,40,97,
+41,3,40,98,41,3,40,99,
+41,3,40,100,41,3,40,101,
+41,3,40,102,41,3,40,103,
+41,3,40,104,41,3,40,105,
+41,3,40,106,41,3,40,107,
+41,3,40,108,41,3,40,109,
+41,3,40,110,41,3,40,111,
+41,3,40,112,41,3,40,113,
+41,3,40,114,41,3,40,115,
+41,3,40,116,41,3,40,117,
+41,3,40,118,41,3,40,119,
+41,3,40,120,41,3,40,121,
+41,3,40,122,41,4,8747,8747,
+8747,8747,3,58,58,61,2,61,
+61,3,61,61,61,2,10973,824,
+1,11312,1,11313,1,11314,1,11315,
+1,11316,1,11317,1,11318,1,11319,
+1,11320,1,11321,1,11322,1,11323,
+1,11324,1,11325,1,11326,1,11327,
+1,11328,1,11329,1,11330,1,11331,
+1,11332,1,11333,1,11334,1,11335,
+1,11336,1,11337,1,11338,1,11339,
+1,11340,1,11341,1,11342,1,11343,
+1,11344,1,11345,1,11346,1,11347,
+1,11348,1,11349,1,11350,1,11351,
+1,11352,1,11353,1,11354,1,11355,
+1,11356,1,11357,1,11358,1,11359,
+1,11361,1,619,1,7549,1,637,
+1,11368,1,11370,1,11372,1,11379,
+1,11382,1,575,1,576,1,11393,
+1,11395,1,11397,1,11399,1,11401,
+1,11403,1,11405,1,11407,1,11409,
+1,11411,1,11413,1,11415,1,11417,
+1,11419,1,11421,1,11423,1,11425,
+1,11427,1,11429,1,11431,1,11433,
+1,11435,1,11437,1,11439,1,11441,
+1,11443,1,11445,1,11447,1,11449,
+1,11451,1,11453,1,11455,1,11457,
+1,11459,1,11461,1,11463,1,11465,
+1,11467,1,11469,1,11471,1,11473,
+1,11475,1,11477,1,11479,1,11481,
+1,11483,1,11485,1,11487,1,11489,
+1,11491,1,11500,1,11502,1,11507,
+1,11617,1,27597,1,40863,1,19968,
+1,20008,1,20022,1,20031,1,20057,
+1,20101,1,20108,1,20128,1,20154,
+1,20799,1,20837,1,20843,1,20866,
+1,20886,1,20907,1,20960,1,20981,
+1,20992,1,21147,1,21241,1,21269,
+1,21274,1,21304,1,21313,1,21340,
+1,21353,1,21378,1,21430,1,21448,
+1,21475,1,22231,1,22303,1,22763,
+1,22786,1,22794,1,22805,1,22823,
+1,22899,1,23376,1,23424,1,23544,
+1,23567,1,23586,1,23608,1,23662,
+1,23665,1,24027,1,24037,1,24049,
+1,24062,1,24178,1,24186,1,24191,
+1,24308,1,24318,1,24331,1,24339,
+1,24400,1,24417,1,24435,1,24515,
+1,25096,1,25142,1,25163,1,25903,
+1,25908,1,25991,1,26007,1,26020,
+1,26041,1,26080,1,26085,1,26352,
+1,26376,1,26408,1,27424,1,27490,
+1,27513,1,27571,1,27595,1,27604,
+1,27611,1,27663,1,27668,1,27700,
+1,28779,1,29226,1,29238,1,29243,
+1,29247,1,29255,1,29273,1,29275,
+1,29356,1,29572,1,29577,1,29916,
+1,29926,1,29976,1,29983,1,29992,
+1,30000,1,30091,1,30098,1,30326,
+1,30333,1,30382,1,30399,1,30446,
+1,30683,1,30690,1,30707,1,31034,
+1,31160,1,31166,1,31348,1,31435,
+1,31481,1,31859,1,31992,1,32566,
+1,32593,1,32650,1,32701,1,32769,
+1,32780,1,32786,1,32819,1,32895,
+1,32905,1,33251,1,33258,1,33267,
+1,33276,1,33292,1,33307,1,33311,
+1,33390,1,33394,1,33400,1,34381,
+1,34411,1,34880,1,34892,1,34915,
+1,35198,1,35211,1,35282,1,35328,
+1,35895,1,35910,1,35925,1,35960,
+1,35997,1,36196,1,36208,1,36275,
+1,36523,1,36554,1,36763,1,36784,
+1,36789,1,37009,1,37193,1,37318,
+1,37324,1,37329,1,38263,1,38272,
+1,38428,1,38582,1,38585,1,38632,
+1,38737,1,38750,1,38754,1,38761,
+1,38859,1,38893,1,38899,1,38913,
+1,39080,1,39131,1,39135,1,39318,
+1,39321,1,39340,1,39592,1,39640,
+1,39647,1,39717,1,39727,1,39730,
+1,39740,1,39770,1,40165,1,40565,
+1,40575,1,40613,1,40635,1,40643,
+1,40653,1,40657,1,40697,1,40701,
+1,40718,1,40723,1,40736,1,40763,
+1,40778,1,40786,1,40845,1,40860,
+1,40864,1,12306,1,21316,1,21317,
+2,32,12441,2,32,12442,2,12424,
+12426,2,12467,12488,1,4352,1,4353,
+1,4522,1,4354,1,4524,1,4525,
+1,4355,1,4356,1,4357,1,4528,
+1,4529,1,4530,1,4531,1,4532,
+1,4533,1,4378,1,4358,1,4359,
+1,4360,1,4385,1,4361,1,4362,
+1,4363,1,4364,1,4365,1,4366,
+1,4367,1,4368,1,4369,1,4370,
+1,4449,1,4450,1,4451,1,4452,
+1,4453,1,4454,1,4455,1,4456,
+1,4457,1,4458,1,4459,1,4460,
+1,4461,1,4462,1,4463,1,4464,
+1,4465,1,4466,1,4467,1,4468,
+1,4469,1,4372,1,4373,1,4551,
+1,4552,1,4556,1,4558,1,4563,
+1,4567,1,4569,1,4380,1,4573,
+1,4575,1,4381,1,4382,1,4384,
+1,4386,1,4387,1,4391,1,4393,
+1,4395,1,4396,1,4397,1,4398,
+1,4399,1,4402,1,4406,1,4416,
+1,4423,1,4428,1,4593,1,4594,
+1,4439,1,4440,1,4441,1,4484,
+1,4485,1,4488,1,4497,1,4498,
+1,4500,1,4510,1,4513,1,19977,
+1,22235,1,19978,1,20013,1,19979,
+1,30002,1,19993,1,19969,1,22825,
+1,22320,3,40,4352,41,3,40,
+4354,41,3,40,4355,41,3,40,
+4357,41,3,40,4358,41,3,40,
+4359,41,3,40,4361,41,3,40,
+4363,41,3,40,4364,41,3,40,
+4366,41,3,40,4367,41,3,40,
+4368,41,3,40,4369,41,3,40,
+4370,41,3,40,44032,41,3,40,
+45208,41,3,40,45796,41,3,40,
+46972,41,3,40,47560,41,3,40,
+48148,41,3,40,49324,41,3,40,
+50500,41,3,40,51088,41,3,40,
+52264,41,3,40,52852,41,3,40,
+53440,41,3,40,54028,41,3,40,
+54616,41,3,40,51452,41,4,40,
+50724,51204,41,4,40,50724,54980,41,
+3,40,19968,41,3,40,20108,41,
+3,40,19977,41,3,40,22235,41,
+3,40,20116,41,3,40,20845,41,
+3,40,19971,41,3,40,20843,41,
+3,40,20061,41,3,40,21313,41,
+3,40,26376,41,3,40,28779,41,
+3,40,27700,41,3,40,26408,41,
+3,40,37329,41,3,40,22303,41,
+3,40,26085,41,3,40,26666,41,
+3,40,26377,41,3,40,31038,41,
+3,40,21517,41,3,40,29305,41,
+3,40,36001,41,3,40,31069,41,
+3,40,21172,41,3,40,20195,41,
+3,40,21628,41,3,40,23398,41,
+3,40,30435,41,3,40,20225,41,
+3,40,36039,41,3,40,21332,41,
+3,40,31085,41,3,40,20241,41,
+3,40,33258,41,3,40,33267,41,
+1,21839,1,24188,1,31631,3,112,
+116,101,2,50,49,2,50,50,
+2,50,51,2,50,52,2,50,
+53,2,50,54,2,50,55,2,
+50,56,2,50,57,2,51,48,
+2,51,49,2,51,50,2,51,
+51,2,51,52,2,51,53,1,
+44032,1,45208,1,45796,1,46972,1,
+47560,1,48148,1,49324,1,50500,1,
+51088,1,52264,1,52852,1,53440,1,
+54028,1,54616,2,52280,44256,2,51452,
+51032,1,50864,1,20116,1,20845,1,
+19971,1,20061,1,26666,1,26377,1,
+31038,1,21517,1,29305,1,36001,1,
+31069,1,21172,1,31192,1,30007,1,
+36969,1,20778,1,21360,1,27880,1,
+38917,1,20241,1,20889,1,27491,1,
+24038,1,21491,1,21307,1,23447,1,
+23398,1,30435,1,20225,1,36039,1,
+21332,1,22812,2,51,54,2,51,
+55,2,51,56,2,51,57,2,
+52,48,2,52,49,2,52,50,
+2,52,51,2,52,52,2,52,
+53,2,52,54,2,52,55,2,
+52,56,2,52,57,2,53,48,
+2,49,26376,2,50,26376,2,51,
+26376,2,52,26376,2,53,26376,2,
+54,26376,2,55,26376,2,56,26376,
+2,57,26376,3,49,48,26376,3,
+49,49,26376,3,49,50,26376,2,
+104,103,3,101,114,103,2,101,
+118,3,108,116,100,1,12450,1,
+12452,1,12454,1,12456,1,12458,1,
+12459,1,12461,1,12463,1,12465,1,
+12467,1,12469,1,12471,1,12473,1,
+12475,1,12477,1,12479,1,12481,1,
+12484,1,12486,1,12488,1,12490,1,
+12491,1,12492,1,12493,1,12494,1,
+12495,1,12498,1,12501,1,12504,1,
+12507,1,12510,1,12511,1,12512,1,
+12513,1,12514,1,12516,1,12518,1,
+12520,1,12521,1,12522,1,12523,1,
+12524,1,12525,1,12527,1,12528,1,
+12529,1,12530,2,20196,21644,4,12450,
+12497,12540,12488,4,12450,12523,12501,12449,
+4,12450,12531,12506,12450,3,12450,12540,
+12523,4,12452,12491,12531,12464,3,12452,
+12531,12481,3,12454,12457,12531,5,12456,
+12473,12463,12540,12489,4,12456,12540,12459,
+12540,3,12458,12531,12473,3,12458,12540,
+12512,3,12459,12452,12522,4,12459,12521,
+12483,12488,4,12459,12525,12522,12540,3,
+12460,12525,12531,3,12460,12531,12510,2,
+12462,12460,3,12462,12491,12540,4,12461,
+12517,12522,12540,4,12462,12523,12480,12540,
+2,12461,12525,5,12461,12525,12464,12521,
+12512,6,12461,12525,12513,12540,12488,12523,
+5,12461,12525,12527,12483,12488,3,12464,
+12521,12512,5,12464,12521,12512,12488,12531,
+5,12463,12523,12476,12452,12525,4,12463,
+12525,12540,12493,3,12465,12540,12473,3,
+12467,12523,12490,3,12467,12540,12509,4,
+12469,12452,12463,12523,5,12469,12531,12481,
+12540,12512,4,12471,12522,12531,12464,3,
+12475,12531,12481,3,12475,12531,12488,3,
+12480,12540,12473,2,12487,12471,2,12489,
+12523,2,12488,12531,2,12490,12494,3,
+12494,12483,12488,3,12495,12452,12484,5,
+12497,12540,12475,12531,12488,3,12497,12540,
+12484,4,12496,12540,12524,12523,5,12500,
+12450,12473,12488,12523,3,12500,12463,12523,
+2,12500,12467,2,12499,12523,5,12501,
+12449,12521,12483,12489,4,12501,12451,12540,
+12488,5,12502,12483,12471,12455,12523,3,
+12501,12521,12531,5,12504,12463,12479,12540,
+12523,2,12506,12477,3,12506,12491,12498,
+3,12504,12523,12484,3,12506,12531,12473,
+3,12506,12540,12472,3,12505,12540,12479,
+4,12509,12452,12531,12488,3,12508,12523,
+12488,2,12507,12531,3,12509,12531,12489,
+3,12507,12540,12523,3,12507,12540,12531,
+4,12510,12452,12463,12525,3,12510,12452,
+12523,3,12510,12483,12495,3,12510,12523,
+12463,5,12510,12531,12471,12519,12531,4,
+12511,12463,12525,12531,2,12511,12522,5,
+12511,12522,12496,12540,12523,2,12513,12460,
+4,12513,12460,12488,12531,4,12513,12540,
+12488,12523,3,12516,12540,12489,3,12516,
+12540,12523,3,12518,12450,12531,4,12522,
+12483,12488,12523,2,12522,12521,3,12523,
+12500,12540,4,12523,12540,12502,12523,2,
+12524,12512,5,12524,12531,12488,12466,12531,
+3,12527,12483,12488,2,48,28857,2,
+49,28857,2,50,28857,2,51,28857,
+2,52,28857,2,53,28857,2,54,
+28857,2,55,28857,2,56,28857,2,
+57,28857,3,49,48,28857,3,49,
+49,28857,3,49,50,28857,3,49,
+51,28857,3,49,52,28857,3,49,
+53,28857,3,49,54,28857,3,49,
+55,28857,3,49,56,28857,3,49,
+57,28857,3,50,48,28857,3,50,
+49,28857,3,50,50,28857,3,50,
+51,28857,3,50,52,28857,3,104,
+112,97,2,100,97,2,97,117,
+3,98,97,114,2,111,118,2,
+112,99,2,100,109,3,100,109,
+50,3,100,109,51,2,105,117,
+2,24179,25104,2,26157,21644,2,22823,
+27491,2,26126,27835,4,26666,24335,20250,
+31038,2,112,97,2,110,97,2,
+956,97,2,109,97,2,107,97,
+2,107,98,2,109,98,2,103,
+98,3,99,97,108,4,107,99,
+97,108,2,112,102,2,110,102,
+2,956,102,2,956,103,2,109,
+103,2,107,103,2,104,122,3,
+107,104,122,3,109,104,122,3,
+103,104,122,3,116,104,122,2,
+956,108,2,109,108,2,100,108,
+2,107,108,2,102,109,2,110,
+109,2,956,109,2,109,109,2,
+99,109,2,107,109,3,109,109,
+50,3,99,109,50,2,109,50,
+3,107,109,50,3,109,109,51,
+3,99,109,51,2,109,51,3,
+107,109,51,3,109,8725,115,4,
+109,8725,115,50,3,107,112,97,
+3,109,112,97,3,103,112,97,
+3,114,97,100,5,114,97,100,
+8725,115,6,114,97,100,8725,115,
+50,2,112,115,2,110,115,2,
+956,115,2,109,115,2,112,118,
+2,110,118,2,956,118,2,109,
+118,2,107,118,2,112,119,2,
+110,119,2,956,119,2,109,119,
+2,107,119,2,107,969,2,109,
+969,4,97,46,109,46,2,98,
+113,2,99,99,2,99,100,4,
+99,8725,107,103,3,99,111,46,
+2,100,98,2,103,121,2,104,
+97,2,104,112,2,105,110,2,
+107,107,2,107,116,2,108,109,
+2,108,110,3,108,111,103,2,
+108,120,3,109,105,108,3,109,
+111,108,2,112,104,4,112,46,
+109,46,3,112,112,109,2,112,
+114,2,115,114,2,115,118,2,
+119,98,3,118,8725,109,3,97,
+8725,109,2,49,26085,2,50,26085,
+2,51,26085,2,52,26085,2,53,
+26085,2,54,26085,2,55,26085,2,
+56,26085,2,57,26085,3,49,48,
+26085,3,49,49,26085,3,49,50,
+26085,3,49,51,26085,3,49,52,
+26085,3,49,53,26085,3,49,54,
+26085,3,49,55,26085,3,49,56,
+26085,3,49,57,26085,3,50,48,
+26085,3,50,49,26085,3,50,50,
+26085,3,50,51,26085,3,50,52,
+26085,3,50,53,26085,3,50,54,
+26085,3,50,55,26085,3,50,56,
+26085,3,50,57,26085,3,51,48,
+26085,3,51,49,26085,3,103,97,
+108,1,42561,1,42563,1,42565,1,
+42567,1,42569,1,42573,1,42575,1,
+42577,1,42579,1,42581,1,42583,1,
+42585,1,42587,1,42589,1,42591,1,
+42593,1,42595,1,42597,1,42599,1,
+42601,1,42603,1,42605,1,42625,1,
+42627,1,42629,1,42631,1,42633,1,
+42635,1,42637,1,42639,1,42641,1,
+42643,1,42645,1,42647,1,42649,1,
+42651,1,42787,1,42789,1,42791,1,
+42793,1,42795,1,42797,1,42799,1,
+42803,1,42805,1,42807,1,42809,1,
+42811,1,42813,1,42815,1,42817,1,
+42819,1,42821,1,42823,1,42825,1,
+42827,1,42829,1,42831,1,42833,1,
+42835,1,42837,1,42839,1,42841,1,
+42843,1,42845,1,42847,1,42849,1,
+42851,1,42853,1,42855,1,42857,1,
+42859,1,42861,1,42863,1,42874,1,
+42876,1,7545,1,42879,1,42881,1,
+42883,1,42885,1,42887,1,42892,1,
+42897,1,42899,1,42903,1,42905,1,
+42907,1,42909,1,42911,1,42913,1,
+42915,1,42917,1,42919,1,42921,1,
+620,1,670,1,647,1,43859,1,
+42933,1,42935,1,42937,1,42939,1,
+42941,1,42943,1,42945,1,42947,1,
+42900,1,7566,1,42952,1,42954,1,
+42961,1,42967,1,42969,1,42998,1,
+43831,1,43858,1,653,1,5024,1,
+5025,1,5026,1,5027,1,5028,1,
+5029,1,5030,1,5031,1,5032,1,
+5033,1,5034,1,5035,1,5036,1,
+5037,1,5038,1,5039,1,5040,1,
+5041,1,5042,1,5043,1,5044,1,
+5045,1,5046,1,5047,1,5048,1,
+5049,1,5050,1,5051,1,5052,1,
+5053,1,5054,1,5055,1,5056,1,
+5057,1,5058,1,5059,1,5060,1,
+5061,1,5062,1,5063,1,5064,1,
+5065,1,5066,1,5067,1,5068,1,
+5069,1,5070,1,5071,1,5072,1,
+5073,1,5074,1,5075,1,5076,1,
+5077,1,5078,1,5079,1,5080,1,
+5081,1,5082,1,5083,1,5084,1,
+5085,1,5086,1,5087,1,5088,1,
+5089,1,5090,1,5091,1,5092,1,
+5093,1,5094,1,5095,1,5096,1,
+5097,1,5098,1,5099,1,5100,1,
+5101,1,5102,1,5103,1,35912,1,
+26356,1,36040,1,28369,1,20018,1,
+21477,1,22865,1,21895,1,22856,1,
+25078,1,30313,1,32645,1,34367,1,
+34746,1,35064,1,37007,1,27138,1,
+27931,1,28889,1,29662,1,33853,1,
+37226,1,39409,1,20098,1,21365,1,
+27396,1,29211,1,34349,1,40478,1,
+23888,1,28651,1,34253,1,35172,1,
+25289,1,33240,1,34847,1,24266,1,
+26391,1,28010,1,29436,1,37070,1,
+20358,1,20919,1,21214,1,25796,1,
+27347,1,29200,1,30439,1,34310,1,
+34396,1,36335,1,38706,1,39791,1,
+40442,1,30860,1,31103,1,32160,1,
+33737,1,37636,1,35542,1,22751,1,
+24324,1,31840,1,32894,1,29282,1,
+30922,1,36034,1,38647,1,22744,1,
+23650,1,27155,1,28122,1,28431,1,
+32047,1,32311,1,38475,1,21202,1,
+32907,1,20956,1,20940,1,31260,1,
+32190,1,33777,1,38517,1,35712,1,
+25295,1,35582,1,20025,1,23527,1,
+24594,1,29575,1,30064,1,21271,1,
+30971,1,20415,1,24489,1,19981,1,
+27852,1,25976,1,32034,1,21443,1,
+22622,1,30465,1,33865,1,35498,1,
+27578,1,27784,1,25342,1,33509,1,
+25504,1,30053,1,20142,1,20841,1,
+20937,1,26753,1,31975,1,33391,1,
+35538,1,37327,1,21237,1,21570,1,
+24300,1,26053,1,28670,1,31018,1,
+38317,1,39530,1,40599,1,40654,1,
+26310,1,27511,1,36706,1,24180,1,
+24976,1,25088,1,25754,1,28451,1,
+29001,1,29833,1,31178,1,32244,1,
+32879,1,36646,1,34030,1,36899,1,
+37706,1,21015,1,21155,1,21693,1,
+28872,1,35010,1,24265,1,24565,1,
+25467,1,27566,1,31806,1,29557,1,
+20196,1,22265,1,23994,1,24604,1,
+29618,1,29801,1,32666,1,32838,1,
+37428,1,38646,1,38728,1,38936,1,
+20363,1,31150,1,37300,1,38584,1,
+24801,1,20102,1,20698,1,23534,1,
+23615,1,26009,1,29134,1,30274,1,
+34044,1,36988,1,26248,1,38446,1,
+21129,1,26491,1,26611,1,27969,1,
+28316,1,29705,1,30041,1,30827,1,
+32016,1,39006,1,25134,1,38520,1,
+20523,1,23833,1,28138,1,36650,1,
+24459,1,24900,1,26647,1,38534,1,
+21033,1,21519,1,23653,1,26131,1,
+26446,1,26792,1,27877,1,29702,1,
+30178,1,32633,1,35023,1,35041,1,
+38626,1,21311,1,28346,1,21533,1,
+29136,1,29848,1,34298,1,38563,1,
+40023,1,40607,1,26519,1,28107,1,
+33256,1,31520,1,31890,1,29376,1,
+28825,1,35672,1,20160,1,33590,1,
+21050,1,20999,1,24230,1,25299,1,
+31958,1,23429,1,27934,1,26292,1,
+36667,1,38477,1,24275,1,20800,1,
+21952,1,22618,1,26228,1,20958,1,
+29482,1,30410,1,31036,1,31070,1,
+31077,1,31119,1,38742,1,31934,1,
+34322,1,35576,1,36920,1,37117,1,
+39151,1,39164,1,39208,1,40372,1,
+37086,1,38583,1,20398,1,20711,1,
+20813,1,21193,1,21220,1,21329,1,
+21917,1,22022,1,22120,1,22592,1,
+22696,1,23652,1,24724,1,24936,1,
+24974,1,25074,1,25935,1,26082,1,
+26257,1,26757,1,28023,1,28186,1,
+28450,1,29038,1,29227,1,29730,1,
+30865,1,31049,1,31048,1,31056,1,
+31062,1,31117,1,31118,1,31296,1,
+31361,1,31680,1,32265,1,32321,1,
+32626,1,32773,1,33261,1,33401,1,
+33879,1,35088,1,35222,1,35585,1,
+35641,1,36051,1,36104,1,36790,1,
+38627,1,38911,1,38971,1,24693,1,
+148206,1,33304,1,20006,1,20917,1,
+20840,1,20352,1,20805,1,20864,1,
+21191,1,21242,1,21845,1,21913,1,
+21986,1,22707,1,22852,1,22868,1,
+23138,1,23336,1,24274,1,24281,1,
+24425,1,24493,1,24792,1,24910,1,
+24840,1,24928,1,25140,1,25540,1,
+25628,1,25682,1,25942,1,26395,1,
+26454,1,28379,1,28363,1,28702,1,
+30631,1,29237,1,29359,1,29809,1,
+29958,1,30011,1,30237,1,30239,1,
+30427,1,30452,1,30538,1,30528,1,
+30924,1,31409,1,31867,1,32091,1,
+32574,1,33618,1,33775,1,34681,1,
+35137,1,35206,1,35519,1,35531,1,
+35565,1,35722,1,36664,1,36978,1,
+37273,1,37494,1,38524,1,38875,1,
+38923,1,39698,1,141386,1,141380,1,
+144341,1,15261,1,16408,1,16441,1,
+152137,1,154832,1,163539,1,40771,1,
+40846,2,102,102,2,102,105,2,
+102,108,3,102,102,105,3,102,
+102,108,2,115,116,2,1396,1398,
+2,1396,1381,2,1396,1387,2,1406,
+1398,2,1396,1389,2,1497,1460,2,
+1522,1463,1,1506,1,1492,1,1499,
+1,1500,1,1501,1,1512,1,1514,
+2,1513,1473,2,1513,1474,3,1513,
+1468,1473,3,1513,1468,1474,2,1488,
+1463,2,1488,1464,2,1488,1468,2,
+1489,1468,2,1490,1468,2,1491,1468,
+2,1492,1468,2,1493,1468,2,1494,
+1468,2,1496,1468,2,1497,1468,2,
+1498,1468,2,1499,1468,2,1500,1468,
+2,1502,1468,2,1504,1468,2,1505,
+1468,2,1507,1468,2,1508,1468,2,
+1510,1468,2,1511,1468,2,1512,1468,
+2,1513,1468,2,1514,1468,2,1493,
+1465,2,1489,1471,2,1499,1471,2,
+1508,1471,2,1488,1500,1,1649,1,
+1659,1,1662,1,1664,1,1658,1,
+1663,1,1657,1,1700,1,1702,1,
+1668,1,1667,1,1670,1,1671,1,
+1677,1,1676,1,1678,1,1672,1,
+1688,1,1681,1,1705,1,1711,1,
+1715,1,1713,1,1722,1,1723,1,
+1728,1,1729,1,1726,1,1746,1,
+1747,1,1709,1,1735,1,1734,1,
+1736,1,1739,1,1733,1,1737,1,
+1744,1,1609,2,1574,1575,2,1574,
+1749,2,1574,1608,2,1574,1735,2,
+1574,1734,2,1574,1736,2,1574,1744,
+2,1574,1609,1,1740,2,1574,1580,
+2,1574,1581,2,1574,1605,2,1574,
+1610,2,1576,1580,2,1576,1581,2,
+1576,1582,2,1576,1605,2,1576,1609,
+2,1576,1610,2,1578,1580,2,1578,
+1581,2,1578,1582,2,1578,1605,2,
+1578,1609,2,1578,1610,2,1579,1580,
+2,1579,1605,2,1579,1609,2,1579,
+1610,2,1580,1581,2,1580,1605,2,
+1581,1580,2,1581,1605,2,1582,1580,
+2,1582,1581,2,1582,1605,2,1587,
+1580,2,1587,1581,2,1587,1582,2,
+1587,1605,2,1589,1581,2,1589,1605,
+2,1590,1580,2,1590,1581,2,1590,
+1582,2,1590,1605,2,1591,1581,2,
+1591,1605,2,1592,1605,2,1593,1580,
+2,1593,1605,2,1594,1580,2,1594,
+1605,2,1601,1580,2,1601,1581,2,
+1601,1582,2,1601,1605,2,1601,1609,
+2,1601,1610,2,1602,1581,2,1602,
+1605,2,1602,1609,2,1602,1610,2,
+1603,1575,2,1603,1580,2,1603,1581,
+2,1603,1582,2,1603,1604,2,1603,
+1605,2,1603,1609,2,1603,1610,2,
+1604,1580,2,1604,1581,2,1604,1582,
+2,1604,1605,2,1604,1609,2,1604,
+1610,2,1605,1580,2,1605,1581,2,
+1605,1582,2,1605,1605,2,1605,1609,
+2,1605,1610,2,1606,1580,2,1606,
+1581,2,1606,1582,2,1606,1605,2,
+1606,1609,2,1606,1610,2,1607,1580,
+2,1607,1605,2,1607,1609,2,1607,
+1610,2,1610,1580,2,1610,1581,2,
+1610,1582,2,1610,1605,2,1610,1609,
+2,1610,1610,2,1584,1648,2,1585,
+1648,2,1609,1648,3,32,1612,1617,
+3,32,1613,1617,3,32,1614,1617,
+3,32,1615,1617,3,32,1616,1617,
+3,32,1617,1648,2,1574,1585,2,
+1574,1586,2,1574,1606,2,1576,1585,
+2,1576,1586,2,1576,1606,2,1578,
+1585,2,1578,1586,2,1578,1606,2,
+1579,1585,2,1579,1586,2,1579,1606,
+2,1605,1575,2,1606,1585,2,1606,
+1586,2,1606,1606,2,1610,1585,2,
+1610,1586,2,1610,1606,2,1574,1582,
+2,1574,1607,2,1576,1607,2,1578,
+1607,2,1589,1582,2,1604,1607,2,
+1606,1607,2,1607,1648,2,1610,1607,
+2,1579,1607,2,1587,1607,2,1588,
+1605,2,1588,1607,3,1600,1614,1617,
+3,1600,1615,1617,3,1600,1616,1617,
+2,1591,1609,2,1591,1610,2,1593,
+1609,2,1593,1610,2,1594,1609,2,
+1594,1610,2,1587,1609,2,1587,1610,
+2,1588,1609,2,1588,1610,2,1581,
+1609,2,1581,1610,2,1580,1609,2,
+1580,1610,2,1582,1609,2,1582,1610,
+2,1589,1609,2,1589,1610,2,1590,
+1609,2,1590,1610,2,1588,1580,2,
+1588,1581,2,1588,1582,2,1588,1585,
+2,1587,1585,2,1589,1585,2,1590,
+1585,2,1575,1611,3,1578,1580,1605,
+3,1578,1581,1580,3,1578,1581,1605,
+3,1578,1582,1605,3,1578,1605,1580,
+3,1578,1605,1581,3,1578,1605,1582,
+3,1580,1605,1581,3,1581,1605,1610,
+3,1581,1605,1609,3,1587,1581,1580,
+3,1587,1580,1581,3,1587,1580,1609,
+3,1587,1605,1581,3,1587,1605,1580,
+3,1587,1605,1605,3,1589,1581,1581,
+3,1589,1605,1605,3,1588,1581,1605,
+3,1588,1580,1610,3,1588,1605,1582,
+3,1588,1605,1605,3,1590,1581,1609,
+3,1590,1582,1605,3,1591,1605,1581,
+3,1591,1605,1605,3,1591,1605,1610,
+3,1593,1580,1605,3,1593,1605,1605,
+3,1593,1605,1609,3,1594,1605,1605,
+3,1594,1605,1610,3,1594,1605,1609,
+3,1601,1582,1605,3,1602,1605,1581,
+3,1602,1605,1605,3,1604,1581,1605,
+3,1604,1581,1610,3,1604,1581,1609,
+3,1604,1580,1580,3,1604,1582,1605,
+3,1604,1605,1581,3,1605,1581,1580,
+3,1605,1581,1605,3,1605,1581,1610,
+3,1605,1580,1581,3,1605,1580,1605,
+3,1605,1582,1580,3,1605,1582,1605,
+3,1605,1580,1582,3,1607,1605,1580,
+3,1607,1605,1605,3,1606,1581,1605,
+3,1606,1581,1609,3,1606,1580,1605,
+3,1606,1580,1609,3,1606,1605,1610,
+3,1606,1605,1609,3,1610,1605,1605,
+3,1576,1582,1610,3,1578,1580,1610,
+3,1578,1580,1609,3,1578,1582,1610,
+3,1578,1582,1609,3,1578,1605,1610,
+3,1578,1605,1609,3,1580,1605,1610,
+3,1580,1581,1609,3,1580,1605,1609,
+3,1587,1582,1609,3,1589,1581,1610,
+3,1588,1581,1610,3,1590,1581,1610,
+3,1604,1580,1610,3,1604,1605,1610,
+3,1610,1581,1610,3,1610,1580,1610,
+3,1610,1605,1610,3,1605,1605,1610,
+3,1602,1605,1610,3,1606,1581,1610,
+3,1593,1605,1610,3,1603,1605,1610,
+3,1606,1580,1581,3,1605,1582,1610,
+3,1604,1580,1605,3,1603,1605,1605,
+3,1580,1581,1610,3,1581,1580,1610,
+3,1605,1580,1610,3,1601,1605,1610,
+3,1576,1581,1610,3,1587,1582,1610,
+3,1606,1580,1610,3,1589,1604,1746,
+3,1602,1604,1746,4,1575,1604,1604,
+1607,4,1575,1603,1576,1585,4,1605,
+1581,1605,1583,4,1589,1604,1593,1605,
+4,1585,1587,1608,1604,4,1593,1604,
+1610,1607,4,1608,1587,1604,1605,3,
+1589,1604,1609,18,1589,1604,1609,32,
+1575,1604,1604,1607,32,1593,1604,1610,
+1607,32,1608,1587,1604,1605,8,1580,
+1604,32,1580,1604,1575,1604,1607,4,
+1585,1740,1575,1604,1,44,1,12289,
+1,12290,1,58,1,33,1,63,
+1,12310,1,12311,1,8212,1,8211,
+1,95,1,123,1,125,1,12308,
+1,12309,1,12304,1,12305,1,12298,
+1,12299,1,12300,1,12301,1,12302,
+1,12303,1,91,1,93,1,35,
+1,38,1,42,1,45,1,60,
+1,62,1,92,1,36,1,37,
+1,64,2,32,1611,2,1600,1611,
+2,32,1612,2,32,1613,2,32,
+1614,2,1600,1614,2,32,1615,2,
+1600,1615,2,32,1616,2,1600,1616,
+2,32,1617,2,1600,1617,2,32,
+1618,2,1600,1618,1,1569,1,1570,
+1,1571,1,1572,1,1573,1,1574,
+1,1575,1,1576,1,1577,1,1578,
+1,1579,1,1580,1,1581,1,1582,
+1,1583,1,1584,1,1585,1,1586,
+1,1587,1,1588,1,1589,1,1590,
+1,1591,1,1592,1,1593,1,1594,
+1,1601,1,1602,1,1603,1,1604,
+1,1605,1,1606,1,1607,1,1608,
+1,1610,2,1604,1570,2,1604,1571,
+2,1604,1573,2,1604,1575,1,34,
+1,39,1,47,1,94,1,124,
+1,126,1,10629,1,10630,1,12539,
+1,12449,1,12451,1,12453,1,12455,
+1,12457,1,12515,1,12517,1,12519,
+1,12483,1,12540,1,12531,1,12441,
+1,12442,1,162,1,163,1,172,
+1,166,1,165,1,8361,1,9474,
+1,8592,1,8593,1,8594,1,8595,
+1,9632,1,9675,1,66600,1,66601,
+1,66602,1,66603,1,66604,1,66605,
+1,66606,1,66607,1,66608,1,66609,
+1,66610,1,66611,1,66612,1,66613,
+1,66614,1,66615,1,66616,1,66617,
+1,66618,1,66619,1,66620,1,66621,
+1,66622,1,66623,1,66624,1,66625,
+1,66626,1,66627,1,66628,1,66629,
+1,66630,1,66631,1,66632,1,66633,
+1,66634,1,66635,1,66636,1,66637,
+1,66638,1,66639,1,66776,1,66777,
+1,66778,1,66779,1,66780,1,66781,
+1,66782,1,66783,1,66784,1,66785,
+1,66786,1,66787,1,66788,1,66789,
+1,66790,1,66791,1,66792,1,66793,
+1,66794,1,66795,1,66796,1,66797,
+1,66798,1,66799,1,66800,1,66801,
+1,66802,1,66803,1,66804,1,66805,
+1,66806,1,66807,1,66808,1,66809,
+1,66810,1,66811,1,66967,1,66968,
+1,66969,1,66970,1,66971,1,66972,
+1,66973,1,66974,1,66975,1,66976,
+1,66977,1,66979,1,66980,1,66981,
+1,66982,1,66983,1,66984,1,66985,
+1,66986,1,66987,1,66988,1,66989,
+1,66990,1,66991,1,66992,1,66993,
+1,66995,1,66996,1,66997,1,66998,
+1,66999,1,67000,1,67001,1,67003,
+1,67004,1,720,1,721,1,665,
+1,675,1,43878,1,677,1,676,
+1,7569,1,600,1,606,1,681,
+1,612,1,610,1,667,1,668,
+1,615,1,644,1,682,1,683,
+1,122628,1,42894,1,622,1,122629,
+1,654,1,122630,1,630,1,631,
+1,634,1,122632,1,638,1,680,
+1,678,1,43879,1,679,1,11377,
+1,655,1,673,1,674,1,664,
+1,448,1,449,1,450,1,122634,
+1,122654,1,68800,1,68801,1,68802,
+1,68803,1,68804,1,68805,1,68806,
+1,68807,1,68808,1,68809,1,68810,
+1,68811,1,68812,1,68813,1,68814,
+1,68815,1,68816,1,68817,1,68818,
+1,68819,1,68820,1,68821,1,68822,
+1,68823,1,68824,1,68825,1,68826,
+1,68827,1,68828,1,68829,1,68830,
+1,68831,1,68832,1,68833,1,68834,
+1,68835,1,68836,1,68837,1,68838,
+1,68839,1,68840,1,68841,1,68842,
+1,68843,1,68844,1,68845,1,68846,
+1,68847,1,68848,1,68849,1,68850,
+1,71872,1,71873,1,71874,1,71875,
+1,71876,1,71877,1,71878,1,71879,
+1,71880,1,71881,1,71882,1,71883,
+1,71884,1,71885,1,71886,1,71887,
+1,71888,1,71889,1,71890,1,71891,
+1,71892,1,71893,1,71894,1,71895,
+1,71896,1,71897,1,71898,1,71899,
+1,71900,1,71901,1,71902,1,71903,
+1,93792,1,93793,1,93794,1,93795,
+1,93796,1,93797,1,93798,1,93799,
+1,93800,1,93801,1,93802,1,93803,
+1,93804,1,93805,1,93806,1,93807,
+1,93808,1,93809,1,93810,1,93811,
+1,93812,1,93813,1,93814,1,93815,
+1,93816,1,93817,1,93818,1,93819,
+1,93820,1,93821,1,93822,1,93823,
+2,119127,119141,2,119128,119141,3,119128,
+119141,119150,3,119128,119141,119151,3,119128,
+119141,119152,3,119128,119141,119153,3,119128,
+119141,119154,2,119225,119141,2,119226,119141,
+3,119225,119141,119150,3,119226,119141,119150,
+3,119225,119141,119151,3,119226,119141,119151,
+1,305,1,567,1,8711,1,8706,
+1,125218,1,125219,1,125220,1,125221,
+1,125222,1,125223,1,125224,1,125225,
+1,125226,1,125227,1,125228,1,125229,
+1,125230,1,125231,1,125232,1,125233,
+1,125234,1,125235,1,125236,1,125237,
+1,125238,1,125239,1,125240,1,125241,
+1,125242,1,125243,1,125244,1,125245,
+1,125246,1,125247,1,125248,1,125249,
+1,125250,1,125251,1,1646,1,1697,
+1,1647,2,48,46,2,48,44,
+2,49,44,2,50,44,2,51,
+44,2,52,44,2,53,44,2,
+54,44,2,55,44,2,56,44,
+2,57,44,3,12308,115,12309,2,
+119,122,2,104,118,2,115,100,
+3,112,112,118,2,119,99,2,
+109,99,2,109,100,2,109,114,
+2,100,106,2,12411,12363,2,12467,
+12467,1,23383,1,21452,1,12487,1,
+22810,1,35299,1,20132,1,26144,1,
+28961,1,21069,1,24460,1,20877,1,
+26032,1,21021,1,32066,1,36009,1,
+22768,1,21561,1,28436,1,25237,1,
+25429,1,36938,1,25351,1,25171,1,
+31105,1,31354,1,21512,1,28288,1,
+30003,1,21106,1,21942,1,37197,3,
+12308,26412,12309,3,12308,19977,12309,3,
+12308,20108,12309,3,12308,23433,12309,3,
+12308,28857,12309,3,12308,25171,12309,3,
+12308,30423,12309,3,12308,21213,12309,3,
+12308,25943,12309,1,24471,1,21487,1,
+20029,1,20024,1,20033,1,131362,1,
+20320,1,20411,1,20482,1,20602,1,
+20633,1,20687,1,13470,1,132666,1,
+20820,1,20836,1,20855,1,132380,1,
+13497,1,20839,1,132427,1,20887,1,
+20900,1,20172,1,20908,1,168415,1,
+20995,1,13535,1,21051,1,21062,1,
+21111,1,13589,1,21253,1,21254,1,
+21321,1,21338,1,21363,1,21373,1,
+21375,1,133676,1,28784,1,21450,1,
+21471,1,133987,1,21483,1,21489,1,
+21510,1,21662,1,21560,1,21576,1,
+21608,1,21666,1,21750,1,21776,1,
+21843,1,21859,1,21892,1,21931,1,
+21939,1,21954,1,22294,1,22295,1,
+22097,1,22132,1,22766,1,22478,1,
+22516,1,22541,1,22411,1,22578,1,
+22577,1,22700,1,136420,1,22770,1,
+22775,1,22790,1,22818,1,22882,1,
+136872,1,136938,1,23020,1,23067,1,
+23079,1,23000,1,23142,1,14062,1,
+14076,1,23304,1,23358,1,137672,1,
+23491,1,23512,1,23539,1,138008,1,
+23551,1,23558,1,24403,1,14209,1,
+23648,1,23744,1,23693,1,138724,1,
+23875,1,138726,1,23918,1,23915,1,
+23932,1,24033,1,24034,1,14383,1,
+24061,1,24104,1,24125,1,24169,1,
+14434,1,139651,1,14460,1,24240,1,
+24243,1,24246,1,172946,1,140081,1,
+33281,1,24354,1,14535,1,144056,1,
+156122,1,24418,1,24427,1,14563,1,
+24474,1,24525,1,24535,1,24569,1,
+24705,1,14650,1,14620,1,141012,1,
+24775,1,24904,1,24908,1,24954,1,
+25010,1,24996,1,25007,1,25054,1,
+25104,1,25115,1,25181,1,25265,1,
+25300,1,25424,1,142092,1,25405,1,
+25340,1,25448,1,25475,1,25572,1,
+142321,1,25634,1,25541,1,25513,1,
+14894,1,25705,1,25726,1,25757,1,
+25719,1,14956,1,25964,1,143370,1,
+26083,1,26360,1,26185,1,15129,1,
+15112,1,15076,1,20882,1,20885,1,
+26368,1,26268,1,32941,1,17369,1,
+26401,1,26462,1,26451,1,144323,1,
+15177,1,26618,1,26501,1,26706,1,
+144493,1,26766,1,26655,1,26900,1,
+26946,1,27043,1,27114,1,27304,1,
+145059,1,27355,1,15384,1,27425,1,
+145575,1,27476,1,15438,1,27506,1,
+27551,1,27579,1,146061,1,138507,1,
+146170,1,27726,1,146620,1,27839,1,
+27853,1,27751,1,27926,1,27966,1,
+28009,1,28024,1,28037,1,146718,1,
+27956,1,28207,1,28270,1,15667,1,
+28359,1,147153,1,28153,1,28526,1,
+147294,1,147342,1,28614,1,28729,1,
+28699,1,15766,1,28746,1,28797,1,
+28791,1,28845,1,132389,1,28997,1,
+148067,1,29084,1,148395,1,29224,1,
+29264,1,149000,1,29312,1,29333,1,
+149301,1,149524,1,29562,1,29579,1,
+16044,1,29605,1,16056,1,29767,1,
+29788,1,29829,1,29898,1,16155,1,
+29988,1,150582,1,30014,1,150674,1,
+139679,1,30224,1,151457,1,151480,1,
+151620,1,16380,1,16392,1,151795,1,
+151794,1,151833,1,151859,1,30494,1,
+30495,1,30603,1,16454,1,16534,1,
+152605,1,30798,1,16611,1,153126,1,
+153242,1,153285,1,31211,1,16687,1,
+31306,1,31311,1,153980,1,154279,1,
+31470,1,16898,1,154539,1,31686,1,
+31689,1,16935,1,154752,1,31954,1,
+17056,1,31976,1,31971,1,32000,1,
+155526,1,32099,1,17153,1,32199,1,
+32258,1,32325,1,17204,1,156200,1,
+156231,1,17241,1,156377,1,32634,1,
+156478,1,32661,1,32762,1,156890,1,
+156963,1,32864,1,157096,1,32880,1,
+144223,1,17365,1,32946,1,33027,1,
+17419,1,33086,1,23221,1,157607,1,
+157621,1,144275,1,144284,1,33284,1,
+36766,1,17515,1,33425,1,33419,1,
+33437,1,21171,1,33457,1,33459,1,
+33469,1,33510,1,158524,1,33565,1,
+33635,1,33709,1,33571,1,33725,1,
+33767,1,33619,1,33738,1,33740,1,
+33756,1,158774,1,159083,1,158933,1,
+17707,1,34033,1,34035,1,34070,1,
+160714,1,34148,1,159532,1,17757,1,
+17761,1,159665,1,159954,1,17771,1,
+34384,1,34407,1,34409,1,34473,1,
+34440,1,34574,1,34530,1,34600,1,
+34667,1,34694,1,17879,1,34785,1,
+34817,1,17913,1,34912,1,161383,1,
+35031,1,35038,1,17973,1,35066,1,
+13499,1,161966,1,162150,1,18110,1,
+18119,1,35488,1,162984,1,36011,1,
+36033,1,36123,1,36215,1,163631,1,
+133124,1,36299,1,36284,1,36336,1,
+133342,1,36564,1,165330,1,165357,1,
+37012,1,37105,1,37137,1,165678,1,
+37147,1,37432,1,37591,1,37592,1,
+37500,1,37881,1,37909,1,166906,1,
+38283,1,18837,1,38327,1,167287,1,
+18918,1,38595,1,23986,1,38691,1,
+168261,1,168474,1,19054,1,19062,1,
+38880,1,168970,1,19122,1,169110,1,
+38953,1,169398,1,39138,1,19251,1,
+39209,1,39335,1,39362,1,39422,1,
+19406,1,170800,1,40000,1,40189,1,
+19662,1,19693,1,40295,1,172238,1,
+19704,1,172293,1,172558,1,172689,1,
+19798,1,40702,1,40709,1,40719,1,
+40726,1,173568};
+
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 uaix_const_data uaix_data_array(unsigned char, stage1_comp_cp1, 8704) = {
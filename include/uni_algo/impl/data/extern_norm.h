@@ -11,6 +11,9 @@ UNI_ALGO_DLL extern const uaix_data_array(type_codept,    stage3_decomp_nfd, 546
 UNI_ALGO_DLL extern const uaix_data_array(unsigned char,  stage1_decomp_nfkd, 8704);
 UNI_ALGO_DLL extern const uaix_data_array(unsigned short, stage2_decomp_nfkd, 13568);
 UNI_ALGO_DLL extern const uaix_data_array(type_codept,    stage3_decomp_nfkd, 14970);
+UNI_ALGO_DLL extern const uaix_data_array(unsigned char,  stage1_nfkc_cf, 8704);
+UNI_ALGO_DLL extern const uaix_data_array(unsigned short, stage2_nfkc_cf, 14208);
+UNI_ALGO_DLL extern const uaix_data_array(type_codept,    stage3_nfkc_cf, 9427);
 #endif
 UNI_ALGO_DLL extern const uaix_data_array(unsigned char,  stage1_comp_cp1, 8704);
 UNI_ALGO_DLL extern const uaix_data_array(unsigned short, stage2_comp_cp1, 4736);
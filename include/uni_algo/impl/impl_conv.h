@@ -5,6 +5,8 @@
 #ifndef UNI_ALGO_IMPL_CONV_H_UAIH
 #define UNI_ALGO_IMPL_CONV_H_UAIH
 
+#include "impl_iter.h"
+
 #include "internal_defines.h"
 
 UNI_ALGO_IMPL_NAMESPACE_BEGIN
@@ -17,6 +19,40 @@ uaix_const size_t impl_x_utf8to32  = 1; // tag_unicode_stable_value
 uaix_const size_t impl_x_utf32to8  = 4; // tag_unicode_stable_value
 uaix_const size_t impl_x_utf16to32 = 1; // tag_unicode_stable_value
 uaix_const size_t impl_x_utf32to16 = 2; // tag_unicode_stable_value
+uaix_const size_t impl_x_utf8to8   = 3; // tag_unicode_stable_value
+// UTF-16BE/LE and UTF-32BE/LE bytes to UTF-8, the source length is in bytes
+// 3 because an incomplete code unit at the end (1 byte) is replaced with U+FFFD (3 bytes)
+uaix_const size_t impl_x_utf16bytes_to8 = 3; // tag_unicode_stable_value
+uaix_const size_t impl_x_utf32bytes_to8 = 3; // tag_unicode_stable_value
+// The same but to UTF-16, 2 or 4 bytes are never more than 2 code units
+// and an incomplete code unit at the end is replaced with one U+FFFD
+uaix_const size_t impl_x_utf16bytes_to16 = 1; // tag_unicode_stable_value
+uaix_const size_t impl_x_utf32bytes_to16 = 1; // tag_unicode_stable_value
+// The same but for the error policies other than the default replacement (see below)
+// the worst case is the escape policy: \xNN for every code unit of UTF-8, \xNNNN for UTF-16
+// and \xNNNNNNNN for UTF-32, a replacement code point needs less or the same.
+uaix_const size_t impl_x_utf8to16_policy  = 4;
+uaix_const size_t impl_x_utf16to8_policy  = 6;
+uaix_const size_t impl_x_utf8to32_policy  = 4;
+uaix_const size_t impl_x_utf32to8_policy  = 10;
+uaix_const size_t impl_x_utf16to32_policy = 6;
+uaix_const size_t impl_x_utf32to16_policy = 10;
+
+// Error policies for the conversion functions, in C++ it is a template parameter of the functions.
+// Any code point except surrogates means replace every ill-formed sequence with the code point,
+// the other values are outside of Unicode range. Note that the policy is ignored in strict mode
+// (when error is used) and the functions always stop at the first ill-formed sequence then.
+uaix_const type_codept impl_conv_replace = 0xFFFD;     // Replace with U+FFFD (default)
+uaix_const type_codept impl_conv_skip    = 0xFFFFFFFC; // Drop ill-formed sequences
+uaix_const type_codept impl_conv_escape  = 0xFFFFFFFD; // Escape every code unit of ill-formed sequences as \xNN
+uaix_const type_codept impl_conv_stop    = 0xFFFFFFFE; // Stop at the first ill-formed sequence
+
+// The fast functions below stop at ASCII that is mixed with other sequences
+// because the main loops of the conversion functions are faster for such text.
+// The main loop stops calling a fast function after this number of calls in a row
+// that processed less than impl_fast_run code units so such text is not slower.
+uaix_const size_t impl_fast_attempts = 8;
+uaix_const size_t impl_fast_run = 32;
 
 // Forward declaration for fast ASCII functions
 #ifdef __cplusplus
@@ -29,9 +65,132 @@ template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32>
 #endif
 uaix_always_inline_tmpl
 uaix_static bool fast_ascii_utf8to32(it_in_utf8* s, it_end_utf8 last, it_out_utf32* dst);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf8to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_valid_utf8(it_in_utf8* s, it_end_utf8 last);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf8to8(it_in_utf8* s, it_end_utf8 last, it_out_utf8* dst);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_length_utf8(it_in_utf8* s, it_end_utf8 last, size_t* count, size_t* pairs);
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16to8(it_in_utf16* s, it_end_utf16 last, it_out_utf8* dst);
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_ascii_utf32to8(it_in_utf32* s, it_end_utf32 last, it_out_utf8* dst);
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf32>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16to32(it_in_utf16* s, it_end_utf16 last, it_out_utf32* dst);
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf32to16(it_in_utf32* s, it_end_utf32 last, it_out_utf16* dst);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16bytes_to8(it_in_utf8* s, it_end_utf8 last, it_out_utf8* dst, bool big_endian);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf32bytes_to8(it_in_utf8* s, it_end_utf8 last, it_out_utf8* dst, bool big_endian);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16bytes_to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst, bool big_endian);
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf32bytes_to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst, bool big_endian);
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16, bool contiguous = true>
+template<typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf8 conv_escape_utf8(type_codept u, size_t digits, it_out_utf8 dst)
+{
+    // Escape a code unit of ill-formed sequence as \x and 2, 4 or 8 uppercase hex digits
+
+    *dst++ = (type_char8)0x5C; // Backslash
+    *dst++ = (type_char8)0x78; // Small letter x
+
+    while (digits)
+    {
+        --digits;
+        const type_codept d = (u >> (digits * 4)) & 0xF;
+        *dst++ = (type_char8)(d < 10 ? 0x30 + d : 0x37 + d); // 0-9 or A-F
+    }
+
+    return dst;
+}
+
+#ifdef __cplusplus
+template<typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf16 conv_escape_utf16(type_codept u, size_t digits, it_out_utf16 dst)
+{
+    // Escape a code unit of ill-formed sequence as \x and 2, 4 or 8 uppercase hex digits
+
+    *dst++ = (type_char16)0x5C; // Backslash
+    *dst++ = (type_char16)0x78; // Small letter x
+
+    while (digits)
+    {
+        --digits;
+        const type_codept d = (u >> (digits * 4)) & 0xF;
+        *dst++ = (type_char16)(d < 10 ? 0x30 + d : 0x37 + d); // 0-9 or A-F
+    }
+
+    return dst;
+}
+
+#ifdef __cplusplus
+template<typename it_out_utf32>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf32 conv_escape_utf32(type_codept u, size_t digits, it_out_utf32 dst)
+{
+    // Escape a code unit of ill-formed sequence as \x and 2, 4 or 8 uppercase hex digits
+
+    *dst++ = (type_char32)0x5C; // Backslash
+    *dst++ = (type_char32)0x78; // Small letter x
+
+    while (digits)
+    {
+        --digits;
+        const type_codept d = (u >> (digits * 4)) & 0xF;
+        *dst++ = (type_char32)(d < 10 ? 0x30 + d : 0x37 + d); // 0-9 or A-F
+    }
+
+    return dst;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16, bool contiguous = true, type_codept policy = impl_conv_replace>
 #endif
 uaix_static size_t impl_utf8to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, size_t* const error)
 {
@@ -66,6 +225,7 @@ uaix_static size_t impl_utf8to16(it_in_utf8 first, it_end_utf8 last, it_out_utf1
     it_in_utf8 s = first;
     it_in_utf8 prev = s;
     it_out_utf16 dst = result;
+    size_t fast_fails = 0; // See impl_fast_attempts
 
 #ifdef __cplusplus
     if constexpr (contiguous)
@@ -74,6 +234,21 @@ uaix_static size_t impl_utf8to16(it_in_utf8 first, it_end_utf8 last, it_out_utf1
 
     while (s != last)
     {
+        // Decode well-formed 1-3 byte sequences without end checks while possible
+        // the loop below only handles 4-byte sequences, errors, mixed ASCII and the tail then.
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_fails < impl_fast_attempts)
+            {
+                const it_in_utf8 from = s;
+                if (fast_utf8to16(&s, last, &dst) && s == last)
+                    break;
+                fast_fails = ((size_t)(s - from) < impl_fast_run) ? fast_fails + 1 : 0;
+            }
+        }
+
         type_codept c = (*s & 0xFF), c2 = 0, c3 = 0, c4 = 0; // c2, c3, c4 tag_can_be_uninitialized
         prev = s; // Save previous position for error
 
@@ -84,6 +259,8 @@ uaix_static size_t impl_utf8to16(it_in_utf8 first, it_end_utf8 last, it_out_utf1
             // It is possible to use the fast ASCII function here instead of before the main loop
             // but it can degrade the performance of UTF-8 conversion in some cases.
             // Note that uaix_likely must be removed too for better performance.
+            // The same is true for fast_utf8to16 function above so it is only called
+            // while it processes long enough runs, see impl_fast_attempts.
 #if 0
 #ifdef __cplusplus
             if constexpr (contiguous)
@@ -219,6 +396,29 @@ uaix_static size_t impl_utf8to16(it_in_utf8 first, it_end_utf8 last, it_out_utf1
             return (size_t)(dst - result);
         }
 
+#ifdef __cplusplus
+        if constexpr (policy != impl_conv_replace)
+        {
+            if constexpr (policy == impl_conv_stop)
+                return (size_t)(dst - result);
+            else if constexpr (policy == impl_conv_escape)
+            {
+                // The ill-formed sequence is the first code unit and the code units
+                // that were accepted after it (maximal subpart) so it is up to 3 code units
+                const size_t count = (size_t)(s - prev);
+                dst = conv_escape_utf16(c, 2, dst);
+                if (count > 1)
+                    dst = conv_escape_utf16(c2, 2, dst);
+                if (count > 2)
+                    dst = conv_escape_utf16(c3, 2, dst);
+            }
+            else if constexpr (policy != impl_conv_skip)
+                dst = codepoint_to_utf16(policy, dst);
+
+            continue;
+        }
+#endif
+
         *dst++ = (type_char16)0xFFFD; // Replacement char U+FFFD
     }
 
@@ -226,15 +426,31 @@ uaix_static size_t impl_utf8to16(it_in_utf8 first, it_end_utf8 last, it_out_utf1
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf8, bool = true>
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf8, bool contiguous = true, type_codept policy = impl_conv_replace>
 #endif
 uaix_static size_t impl_utf16to8(it_in_utf16 first, it_end_utf16 last, it_out_utf8 result, size_t* const error)
 {
     it_in_utf16 src = first;
     it_out_utf8 dst = result;
+    size_t fast_fails = 0; // See impl_fast_attempts
 
     while (src != last)
     {
+        // Encode all well-formed code units without the end checks while possible
+        // the loop below only handles lone surrogates, mixed ASCII and the tail then.
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_fails < impl_fast_attempts)
+            {
+                const it_in_utf16 from = src;
+                if (fast_utf16to8(&src, last, &dst) && src == last)
+                    break;
+                fast_fails = ((size_t)(src - from) < impl_fast_run) ? fast_fails + 1 : 0;
+            }
+        }
+
         const type_codept h = (*src & 0xFFFF);
         ++src;
 
@@ -292,6 +508,22 @@ uaix_static size_t impl_utf16to8(it_in_utf16 first, it_end_utf16 last, it_out_ut
             return (size_t)(dst - result);
         }
 
+#ifdef __cplusplus
+        if constexpr (policy != impl_conv_replace)
+        {
+            if constexpr (policy == impl_conv_stop)
+                return (size_t)(dst - result);
+            else if constexpr (policy == impl_conv_escape)
+            {
+                dst = conv_escape_utf8(h, 4, dst);
+            }
+            else if constexpr (policy != impl_conv_skip)
+                dst = codepoint_to_utf8(policy, dst);
+
+            continue;
+        }
+#endif
+
         // Replacement char U+FFFD
         *dst++ = (type_char8)(type_codept)0xEF;
         *dst++ = (type_char8)(type_codept)0xBF;
@@ -302,7 +534,7 @@ uaix_static size_t impl_utf16to8(it_in_utf16 first, it_end_utf16 last, it_out_ut
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32, bool contiguous = true>
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32, bool contiguous = true, type_codept policy = impl_conv_replace>
 #endif
 uaix_static size_t impl_utf8to32(it_in_utf8 first, it_end_utf8 last, it_out_utf32 result, size_t* const error)
 {
@@ -435,6 +667,29 @@ uaix_static size_t impl_utf8to32(it_in_utf8 first, it_end_utf8 last, it_out_utf3
             return (size_t)(dst - result);
         }
 
+#ifdef __cplusplus
+        if constexpr (policy != impl_conv_replace)
+        {
+            if constexpr (policy == impl_conv_stop)
+                return (size_t)(dst - result);
+            else if constexpr (policy == impl_conv_escape)
+            {
+                // The ill-formed sequence is the first code unit and the code units
+                // that were accepted after it (maximal subpart) so it is up to 3 code units
+                const size_t count = (size_t)(s - prev);
+                dst = conv_escape_utf32(c, 2, dst);
+                if (count > 1)
+                    dst = conv_escape_utf32(c2, 2, dst);
+                if (count > 2)
+                    dst = conv_escape_utf32(c3, 2, dst);
+            }
+            else if constexpr (policy != impl_conv_skip)
+                *dst++ = (type_char32)policy;
+
+            continue;
+        }
+#endif
+
         *dst++ = 0xFFFD; // Replacement char U+FFFD
     }
 
@@ -442,13 +697,18 @@ uaix_static size_t impl_utf8to32(it_in_utf8 first, it_end_utf8 last, it_out_utf3
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf8, bool = true>
+template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf8, bool contiguous = true, type_codept policy = impl_conv_replace>
 #endif
 uaix_static size_t impl_utf32to8(it_in_utf32 first, it_end_utf32 last, it_out_utf8 result, size_t* const error)
 {
     it_in_utf32 src = first;
     it_out_utf8 dst = result;
 
+#ifdef __cplusplus
+    if constexpr (contiguous)
+#endif
+        fast_ascii_utf32to8(&src, last, &dst);
+
     while (src != last)
     {
         const type_codept c = ((type_codept)*src & 0xFFFFFFFF);
@@ -497,6 +757,22 @@ uaix_static size_t impl_utf32to8(it_in_utf32 first, it_end_utf32 last, it_out_ut
             return (size_t)(dst - result);
         }
 
+#ifdef __cplusplus
+        if constexpr (policy != impl_conv_replace)
+        {
+            if constexpr (policy == impl_conv_stop)
+                return (size_t)(dst - result);
+            else if constexpr (policy == impl_conv_escape)
+            {
+                dst = conv_escape_utf8(c, 8, dst);
+            }
+            else if constexpr (policy != impl_conv_skip)
+                dst = codepoint_to_utf8(policy, dst);
+
+            continue;
+        }
+#endif
+
         // Replacement char U+FFFD
         *dst++ = (type_char8)(type_codept)0xEF;
         *dst++ = (type_char8)(type_codept)0xBF;
@@ -507,7 +783,7 @@ uaix_static size_t impl_utf32to8(it_in_utf32 first, it_end_utf32 last, it_out_ut
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf32, bool = true>
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf32, bool contiguous = true, type_codept policy = impl_conv_replace>
 #endif
 uaix_static size_t impl_utf16to32(it_in_utf16 first, it_end_utf16 last, it_out_utf32 result, size_t* const error)
 {
@@ -516,6 +792,16 @@ uaix_static size_t impl_utf16to32(it_in_utf16 first, it_end_utf16 last, it_out_u
 
     while (src != last)
     {
+        // Decode all well-formed code units without the end checks while possible
+        // the loop below only handles lone surrogates and the tail then.
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_utf16to32(&src, last, &dst) && src == last)
+                break;
+        }
+
         const type_codept h = (*src & 0xFFFF);
         ++src;
 
@@ -555,6 +841,22 @@ uaix_static size_t impl_utf16to32(it_in_utf16 first, it_end_utf16 last, it_out_u
             return (size_t)(dst - result);
         }
 
+#ifdef __cplusplus
+        if constexpr (policy != impl_conv_replace)
+        {
+            if constexpr (policy == impl_conv_stop)
+                return (size_t)(dst - result);
+            else if constexpr (policy == impl_conv_escape)
+            {
+                dst = conv_escape_utf32(h, 4, dst);
+            }
+            else if constexpr (policy != impl_conv_skip)
+                *dst++ = (type_char32)policy;
+
+            continue;
+        }
+#endif
+
         *dst++ = 0xFFFD; // Replacement char U+FFFD
     }
 
@@ -562,7 +864,7 @@ uaix_static size_t impl_utf16to32(it_in_utf16 first, it_end_utf16 last, it_out_u
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf16, bool = true>
+template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf16, bool contiguous = true, type_codept policy = impl_conv_replace>
 #endif
 uaix_static size_t impl_utf32to16(it_in_utf32 first, it_end_utf32 last, it_out_utf16 result, size_t* const error)
 {
@@ -571,6 +873,16 @@ uaix_static size_t impl_utf32to16(it_in_utf32 first, it_end_utf32 last, it_out_u
 
     while (src != last)
     {
+        // Encode all valid code points without the end checks while possible
+        // the loop below only handles invalid code points and the tail then.
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_utf32to16(&src, last, &dst) && src == last)
+                break;
+        }
+
         const type_codept c = ((type_codept)*src & 0xFFFFFFFF);
         ++src;
 
@@ -600,6 +912,22 @@ uaix_static size_t impl_utf32to16(it_in_utf32 first, it_end_utf32 last, it_out_u
             return (size_t)(dst - result);
         }
 
+#ifdef __cplusplus
+        if constexpr (policy != impl_conv_replace)
+        {
+            if constexpr (policy == impl_conv_stop)
+                return (size_t)(dst - result);
+            else if constexpr (policy == impl_conv_escape)
+            {
+                dst = conv_escape_utf16(c, 8, dst);
+            }
+            else if constexpr (policy != impl_conv_skip)
+                dst = codepoint_to_utf16(policy, dst);
+
+            continue;
+        }
+#endif
+
         *dst++ = (type_char16)0xFFFD; // Replacement char U+FFFD
     }
 
@@ -607,21 +935,135 @@ uaix_static size_t impl_utf32to16(it_in_utf32 first, it_end_utf32 last, it_out_u
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8>
+template<typename it_in_utf16, typename it_end_utf16>
 #endif
-uaix_static bool impl_is_valid_utf8(it_in_utf8 first, it_end_utf8 last, size_t* const error)
+uaix_static size_t impl_utf8_length_from_utf16(it_in_utf16 first, it_end_utf16 last)
 {
-    // Based on impl_utf8to16 function
+    // Based on impl_utf16to8 function
+    // Returns the exact length of the result of impl_utf16to8 function in lenient mode
+    // so it can be used to allocate a destination string only once.
+    // In strict mode the result is always the same or less.
+
+    it_in_utf16 src = first;
+    size_t length = 0;
+
+    while (src != last)
+    {
+        const type_codept h = (*src & 0xFFFF);
+        ++src;
+
+        if (h < 0xD800 || h > 0xDFFF)
+        {
+            // Branchless 1, 2 or 3 because the branches cannot be predicted
+            // in the text that mixes for example ASCII spaces and punctuation with non-ASCII.
+            // (h + 0xFF80) >> 16 is 1 if h >= 0x80 and (h + 0xF800) >> 16 is 1 if h >= 0x800
+            length += (size_t)(1 + ((h + 0xFF80) >> 16) + ((h + 0xF800) >> 16));
+        }
+        else if (h <= 0xDBFF && src != last) // High surrogate is in range
+        {
+            const type_codept l = (*src & 0xFFFF);
+
+            if (l >= 0xDC00 && l <= 0xDFFF) // Low surrogate is in range
+            {
+                length += 4;
+                ++src;
+            }
+            else // Broken surrogate pair (replacement char U+FFFD)
+                length += 3;
+        }
+        else // Other code points or lone surrogate (replacement char U+FFFD)
+            length += 3;
+    }
+
+    return length;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32>
+#endif
+uaix_static size_t impl_utf8_length_from_utf32(it_in_utf32 first, it_end_utf32 last)
+{
+    // Based on impl_utf32to8 function
+    // Returns the exact length of the result of impl_utf32to8 function in lenient mode
+
+    it_in_utf32 src = first;
+    size_t length = 0;
+
+    while (src != last)
+    {
+        const type_codept c = ((type_codept)*src & 0xFFFFFFFF);
+        ++src;
+
+        if (c <= 0x7F)
+            length += 1;
+        else if (c <= 0x7FF)
+            length += 2;
+        else if (c >= 0x10000 && c <= 0x10FFFF)
+            length += 4;
+        else // Other code points or surrogate or > 0x10FFFF (replacement char U+FFFD)
+            length += 3;
+    }
+
+    return length;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32>
+#endif
+uaix_static size_t impl_utf16_length_from_utf32(it_in_utf32 first, it_end_utf32 last)
+{
+    // Based on impl_utf32to16 function
+    // Returns the exact length of the result of impl_utf32to16 function in lenient mode
+
+    it_in_utf32 src = first;
+    size_t length = 0;
+
+    while (src != last)
+    {
+        const type_codept c = ((type_codept)*src & 0xFFFFFFFF);
+        ++src;
+
+        if (c >= 0x10000 && c <= 0x10FFFF) // Surrogate pair
+            length += 2;
+        else // Other code points or surrogate or > 0x10FFFF (replacement char U+FFFD)
+            length += 1;
+    }
+
+    return length;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, bool contiguous = true>
+#endif
+uaix_static size_t impl_length_from_utf8(it_in_utf8 first, it_end_utf8 last, bool utf16)
+{
+    // Based on impl_is_valid_utf8 function
+    // Returns the exact length of the result of impl_utf8to16 function (if utf16 is true)
+    // or impl_utf8to32 function in lenient mode, every ill-formed sequence is counted
+    // as one replacement char U+FFFD like in these functions.
+    // In strict mode the result is always the same or less.
 
     it_in_utf8 s = first;
-    it_in_utf8 prev = s;
+    size_t count = 0; // Code points
+    size_t pairs = 0; // Surrogate pairs in UTF-16
 
     while (s != last)
     {
+        // See impl_utf8to16 function
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_length_utf8(&s, last, &count, &pairs) && s == last)
+                break;
+        }
+
         // NOTE: NOLINT is used here because the function should be consistent with impl_utf8to16
         // NOLINTNEXTLINE(misc-const-correctness)
         type_codept c = (*s & 0xFF), c2 = 0, c3 = 0, c4 = 0; // c2, c3, c4 tag_can_be_uninitialized
-        prev = s; // Save previous position for error
+
+        // Every branch adds one code point or one replacement char U+FFFD
+        ++count;
 
         // NOLINTBEGIN(bugprone-assignment-in-if-condition)
 
@@ -680,6 +1122,7 @@ uaix_static bool impl_is_valid_utf8(it_in_utf8 first, it_end_utf8 last, size_t*
                 ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
                 ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
             {
+                ++pairs;
                 ++s;
                 continue;
             }
@@ -690,6 +1133,7 @@ uaix_static bool impl_is_valid_utf8(it_in_utf8 first, it_end_utf8 last, size_t*
                 ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
                 ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
             {
+                ++pairs;
                 ++s;
                 continue;
             }
@@ -700,6 +1144,7 @@ uaix_static bool impl_is_valid_utf8(it_in_utf8 first, it_end_utf8 last, size_t*
                 ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
                 ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
             {
+                ++pairs;
                 ++s;
                 continue;
             }
@@ -712,113 +1157,1735 @@ uaix_static bool impl_is_valid_utf8(it_in_utf8 first, it_end_utf8 last, size_t*
 
         // NOLINTEND(bugprone-assignment-in-if-condition)
 
-        // Error: invalid code unit or overlong code point or truncated sequence in UTF-8
+        // Ill-formed sequence: invalid code unit or overlong code point or truncated sequence
+        // it is already counted as replacement char U+FFFD and s points to the next sequence
+    }
 
-        if (error) // *error points to the start of ill-formed sequence
-            *error = (size_t)(prev - first);
+    return utf16 ? count + pairs : count;
+}
 
-        return false;
-    }
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static size_t impl_utf16_length_from_utf8(it_in_utf8 first, it_end_utf8 last)
+{
+    return impl_length_from_utf8(first, last, true);
+}
 
-    return true;
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static size_t impl_utf32_length_from_utf8(it_in_utf8 first, it_end_utf8 last)
+{
+    return impl_length_from_utf8(first, last, false);
 }
 
 #ifdef __cplusplus
 template<typename it_in_utf16, typename it_end_utf16>
 #endif
-uaix_static bool impl_is_valid_utf16(it_in_utf16 first, it_end_utf16 last, size_t* const error)
+uaix_static size_t impl_utf32_length_from_utf16(it_in_utf16 first, it_end_utf16 last)
 {
-    // Based on impl_utf16to8 function
+    // Based on impl_utf16to32 function
+    // Returns the exact length of the result of impl_utf16to32 function in lenient mode
 
     it_in_utf16 src = first;
+    size_t length = 0;
 
     while (src != last)
     {
         const type_codept h = (*src & 0xFFFF);
         ++src;
 
-        if (h <= 0x7F)
-        { // NOLINT(bugprone-branch-clone)
-            continue;
+        // Every code unit is a code point or replacement char U+FFFD but a surrogate pair
+        length += 1;
+
+        if (h >= 0xD800 && h <= 0xDBFF && src != last) // High surrogate is in range
+        {
+            const type_codept l = (*src & 0xFFFF);
+
+            if (l >= 0xDC00 && l <= 0xDFFF) // Low surrogate is in range
+                ++src;
         }
-        else if (h <= 0x7FF)
-        { // NOLINT(bugprone-branch-clone)
-            continue;
+    }
+
+    return length;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, bool contiguous = true>
+#endif
+uaix_static bool impl_is_valid_utf8(it_in_utf8 first, it_end_utf8 last, size_t* const error)
+{
+    // Based on impl_utf8to16 function
+
+    it_in_utf8 s = first;
+    it_in_utf8 prev = s;
+    size_t fast_fails = 0; // See impl_fast_attempts
+
+    while (s != last)
+    {
+        // See impl_utf8to16 function
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_fails < impl_fast_attempts)
+            {
+                const it_in_utf8 from = s;
+                if (fast_valid_utf8(&s, last) && s == last)
+                    break;
+                fast_fails = ((size_t)(s - from) < impl_fast_run) ? fast_fails + 1 : 0;
+            }
+        }
+
+        // NOTE: NOLINT is used here because the function should be consistent with impl_utf8to16
+        // NOLINTNEXTLINE(misc-const-correctness)
+        type_codept c = (*s & 0xFF), c2 = 0, c3 = 0, c4 = 0; // c2, c3, c4 tag_can_be_uninitialized
+        prev = s; // Save previous position for error
+
+        // NOLINTBEGIN(bugprone-assignment-in-if-condition)
+
+        if (uaix_likely(c <= 0x7F)) // Fast route for ASCII
+        {
+            ++s;
+            continue;
+        }
+        else if (c >= 0xC2 && c <= 0xDF)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c >= 0xE1 && c <= 0xEC)
+        { // NOLINT(bugprone-branch-clone)
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c >= 0xEE && c <= 0xEF)
+        { // NOLINT(bugprone-branch-clone)
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xE0)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0xA0 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xED)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0x9F) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xF0)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x90 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
+                ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xF4)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0x8F) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
+                ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else if (c >= 0xF1 && c <= 0xF3)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
+                ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
+            {
+                ++s;
+                continue;
+            }
+        }
+        else
+        {
+            // invalid code unit
+            ++s;
+        }
+
+        // NOLINTEND(bugprone-assignment-in-if-condition)
+
+        // Error: invalid code unit or overlong code point or truncated sequence in UTF-8
+
+        if (error) // *error points to the start of ill-formed sequence
+            *error = (size_t)(prev - first);
+
+        return false;
+    }
+
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8, bool contiguous = true>
+#endif
+uaix_static size_t impl_utf8to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, size_t* const error)
+{
+    // Based on impl_is_valid_utf8 function but well-formed sequences are copied to the result
+    // and ill-formed sequences are replaced with U+FFFD the same as in impl_utf8to16 function.
+    // The function reads a sequence before it writes it so it works in place when the result
+    // is the same memory as the source or before it, but U+FFFD is 3 bytes and an ill-formed
+    // sequence is 1-3 bytes so the result must start before the source at least
+    // by the growth of the result then (see una::sanitize_utf8 for example).
+
+    it_in_utf8 s = first;
+    it_in_utf8 prev = s;
+    it_out_utf8 dst = result;
+
+    while (s != last)
+    {
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if (fast_utf8to8(&s, last, &dst) && s == last)
+                break;
+        }
+
+        type_codept c = (*s & 0xFF), c2 = 0, c3 = 0, c4 = 0; // c2, c3, c4 tag_can_be_uninitialized
+        prev = s; // Save previous position for error
+
+        // NOLINTBEGIN(bugprone-assignment-in-if-condition)
+
+        if (uaix_likely(c <= 0x7F)) // Fast route for ASCII
+        {
+            *dst++ = (type_char8)c;
+            ++s;
+            continue;
+        }
+        else if (c >= 0xC2 && c <= 0xDF)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                ++s;
+                continue;
+            }
+        }
+        else if (c >= 0xE1 && c <= 0xEC)
+        { // NOLINT(bugprone-branch-clone)
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                ++s;
+                continue;
+            }
+        }
+        else if (c >= 0xEE && c <= 0xEF)
+        { // NOLINT(bugprone-branch-clone)
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xE0)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0xA0 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xED)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0x9F) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xF0)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x90 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
+                ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                *dst++ = (type_char8)c4;
+                ++s;
+                continue;
+            }
+        }
+        else if (c == 0xF4)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0x8F) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
+                ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                *dst++ = (type_char8)c4;
+                ++s;
+                continue;
+            }
+        }
+        else if (c >= 0xF1 && c <= 0xF3)
+        {
+            if (++s != last && ((c2 = (*s & 0xFF)) >= 0x80 && c2 <= 0xBF) &&
+                ++s != last && ((c3 = (*s & 0xFF)) >= 0x80 && c3 <= 0xBF) &&
+                ++s != last && ((c4 = (*s & 0xFF)) >= 0x80 && c4 <= 0xBF))
+            {
+                *dst++ = (type_char8)c;
+                *dst++ = (type_char8)c2;
+                *dst++ = (type_char8)c3;
+                *dst++ = (type_char8)c4;
+                ++s;
+                continue;
+            }
+        }
+        else
+        {
+            // invalid code unit
+            ++s;
+        }
+
+        // NOLINTEND(bugprone-assignment-in-if-condition)
+
+        // Error: invalid code unit or overlong code point or truncated sequence in UTF-8
+
+        if (error)
+        {
+            // *error points to the start of ill-formed sequence
+            *error = (size_t)(prev - first);
+            return (size_t)(dst - result);
+        }
+
+        // Replacement char U+FFFD
+        *dst++ = (type_char8)(type_codept)0xEF;
+        *dst++ = (type_char8)(type_codept)0xBF;
+        *dst++ = (type_char8)(type_codept)0xBD;
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static bool impl_is_valid_utf16(it_in_utf16 first, it_end_utf16 last, size_t* const error)
+{
+    // Based on impl_utf16to8 function
+
+    it_in_utf16 src = first;
+
+    while (src != last)
+    {
+        const type_codept h = (*src & 0xFFFF);
+        ++src;
+
+        if (h <= 0x7F)
+        { // NOLINT(bugprone-branch-clone)
+            continue;
+        }
+        else if (h <= 0x7FF)
+        { // NOLINT(bugprone-branch-clone)
+            continue;
+        }
+        else if (h >= 0xD800 && h <= 0xDFFF) // Surrogate pair
+        {
+            if (/*h >= 0xD800 &&*/ h <= 0xDBFF) // High surrogate is in range
+            {
+                if (src != last) // Unpaired high surrogate if reached the end here
+                {
+                    const type_codept l = (*src & 0xFFFF);
+
+                    if (l >= 0xDC00 && l <= 0xDFFF) // Low surrogate is in range
+                    {
+                        ++src;
+                        continue;
+                    }
+                }
+            }
+        }
+        else
+        { // NOLINT(bugprone-branch-clone)
+            continue;
+        }
+
+        // Error: lone low surrogate or broken surrogate pair in UTF-16
+
+        if (error) // *error points to the start of ill-formed sequence
+            *error = (size_t)(src - first) - 1;
+
+        return false;
+    }
+
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32>
+#endif
+uaix_static bool impl_is_valid_utf32(it_in_utf32 first, it_end_utf32 last, size_t* const error)
+{
+    // Based on impl_utf32to8 function
+
+    it_in_utf32 src = first;
+
+    while (src != last)
+    {
+        const type_codept c = ((type_codept)*src & 0xFFFFFFFF);
+        ++src;
+
+        if (c <= 0x7F)
+        { // NOLINT(bugprone-branch-clone)
+            continue;
+        }
+        else if (c <= 0x7FF)
+        { // NOLINT(bugprone-branch-clone)
+            continue;
+        }
+        else if (c <= 0xFFFF)
+        {
+            if (!(c >= 0xD800 && c <= 0xDFFF)) // If not in surrogate pairs range
+            {
+                continue;
+            }
+        }
+        else if (c <= 0x10FFFF)
+        { // NOLINT(bugprone-branch-clone)
+            continue;
+        }
+
+        // Error: code point > 0x10FFFF or surrogate in UTF-32
+
+        if (error) // *error points to invalid code point
+            *error = (size_t)(src - first) - 1;
+
+        return false;
+    }
+
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8, bool contiguous = true>
+#endif
+uaix_static size_t impl_utf16bytes_to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, bool big_endian, size_t* const error)
+{
+    // Based on impl_utf16to8 function but the source is UTF-16BE or UTF-16LE bytes
+    // so a code unit is read from 2 bytes in the byte order, there is no separate byte swap pass.
+    // An incomplete code unit at the end (odd trailing byte) is an error the same as a lone surrogate.
+    // Error position is in bytes.
+
+    it_in_utf8 src = first;
+    it_in_utf8 prev = src;
+    it_out_utf8 dst = result;
+
+    const type_codept shift1 = big_endian ? 8 : 0;
+    const type_codept shift2 = big_endian ? 0 : 8;
+
+    while (src != last)
+    {
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            // The function is always inlined so the byte order is a constant in it then
+            if ((big_endian ? fast_utf16bytes_to8(&src, last, &dst, true) :
+                              fast_utf16bytes_to8(&src, last, &dst, false)) && src == last)
+                break;
+        }
+
+        prev = src;
+
+        const type_codept b1 = (*src & 0xFF);
+        ++src;
+
+        if (src != last) // Incomplete code unit if reached the end here
+        {
+            const type_codept h = (b1 << shift1) | ((type_codept)(*src & 0xFF) << shift2);
+            ++src;
+
+            if (h <= 0x7F)
+            {
+                *dst++ = (type_char8)h;
+
+                continue;
+            }
+            else if (h <= 0x7FF)
+            {
+                *dst++ = (type_char8)(0xC0 | (h >> 6));
+                *dst++ = (type_char8)(0x80 | (h & 0x3F));
+
+                continue;
+            }
+            else if (h >= 0xD800 && h <= 0xDFFF) // Surrogate pair
+            {
+                if (/*h >= 0xD800 &&*/ h <= 0xDBFF) // High surrogate is in range
+                {
+                    it_in_utf8 next = src;
+
+                    if (src != last && ++next != last) // Unpaired high surrogate if reached the end here
+                    {
+                        const type_codept l = ((type_codept)(*src & 0xFF) << shift1) | ((type_codept)(*next & 0xFF) << shift2);
+
+                        if (l >= 0xDC00 && l <= 0xDFFF) // Low surrogate is in range
+                        {
+                            const type_codept c = ((h - 0xD800) << 10) + (l - 0xDC00) + 0x10000;
+
+                            *dst++ = (type_char8)(0xF0 |  (c >> 18));
+                            *dst++ = (type_char8)(0x80 | ((c >> 12) & 0x3F));
+                            *dst++ = (type_char8)(0x80 | ((c >> 6)  & 0x3F));
+                            *dst++ = (type_char8)(0x80 |  (c        & 0x3F));
+
+                            src = next;
+                            ++src;
+                            continue;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                *dst++ = (type_char8)(0xE0 |  (h >> 12));
+                *dst++ = (type_char8)(0x80 | ((h >> 6) & 0x3F));
+                *dst++ = (type_char8)(0x80 |  (h       & 0x3F));
+
+                continue;
+            }
+        }
+
+        // Error: lone low surrogate or broken surrogate pair or incomplete code unit
+
+        if (error)
+        {
+            // *error points to the start of ill-formed sequence
+            *error = (size_t)(prev - first);
+            return (size_t)(dst - result);
+        }
+
+        // Replacement char U+FFFD
+        *dst++ = (type_char8)(type_codept)0xEF;
+        *dst++ = (type_char8)(type_codept)0xBF;
+        *dst++ = (type_char8)(type_codept)0xBD;
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8, bool contiguous = true>
+#endif
+uaix_static size_t impl_utf32bytes_to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, bool big_endian, size_t* const error)
+{
+    // Based on impl_utf32to8 function but the source is UTF-32BE or UTF-32LE bytes
+    // so a code unit is read from 4 bytes in the byte order, there is no separate byte swap pass.
+    // An incomplete code unit at the end (1-3 trailing bytes) is an error the same as an invalid code point.
+    // Error position is in bytes.
+
+    it_in_utf8 src = first;
+    it_in_utf8 prev = src;
+    it_out_utf8 dst = result;
+
+    while (src != last)
+    {
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            // The function is always inlined so the byte order is a constant in it then
+            if ((big_endian ? fast_utf32bytes_to8(&src, last, &dst, true) :
+                              fast_utf32bytes_to8(&src, last, &dst, false)) && src == last)
+                break;
+        }
+
+        prev = src;
+
+        type_codept c = 0;
+        size_t n = 0;
+
+        for (; n < 4 && src != last; ++n, ++src)
+            c |= (type_codept)(*src & 0xFF) << (big_endian ? 24 - n * 8 : n * 8);
+
+        if (n == 4) // Incomplete code unit if reached the end before
+        {
+            if (c <= 0x7F)
+            {
+                *dst++ = (type_char8)c;
+
+                continue;
+            }
+            else if (c <= 0x7FF)
+            {
+                *dst++ = (type_char8)(0xC0 | (c >> 6));
+                *dst++ = (type_char8)(0x80 | (c & 0x3F));
+
+                continue;
+            }
+            else if (c <= 0xFFFF)
+            {
+                if (!(c >= 0xD800 && c <= 0xDFFF)) // If not in surrogate pairs range
+                {
+                    *dst++ = (type_char8)(0xE0 |  (c >> 12));
+                    *dst++ = (type_char8)(0x80 | ((c >> 6) & 0x3F));
+                    *dst++ = (type_char8)(0x80 |  (c       & 0x3F));
+
+                    continue;
+                }
+            }
+            else if (c <= 0x10FFFF)
+            {
+                *dst++ = (type_char8)(0xF0 |  (c >> 18));
+                *dst++ = (type_char8)(0x80 | ((c >> 12) & 0x3F));
+                *dst++ = (type_char8)(0x80 | ((c >> 6)  & 0x3F));
+                *dst++ = (type_char8)(0x80 |  (c        & 0x3F));
+
+                continue;
+            }
+        }
+
+        // Error: code point > 0x10FFFF or surrogate in UTF-32 or incomplete code unit
+
+        if (error)
+        {
+            // *error points to the start of invalid code point
+            *error = (size_t)(prev - first);
+            return (size_t)(dst - result);
+        }
+
+        // Replacement char U+FFFD
+        *dst++ = (type_char8)(type_codept)0xEF;
+        *dst++ = (type_char8)(type_codept)0xBF;
+        *dst++ = (type_char8)(type_codept)0xBD;
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_utf16be_to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, size_t* const error)
+{
+    return impl_utf16bytes_to8(first, last, result, true, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_utf16le_to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, size_t* const error)
+{
+    return impl_utf16bytes_to8(first, last, result, false, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_utf32be_to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, size_t* const error)
+{
+    return impl_utf32bytes_to8(first, last, result, true, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_utf32le_to8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, size_t* const error)
+{
+    return impl_utf32bytes_to8(first, last, result, false, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16, bool contiguous = true>
+#endif
+uaix_static size_t impl_utf16bytes_to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, bool big_endian, size_t* const error)
+{
+    // Based on impl_utf16bytes_to8 function but the result is UTF-16 so a code unit
+    // is read in the byte order and copied as is, only surrogate pairs must be validated.
+    // Error position is in bytes.
+
+    it_in_utf8 src = first;
+    it_in_utf8 prev = src;
+    it_out_utf16 dst = result;
+
+    const type_codept shift1 = big_endian ? 8 : 0;
+    const type_codept shift2 = big_endian ? 0 : 8;
+
+    while (src != last)
+    {
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            // The function is always inlined so the byte order is a constant in it then
+            if ((big_endian ? fast_utf16bytes_to16(&src, last, &dst, true) :
+                              fast_utf16bytes_to16(&src, last, &dst, false)) && src == last)
+                break;
+        }
+
+        prev = src;
+
+        const type_codept b1 = (*src & 0xFF);
+        ++src;
+
+        if (src != last) // Incomplete code unit if reached the end here
+        {
+            const type_codept h = (b1 << shift1) | ((type_codept)(*src & 0xFF) << shift2);
+            ++src;
+
+            if (!(h >= 0xD800 && h <= 0xDFFF)) // If not in surrogate pairs range
+            {
+                *dst++ = (type_char16)h;
+
+                continue;
+            }
+            else if (/*h >= 0xD800 &&*/ h <= 0xDBFF) // High surrogate is in range
+            {
+                it_in_utf8 next = src;
+
+                if (src != last && ++next != last) // Unpaired high surrogate if reached the end here
+                {
+                    const type_codept l = ((type_codept)(*src & 0xFF) << shift1) | ((type_codept)(*next & 0xFF) << shift2);
+
+                    if (l >= 0xDC00 && l <= 0xDFFF) // Low surrogate is in range
+                    {
+                        *dst++ = (type_char16)h;
+                        *dst++ = (type_char16)l;
+
+                        src = next;
+                        ++src;
+                        continue;
+                    }
+                }
+            }
+        }
+
+        // Error: lone low surrogate or broken surrogate pair or incomplete code unit
+
+        if (error)
+        {
+            // *error points to the start of ill-formed sequence
+            *error = (size_t)(prev - first);
+            return (size_t)(dst - result);
+        }
+
+        *dst++ = 0xFFFD; // Replacement char U+FFFD
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16, bool contiguous = true>
+#endif
+uaix_static size_t impl_utf32bytes_to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, bool big_endian, size_t* const error)
+{
+    // Based on impl_utf32to16 function but the source is UTF-32BE or UTF-32LE bytes
+    // the same as in impl_utf32bytes_to8 function.
+    // Error position is in bytes.
+
+    it_in_utf8 src = first;
+    it_in_utf8 prev = src;
+    it_out_utf16 dst = result;
+
+    while (src != last)
+    {
+#ifdef __cplusplus
+        if constexpr (contiguous)
+#endif
+        {
+            if ((big_endian ? fast_utf32bytes_to16(&src, last, &dst, true) :
+                              fast_utf32bytes_to16(&src, last, &dst, false)) && src == last)
+                break;
+        }
+
+        prev = src;
+
+        type_codept c = 0;
+        size_t n = 0;
+
+        for (; n < 4 && src != last; ++n, ++src)
+            c |= (type_codept)(*src & 0xFF) << (big_endian ? 24 - n * 8 : n * 8);
+
+        if (n == 4) // Incomplete code unit if reached the end before
+        {
+            if (c <= 0xFFFF)
+            {
+                if (!(c >= 0xD800 && c <= 0xDFFF)) // If not in surrogate pairs range
+                {
+                    *dst++ = (type_char16)c;
+
+                    continue;
+                }
+            }
+            else if (c <= 0x10FFFF) // Make a surrogate pair
+            {
+                *dst++ = (type_char16)(0xD7C0 + (c >> 10));
+                *dst++ = (type_char16)(0xDC00 + (c & 0x3FF));
+
+                continue;
+            }
+        }
+
+        // Error: code point > 0x10FFFF or surrogate in UTF-32 or incomplete code unit
+
+        if (error)
+        {
+            // *error points to the start of invalid code point
+            *error = (size_t)(prev - first);
+            return (size_t)(dst - result);
+        }
+
+        *dst++ = 0xFFFD; // Replacement char U+FFFD
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_static size_t impl_utf16be_to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, size_t* const error)
+{
+    return impl_utf16bytes_to16(first, last, result, true, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_static size_t impl_utf16le_to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, size_t* const error)
+{
+    return impl_utf16bytes_to16(first, last, result, false, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_static size_t impl_utf32be_to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, size_t* const error)
+{
+    return impl_utf32bytes_to16(first, last, result, true, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_static size_t impl_utf32le_to16(it_in_utf8 first, it_end_utf8 last, it_out_utf16 result, size_t* const error)
+{
+    return impl_utf32bytes_to16(first, last, result, false, error);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_ascii_utf8to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst)
+{
+    // This optimization makes processing of ASCII strings by about 20-30% faster
+    // C++ Note: works only with contiguous or random access input iterators
+
+    bool processed = false;
+
+    for (it_in_utf8 end = *s + (last - *s) - ((last - *s) % 4); *s != end; *s += 4)
+    {
+        // There are 3 ways to perform unaligned load:
+        // 1. uint32_t = *((uint32_t*)uint8_t*); // Unsafe and not portable garbage.
+        // 2. memcpy(&uint32_t, uint8_t*, 4); // Better but won't work for us for many reasons.
+        // 3. Manual load. Harder to optimize for a compiler but safe and without potential function call in the worst case.
+        // So we use manual load here.
+        // In the best case scenario the following 4 lines will be optimized into one mov instruction
+        // in the worst case it won't but we only lose a bit performance, processing by 4 bytes is always faster.
+        // Note that manual load is endian agnostic too compared to other ways so we don't need to deal with that crap.
+        // This means the behaviour will be the same on little/big/middle endian systems the value c will be the same.
+        type_codept c = 0;
+        c |= ((type_codept)*(*s+0) & 0xFF);
+        c |= ((type_codept)*(*s+1) & 0xFF) << 8;
+        c |= ((type_codept)*(*s+2) & 0xFF) << 16;
+        c |= ((type_codept)*(*s+3) & 0xFF) << 24;
+
+        // If non-ASCII then drop from the function and proceed as usual
+        if ((c & 0x80808080) != 0)
+            break;
+
+        // This is not unaligned store even though it looks like it, we just do the usual thing here.
+        *(*dst)++ = (type_char16)(c & 0xFF);
+        *(*dst)++ = (type_char16)((c >> 8) & 0xFF);
+        *(*dst)++ = (type_char16)((c >> 16) & 0xFF);
+        *(*dst)++ = (type_char16)((c >> 24) & 0xFF);
+
+        // This is how unaligned store should look like it can be used for potential utf8to8 function.
+        // Even though a compiler probably optimize both variants the same for such function.
+        //*(*dst+0) = (impl_char8)(c & 0xFF);
+        //*(*dst+1) = (impl_char8)((c >> 8) & 0xFF);
+        //*(*dst+2) = (impl_char8)((c >> 16) & 0xFF);
+        //*(*dst+3) = (impl_char8)((c >> 24) & 0xFF);
+        //*dst += 4;
+
+        processed = true;
+    }
+
+    return processed;
+
+    // NOTE from mg152:
+    // In my observations MSVC never optimize manual load, GCC and Clang optimize it starting with version 5.
+    // See test/random_stuff/unaligned_load_store.h to check which compiler is able to optimize it properly.
+    // It is possible to make it faster by using long long and processing by 8 bytes or even intrinsics like _mm_loadu_si128
+    // but it will be much less portable and the number of defines to handle it will be enormous.
+    // So the basic optimization should be enough it's over optimization anyway I just did it for fun. At least it's always safe.
+
+    // For reference: https://blog.quarkslab.com/unaligned-accesses-in-cc-what-why-and-solutions-to-do-it-properly.html
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_ascii_utf8to32(it_in_utf8* s, it_end_utf8 last, it_out_utf32* dst)
+{
+    bool processed = false;
+
+    for (it_in_utf8 end = *s + (last - *s) - ((last - *s) % 4); *s != end; *s += 4)
+    {
+        type_codept c = 0;
+        c |= ((type_codept)*(*s+0) & 0xFF);
+        c |= ((type_codept)*(*s+1) & 0xFF) << 8;
+        c |= ((type_codept)*(*s+2) & 0xFF) << 16;
+        c |= ((type_codept)*(*s+3) & 0xFF) << 24;
+
+        if ((c & 0x80808080) != 0)
+            break;
+
+        *(*dst)++ = (type_char32)(c & 0xFF);
+        *(*dst)++ = (type_char32)((c >> 8) & 0xFF);
+        *(*dst)++ = (type_char32)((c >> 16) & 0xFF);
+        *(*dst)++ = (type_char32)((c >> 24) & 0xFF);
+
+        processed = true;
+    }
+
+    return processed;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf8to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst)
+{
+    // This optimization makes processing of 2 and 3 byte sequences (Cyrillic, CJK etc.)
+    // by about 5% faster, it is the same idea as fast ASCII function but for all
+    // sequences that can be decoded without the end checks.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    // Only well-formed 1, 2 and 3 byte sequences are processed here so the output
+    // is always the same as in the main loop of impl_utf8to16 function.
+    // If there is something else (4 byte sequence or ill-formed sequence) then drop
+    // from the function and the main loop will handle it and U+FFFD properly.
+    // 4 bytes must be available so the longest sequence can be read without the end checks
+    // and 4 ASCII bytes can be processed at once (see fast_ascii_utf8to16 for manual load).
+
+    bool processed = false;
+    bool block = false; // The previous step was 4 ASCII code units
+
+    while (last - *s >= 4)
+    {
+        const type_codept c = ((type_codept)*(*s+0) & 0xFF);
+        const type_codept c2 = ((type_codept)*(*s+1) & 0xFF);
+        const type_codept c3 = ((type_codept)*(*s+2) & 0xFF);
+
+        if (c <= 0x7F)
+        {
+            const type_codept c4 = ((type_codept)*(*s+3) & 0xFF);
+
+            if (((c | c2 | c3 | c4) & 0x80) == 0)
+            {
+                *(*dst)++ = (type_char16)c;
+                *(*dst)++ = (type_char16)c2;
+                *(*dst)++ = (type_char16)c3;
+                *(*dst)++ = (type_char16)c4;
+                *s += 4;
+
+                processed = true;
+                block = true;
+                continue;
+            }
+            else
+            {
+                // ASCII mixed with other sequences, see impl_fast_attempts
+                if (block)
+                    break;
+
+                *(*dst)++ = (type_char16)c;
+                *s += 1;
+            }
         }
-        else if (h >= 0xD800 && h <= 0xDFFF) // Surrogate pair
+        else if (c >= 0xC2 && c <= 0xDF)
+        {
+            if (c2 < 0x80 || c2 > 0xBF)
+                break;
+
+            *(*dst)++ = (type_char16)(((c & 0x1F) << 6) + (c2 & 0x3F));
+            *s += 2;
+        }
+        else if (c >= 0xE0 && c <= 0xEF)
+        {
+            // The same ranges as in impl_utf8to16 function: E0 A0..BF, ED 80..9F, others 80..BF
+            if (c2 < (c == 0xE0 ? 0xA0 : 0x80) || c2 > (c == 0xED ? 0x9F : 0xBF) ||
+                c3 < 0x80 || c3 > 0xBF)
+                break;
+
+            *(*dst)++ = (type_char16)(((c & 0x0F) << 12) + ((c2 & 0x3F) << 6) + (c3 & 0x3F));
+            *s += 3;
+        }
+        else
+            break;
+
+        processed = true;
+        block = false;
+    }
+
+    return processed;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_valid_utf8(it_in_utf8* s, it_end_utf8 last)
+{
+    // This optimization makes validation of ASCII strings several times faster
+    // and validation of 2 and 3 byte sequences (Cyrillic, CJK etc.) by about 15-20% faster.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    // The function works the same as fast_utf8to16 function but only skips well-formed
+    // sequences so the main loop of impl_is_valid_utf8 function only handles
+    // the first ill-formed sequence and the tail to find the error position.
+    // Every step is one 4 byte load (see fast_ascii_utf8to16 for manual load)
+    // and the well-formed sequences are checked with masks in the loaded value,
+    // byte 1 is (w & 0xFF), byte 2 is ((w >> 8) & 0xFF) and so on.
+    // The ranges are the same as in impl_is_valid_utf8 function.
+
+    bool processed = false;
+    bool block = false; // The previous step was 4 ASCII code units
+
+    while (last - *s >= 4)
+    {
+        type_codept w = 0;
+        w |= ((type_codept)*(*s+0) & 0xFF);
+        w |= ((type_codept)*(*s+1) & 0xFF) << 8;
+        w |= ((type_codept)*(*s+2) & 0xFF) << 16;
+        w |= ((type_codept)*(*s+3) & 0xFF) << 24;
+
+        if ((w & 0x80808080) == 0) // 4 ASCII bytes
+        {
+            *s += 4;
+
+            // Long ASCII runs are the most common case so process them by 8 bytes at once
+            for (it_in_utf8 end = *s + (last - *s) - ((last - *s) % 8); *s != end; *s += 8)
+            {
+                type_codept w1 = 0, w2 = 0;
+                w1 |= ((type_codept)*(*s+0) & 0xFF);
+                w1 |= ((type_codept)*(*s+1) & 0xFF) << 8;
+                w1 |= ((type_codept)*(*s+2) & 0xFF) << 16;
+                w1 |= ((type_codept)*(*s+3) & 0xFF) << 24;
+                w2 |= ((type_codept)*(*s+4) & 0xFF);
+                w2 |= ((type_codept)*(*s+5) & 0xFF) << 8;
+                w2 |= ((type_codept)*(*s+6) & 0xFF) << 16;
+                w2 |= ((type_codept)*(*s+7) & 0xFF) << 24;
+
+                // Note that (w1 | w2) must not be used here because then
+                // compilers cannot optimize manual load into one instruction
+                if ((w1 & 0x80808080) != 0 || (w2 & 0x80808080) != 0)
+                    break;
+            }
+
+            processed = true;
+            block = true;
+            continue;
+        }
+        else if ((w & 0x80) == 0) // ASCII byte
+        {
+            // ASCII mixed with other sequences, see impl_fast_attempts
+            if (block)
+                break;
+
+            *s += 1;
+        }
+        else if ((w & 0xC0E0) == 0x80C0 && (w & 0x1E) != 0) // 2 byte sequence C2..DF 80..BF
+        {
+            // Most likely it is followed by another 2 byte sequence
+            if ((w & 0xC0E00000) == 0x80C00000 && (w & 0x1E0000) != 0)
+                *s += 4;
+            else
+                *s += 2;
+        }
+        else if ((w & 0xC0C0F0) == 0x8080E0) // 3 byte sequence E0..EF 80..BF 80..BF
+        {
+            if ((w & 0xFF) == 0xE0 && (w & 0x2000) == 0) // E0 80..9F (overlong)
+                break;
+            if ((w & 0xFF) == 0xED && (w & 0x2000) != 0) // ED A0..BF (surrogate)
+                break;
+
+            *s += 3;
+        }
+        else if ((w & 0xC0C0C0F8) == 0x808080F0) // 4 byte sequence F0..F7 80..BF 80..BF 80..BF
+        {
+            if ((w & 0xFF) > 0xF4) // F5..F7
+                break;
+            if ((w & 0xFF) == 0xF0 && (w & 0x3000) == 0) // F0 80..8F (overlong)
+                break;
+            if ((w & 0xFF) == 0xF4 && (w & 0x3000) != 0) // F4 90..BF (> U+10FFFF)
+                break;
+
+            *s += 4;
+        }
+        else
+            break;
+
+        processed = true;
+        block = false;
+    }
+
+    return processed;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf8to8(it_in_utf8* s, it_end_utf8 last, it_out_utf8* dst)
+{
+    // The same as fast_valid_utf8 function but also copies the skipped sequences
+    // for impl_utf8to8 function. Only the bytes that were skipped are stored
+    // and they are stored after they are loaded so it works in place too.
+    // Note that the iterators are copied because UTF-8 output can alias them
+    // so a compiler cannot keep them in registers otherwise.
+
+    it_in_utf8 src = *s;
+    it_out_utf8 out = *dst;
+
+    while (last - src >= 4)
+    {
+        type_codept w = 0;
+        w |= ((type_codept)*(src+0) & 0xFF);
+        w |= ((type_codept)*(src+1) & 0xFF) << 8;
+        w |= ((type_codept)*(src+2) & 0xFF) << 16;
+        w |= ((type_codept)*(src+3) & 0xFF) << 24;
+
+        if ((w & 0x80808080) == 0) // 4 ASCII bytes
+        {
+            *out++ = (type_char8)(w & 0xFF);
+            *out++ = (type_char8)((w >> 8) & 0xFF);
+            *out++ = (type_char8)((w >> 16) & 0xFF);
+            *out++ = (type_char8)((w >> 24) & 0xFF);
+            src += 4;
+
+            for (it_in_utf8 end = src + (last - src) - ((last - src) % 8); src != end; src += 8)
+            {
+                type_codept w1 = 0, w2 = 0;
+                w1 |= ((type_codept)*(src+0) & 0xFF);
+                w1 |= ((type_codept)*(src+1) & 0xFF) << 8;
+                w1 |= ((type_codept)*(src+2) & 0xFF) << 16;
+                w1 |= ((type_codept)*(src+3) & 0xFF) << 24;
+                w2 |= ((type_codept)*(src+4) & 0xFF);
+                w2 |= ((type_codept)*(src+5) & 0xFF) << 8;
+                w2 |= ((type_codept)*(src+6) & 0xFF) << 16;
+                w2 |= ((type_codept)*(src+7) & 0xFF) << 24;
+
+                if ((w1 & 0x80808080) != 0 || (w2 & 0x80808080) != 0)
+                    break;
+
+                *out++ = (type_char8)(w1 & 0xFF);
+                *out++ = (type_char8)((w1 >> 8) & 0xFF);
+                *out++ = (type_char8)((w1 >> 16) & 0xFF);
+                *out++ = (type_char8)((w1 >> 24) & 0xFF);
+                *out++ = (type_char8)(w2 & 0xFF);
+                *out++ = (type_char8)((w2 >> 8) & 0xFF);
+                *out++ = (type_char8)((w2 >> 16) & 0xFF);
+                *out++ = (type_char8)((w2 >> 24) & 0xFF);
+            }
+        }
+        else if ((w & 0x80) == 0) // ASCII byte
+        {
+            *out++ = (type_char8)(w & 0xFF);
+            src += 1;
+        }
+        else if ((w & 0xC0E0) == 0x80C0 && (w & 0x1E) != 0) // 2 byte sequence C2..DF 80..BF
+        {
+            *out++ = (type_char8)(w & 0xFF);
+            *out++ = (type_char8)((w >> 8) & 0xFF);
+
+            // Most likely it is followed by another 2 byte sequence
+            if ((w & 0xC0E00000) == 0x80C00000 && (w & 0x1E0000) != 0)
+            {
+                *out++ = (type_char8)((w >> 16) & 0xFF);
+                *out++ = (type_char8)((w >> 24) & 0xFF);
+                src += 4;
+            }
+            else
+                src += 2;
+        }
+        else if ((w & 0xC0C0F0) == 0x8080E0) // 3 byte sequence E0..EF 80..BF 80..BF
+        {
+            if ((w & 0xFF) == 0xE0 && (w & 0x2000) == 0) // E0 80..9F (overlong)
+                break;
+            if ((w & 0xFF) == 0xED && (w & 0x2000) != 0) // ED A0..BF (surrogate)
+                break;
+
+            *out++ = (type_char8)(w & 0xFF);
+            *out++ = (type_char8)((w >> 8) & 0xFF);
+            *out++ = (type_char8)((w >> 16) & 0xFF);
+            src += 3;
+        }
+        else if ((w & 0xC0C0C0F8) == 0x808080F0) // 4 byte sequence F0..F7 80..BF 80..BF 80..BF
+        {
+            if ((w & 0xFF) > 0xF4) // F5..F7
+                break;
+            if ((w & 0xFF) == 0xF0 && (w & 0x3000) == 0) // F0 80..8F (overlong)
+                break;
+            if ((w & 0xFF) == 0xF4 && (w & 0x3000) != 0) // F4 90..BF (> U+10FFFF)
+                break;
+
+            *out++ = (type_char8)(w & 0xFF);
+            *out++ = (type_char8)((w >> 8) & 0xFF);
+            *out++ = (type_char8)((w >> 16) & 0xFF);
+            *out++ = (type_char8)((w >> 24) & 0xFF);
+            src += 4;
+        }
+        else
+            break;
+    }
+
+    if (src == *s)
+        return false;
+
+    *s = src;
+    *dst = out;
+
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_length_utf8(it_in_utf8* s, it_end_utf8 last, size_t* count, size_t* pairs)
+{
+    // The same as fast_valid_utf8 function but also counts the skipped code points
+    // and 4 byte sequences that are surrogate pairs in UTF-16 for impl_length_from_utf8 function.
+
+    bool processed = false;
+
+    while (last - *s >= 4)
+    {
+        type_codept w = 0;
+        w |= ((type_codept)*(*s+0) & 0xFF);
+        w |= ((type_codept)*(*s+1) & 0xFF) << 8;
+        w |= ((type_codept)*(*s+2) & 0xFF) << 16;
+        w |= ((type_codept)*(*s+3) & 0xFF) << 24;
+
+        if ((w & 0x80808080) == 0) // 4 ASCII bytes
+        {
+            *s += 4;
+            *count += 4;
+
+            // Long ASCII runs are the most common case so process them by 8 bytes at once
+            for (it_in_utf8 end = *s + (last - *s) - ((last - *s) % 8); *s != end; *s += 8)
+            {
+                type_codept w1 = 0, w2 = 0;
+                w1 |= ((type_codept)*(*s+0) & 0xFF);
+                w1 |= ((type_codept)*(*s+1) & 0xFF) << 8;
+                w1 |= ((type_codept)*(*s+2) & 0xFF) << 16;
+                w1 |= ((type_codept)*(*s+3) & 0xFF) << 24;
+                w2 |= ((type_codept)*(*s+4) & 0xFF);
+                w2 |= ((type_codept)*(*s+5) & 0xFF) << 8;
+                w2 |= ((type_codept)*(*s+6) & 0xFF) << 16;
+                w2 |= ((type_codept)*(*s+7) & 0xFF) << 24;
+
+                // Note that (w1 | w2) must not be used here because then
+                // compilers cannot optimize manual load into one instruction
+                if ((w1 & 0x80808080) != 0 || (w2 & 0x80808080) != 0)
+                    break;
+
+                *count += 8;
+            }
+        }
+        else if ((w & 0x80) == 0) // ASCII byte
+        {
+            *s += 1;
+            *count += 1;
+        }
+        else if ((w & 0xC0E0) == 0x80C0 && (w & 0x1E) != 0) // 2 byte sequence C2..DF 80..BF
+        {
+            // Most likely it is followed by another 2 byte sequence
+            if ((w & 0xC0E00000) == 0x80C00000 && (w & 0x1E0000) != 0)
+            {
+                *s += 4;
+                *count += 2;
+            }
+            else
+            {
+                *s += 2;
+                *count += 1;
+            }
+        }
+        else if ((w & 0xC0C0F0) == 0x8080E0) // 3 byte sequence E0..EF 80..BF 80..BF
+        {
+            if ((w & 0xFF) == 0xE0 && (w & 0x2000) == 0) // E0 80..9F (overlong)
+                break;
+            if ((w & 0xFF) == 0xED && (w & 0x2000) != 0) // ED A0..BF (surrogate)
+                break;
+
+            *s += 3;
+            *count += 1;
+        }
+        else if ((w & 0xC0C0C0F8) == 0x808080F0) // 4 byte sequence F0..F7 80..BF 80..BF 80..BF
+        {
+            if ((w & 0xFF) > 0xF4) // F5..F7
+                break;
+            if ((w & 0xFF) == 0xF0 && (w & 0x3000) == 0) // F0 80..8F (overlong)
+                break;
+            if ((w & 0xFF) == 0xF4 && (w & 0x3000) != 0) // F4 90..BF (> U+10FFFF)
+                break;
+
+            *s += 4;
+            *count += 1;
+            *pairs += 1;
+        }
+        else
+            break;
+
+        processed = true;
+    }
+
+    return processed;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16to8(it_in_utf16* s, it_end_utf16 last, it_out_utf8* dst)
+{
+    // This optimization makes processing of ASCII and CJK strings by about 5-15% faster
+    // it is the same idea as fast_utf8to16 function but for UTF-16 code units.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    // Only code units that are not surrogates and well-formed surrogate pairs are processed here
+    // so the output is always the same as in the main loop of impl_utf16to8 function.
+    // If there is something else (lone surrogate) then drop from the function
+    // and the main loop will handle it and U+FFFD properly.
+    // 4 code units must be available so 4 ASCII code units can be processed at once
+    // and a surrogate pair can be read without the end checks.
+    // Note that the iterators are copied because UTF-8 output can alias them
+    // so a compiler cannot keep them in registers otherwise.
+
+    it_in_utf16 src = *s;
+    it_out_utf8 out = *dst;
+    bool block = false; // The previous step was 4 ASCII code units
+
+    while (last - src >= 4)
+    {
+        const type_codept h = ((type_codept)*(src+0) & 0xFFFF);
+
+        if (h <= 0x7F)
         {
-            if (/*h >= 0xD800 &&*/ h <= 0xDBFF) // High surrogate is in range
+            const type_codept c2 = ((type_codept)*(src+1) & 0xFFFF);
+            const type_codept c3 = ((type_codept)*(src+2) & 0xFFFF);
+            const type_codept c4 = ((type_codept)*(src+3) & 0xFFFF);
+
+            if (((c2 | c3 | c4) & 0xFF80) == 0)
             {
-                if (src != last) // Unpaired high surrogate if reached the end here
-                {
-                    const type_codept l = (*src & 0xFFFF);
+                *out++ = (type_char8)h;
+                *out++ = (type_char8)c2;
+                *out++ = (type_char8)c3;
+                *out++ = (type_char8)c4;
+                src += 4;
 
-                    if (l >= 0xDC00 && l <= 0xDFFF) // Low surrogate is in range
-                    {
-                        ++src;
-                        continue;
-                    }
-                }
+                block = true;
+                continue;
             }
+            else
+            {
+                // ASCII mixed with other sequences, see impl_fast_attempts
+                if (block)
+                    break;
+
+                *out++ = (type_char8)h;
+                src += 1;
+            }
+        }
+        else if (h <= 0x7FF)
+        {
+            *out++ = (type_char8)(0xC0 | (h >> 6));
+            *out++ = (type_char8)(0x80 | (h & 0x3F));
+            src += 1;
+        }
+        else if (h < 0xD800 || h > 0xDFFF)
+        {
+            *out++ = (type_char8)(0xE0 |  (h >> 12));
+            *out++ = (type_char8)(0x80 | ((h >> 6) & 0x3F));
+            *out++ = (type_char8)(0x80 |  (h       & 0x3F));
+            src += 1;
         }
         else
-        { // NOLINT(bugprone-branch-clone)
-            continue;
+        {
+            const type_codept l = ((type_codept)*(src+1) & 0xFFFF);
+
+            if (h > 0xDBFF || l < 0xDC00 || l > 0xDFFF)
+                break;
+
+            const type_codept c = ((h - 0xD800) << 10) + (l - 0xDC00) + 0x10000;
+
+            *out++ = (type_char8)(0xF0 |  (c >> 18));
+            *out++ = (type_char8)(0x80 | ((c >> 12) & 0x3F));
+            *out++ = (type_char8)(0x80 | ((c >> 6)  & 0x3F));
+            *out++ = (type_char8)(0x80 |  (c        & 0x3F));
+            src += 2;
         }
 
-        // Error: lone low surrogate or broken surrogate pair in UTF-16
+        block = false;
+    }
 
-        if (error) // *error points to the start of ill-formed sequence
-            *error = (size_t)(src - first) - 1;
+    if (src == *s)
+        return false;
+
+    *s = src;
+    *dst = out;
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_ascii_utf32to8(it_in_utf32* s, it_end_utf32 last, it_out_utf8* dst)
+{
+    // The same as fast_ascii_utf8to32 function but the other way around
+
+    bool processed = false;
+
+    for (it_in_utf32 end = *s + (last - *s) - ((last - *s) % 4); *s != end; *s += 4)
+    {
+        const type_codept c1 = ((type_codept)*(*s+0) & 0xFFFFFFFF);
+        const type_codept c2 = ((type_codept)*(*s+1) & 0xFFFFFFFF);
+        const type_codept c3 = ((type_codept)*(*s+2) & 0xFFFFFFFF);
+        const type_codept c4 = ((type_codept)*(*s+3) & 0xFFFFFFFF);
+
+        if (((c1 | c2 | c3 | c4) & 0xFFFFFF80) != 0)
+            break;
+
+        *(*dst)++ = (type_char8)c1;
+        *(*dst)++ = (type_char8)c2;
+        *(*dst)++ = (type_char8)c3;
+        *(*dst)++ = (type_char8)c4;
+
+        processed = true;
+    }
+
+    return processed;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf32>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16to32(it_in_utf16* s, it_end_utf16 last, it_out_utf32* dst)
+{
+    // This optimization makes processing of text in BMP faster, it is the same idea
+    // as fast_utf16to8 function: 4 code units that are not surrogates are processed at once
+    // and well-formed surrogate pairs one by one without the end checks.
+    // If there is a lone surrogate then drop from the function and the main loop
+    // of impl_utf16to32 function will handle it and U+FFFD properly.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    it_in_utf16 src = *s;
+    it_out_utf32 out = *dst;
+
+    while (last - src >= 4)
+    {
+        const type_codept h = ((type_codept)*(src+0) & 0xFFFF);
+
+        if ((h & 0xF800) != 0xD800) // Not a surrogate
+        {
+            const type_codept c2 = ((type_codept)*(src+1) & 0xFFFF);
+            const type_codept c3 = ((type_codept)*(src+2) & 0xFFFF);
+            const type_codept c4 = ((type_codept)*(src+3) & 0xFFFF);
+
+            if ((c2 & 0xF800) != 0xD800 && (c3 & 0xF800) != 0xD800 && (c4 & 0xF800) != 0xD800)
+            {
+                *out++ = (type_char32)h;
+                *out++ = (type_char32)c2;
+                *out++ = (type_char32)c3;
+                *out++ = (type_char32)c4;
+                src += 4;
+            }
+            else
+            {
+                *out++ = (type_char32)h;
+                src += 1;
+            }
+        }
+        else
+        {
+            const type_codept l = ((type_codept)*(src+1) & 0xFFFF);
+
+            if (h > 0xDBFF || l < 0xDC00 || l > 0xDFFF)
+                break;
 
+            *out++ = (type_char32)(((h - 0xD800) << 10) + (l - 0xDC00) + 0x10000);
+            src += 2;
+        }
+    }
+
+    if (src == *s)
         return false;
+
+    *s = src;
+    *dst = out;
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32, typename it_end_utf32, typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf32to16(it_in_utf32* s, it_end_utf32 last, it_out_utf16* dst)
+{
+    // The same as fast_utf16to32 function but the other way around
+    // 4 code points in BMP that are not surrogates are processed at once
+    // and other valid code points one by one without the end checks.
+    // If there is a surrogate or a code point > 0x10FFFF then drop from the function
+    // and the main loop of impl_utf32to16 function will handle it and U+FFFD properly.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    it_in_utf32 src = *s;
+    it_out_utf16 out = *dst;
+
+    while (last - src >= 4)
+    {
+        const type_codept c = ((type_codept)*(src+0) & 0xFFFFFFFF);
+
+        if (c <= 0xFFFF)
+        {
+            if (c >= 0xD800 && c <= 0xDFFF)
+                break;
+
+            const type_codept c2 = ((type_codept)*(src+1) & 0xFFFFFFFF);
+            const type_codept c3 = ((type_codept)*(src+2) & 0xFFFFFFFF);
+            const type_codept c4 = ((type_codept)*(src+3) & 0xFFFFFFFF);
+
+            // The same as (c <= 0xFFFF && !(c >= 0xD800 && c <= 0xDFFF)) for every code point
+            if (((c2 | c3 | c4) & 0xFFFF0000) == 0 &&
+                (c2 & 0xF800) != 0xD800 && (c3 & 0xF800) != 0xD800 && (c4 & 0xF800) != 0xD800)
+            {
+                *out++ = (type_char16)c;
+                *out++ = (type_char16)c2;
+                *out++ = (type_char16)c3;
+                *out++ = (type_char16)c4;
+                src += 4;
+            }
+            else
+            {
+                *out++ = (type_char16)c;
+                src += 1;
+            }
+        }
+        else if (c <= 0x10FFFF) // Make a surrogate pair
+        {
+            *out++ = (type_char16)(0xD7C0 + (c >> 10));
+            *out++ = (type_char16)(0xDC00 + (c & 0x3FF));
+            src += 1;
+        }
+        else
+            break;
     }
 
+    if (src == *s)
+        return false;
+
+    *s = src;
+    *dst = out;
     return true;
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf32, typename it_end_utf32>
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
 #endif
-uaix_static bool impl_is_valid_utf32(it_in_utf32 first, it_end_utf32 last, size_t* const error)
+uaix_always_inline_tmpl
+uaix_static bool fast_utf16bytes_to8(it_in_utf8* s, it_end_utf8 last, it_out_utf8* dst, bool big_endian)
 {
-    // Based on impl_utf32to8 function
+    // The same as fast_utf16to8 function but for UTF-16BE/LE bytes so a code unit is read from 2 bytes
+    // 8 bytes (4 code units) must be available so 4 ASCII code units can be processed at once
+    // and a surrogate pair can be read without the end checks.
+    // Note that the iterators are copied because UTF-8 output can alias them.
+    // C++ Note: works only with contiguous or random access input iterators
 
-    it_in_utf32 src = first;
+    it_in_utf8 src = *s;
+    it_out_utf8 out = *dst;
 
-    while (src != last)
+    const type_codept shift1 = big_endian ? 8 : 0;
+    const type_codept shift2 = big_endian ? 0 : 8;
+
+    while (last - src >= 8)
     {
-        const type_codept c = ((type_codept)*src & 0xFFFFFFFF);
-        ++src;
+        const type_codept h = ((type_codept)(*(src+0) & 0xFF) << shift1) | ((type_codept)(*(src+1) & 0xFF) << shift2);
+
+        if (h <= 0x7F)
+        {
+            const type_codept c2 = ((type_codept)(*(src+2) & 0xFF) << shift1) | ((type_codept)(*(src+3) & 0xFF) << shift2);
+            const type_codept c3 = ((type_codept)(*(src+4) & 0xFF) << shift1) | ((type_codept)(*(src+5) & 0xFF) << shift2);
+            const type_codept c4 = ((type_codept)(*(src+6) & 0xFF) << shift1) | ((type_codept)(*(src+7) & 0xFF) << shift2);
+
+            if (((c2 | c3 | c4) & 0xFF80) == 0)
+            {
+                *out++ = (type_char8)h;
+                *out++ = (type_char8)c2;
+                *out++ = (type_char8)c3;
+                *out++ = (type_char8)c4;
+                src += 8;
+            }
+            else
+            {
+                *out++ = (type_char8)h;
+                src += 2;
+            }
+        }
+        else if (h <= 0x7FF)
+        {
+            *out++ = (type_char8)(0xC0 | (h >> 6));
+            *out++ = (type_char8)(0x80 | (h & 0x3F));
+            src += 2;
+        }
+        else if (h < 0xD800 || h > 0xDFFF)
+        {
+            *out++ = (type_char8)(0xE0 |  (h >> 12));
+            *out++ = (type_char8)(0x80 | ((h >> 6) & 0x3F));
+            *out++ = (type_char8)(0x80 |  (h       & 0x3F));
+            src += 2;
+        }
+        else
+        {
+            const type_codept l = ((type_codept)(*(src+2) & 0xFF) << shift1) | ((type_codept)(*(src+3) & 0xFF) << shift2);
+
+            if (h > 0xDBFF || l < 0xDC00 || l > 0xDFFF)
+                break;
+
+            const type_codept c = ((h - 0xD800) << 10) + (l - 0xDC00) + 0x10000;
+
+            *out++ = (type_char8)(0xF0 |  (c >> 18));
+            *out++ = (type_char8)(0x80 | ((c >> 12) & 0x3F));
+            *out++ = (type_char8)(0x80 | ((c >> 6)  & 0x3F));
+            *out++ = (type_char8)(0x80 |  (c        & 0x3F));
+            src += 4;
+        }
+    }
+
+    if (src == *s)
+        return false;
+
+    *s = src;
+    *dst = out;
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool fast_utf32bytes_to8(it_in_utf8* s, it_end_utf8 last, it_out_utf8* dst, bool big_endian)
+{
+    // The same as fast_utf16bytes_to8 function but for UTF-32BE/LE bytes, all valid code points
+    // are processed here one by one without the end checks and if there is something else
+    // (surrogate or out of range) then drop from the function and the main loop will handle it.
+    // Note that the iterators are copied because UTF-8 output can alias them.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    it_in_utf8 src = *s;
+    it_out_utf8 out = *dst;
+
+    const type_codept shift0 = big_endian ? 24 : 0;
+    const type_codept shift1 = big_endian ? 16 : 8;
+    const type_codept shift2 = big_endian ? 8 : 16;
+    const type_codept shift3 = big_endian ? 0 : 24;
+
+    while (last - src >= 4)
+    {
+        const type_codept c = ((type_codept)(*(src+0) & 0xFF) << shift0) | ((type_codept)(*(src+1) & 0xFF) << shift1) |
+                              ((type_codept)(*(src+2) & 0xFF) << shift2) | ((type_codept)(*(src+3) & 0xFF) << shift3);
 
         if (c <= 0x7F)
-        { // NOLINT(bugprone-branch-clone)
-            continue;
+        {
+            *out++ = (type_char8)c;
         }
         else if (c <= 0x7FF)
-        { // NOLINT(bugprone-branch-clone)
-            continue;
+        {
+            *out++ = (type_char8)(0xC0 | (c >> 6));
+            *out++ = (type_char8)(0x80 | (c & 0x3F));
         }
         else if (c <= 0xFFFF)
         {
-            if (!(c >= 0xD800 && c <= 0xDFFF)) // If not in surrogate pairs range
-            {
-                continue;
-            }
+            if (c >= 0xD800 && c <= 0xDFFF)
+                break;
+
+            *out++ = (type_char8)(0xE0 |  (c >> 12));
+            *out++ = (type_char8)(0x80 | ((c >> 6) & 0x3F));
+            *out++ = (type_char8)(0x80 |  (c       & 0x3F));
         }
         else if (c <= 0x10FFFF)
-        { // NOLINT(bugprone-branch-clone)
-            continue;
+        {
+            *out++ = (type_char8)(0xF0 |  (c >> 18));
+            *out++ = (type_char8)(0x80 | ((c >> 12) & 0x3F));
+            *out++ = (type_char8)(0x80 | ((c >> 6)  & 0x3F));
+            *out++ = (type_char8)(0x80 |  (c        & 0x3F));
         }
+        else
+            break;
 
-        // Error: code point > 0x10FFFF or surrogate in UTF-32
-
-        if (error) // *error points to invalid code point
-            *error = (size_t)(src - first) - 1;
+        src += 4;
+    }
 
+    if (src == *s)
         return false;
-    }
 
+    *s = src;
+    *dst = out;
     return true;
 }
 
@@ -826,91 +2893,94 @@ uaix_static bool impl_is_valid_utf32(it_in_utf32 first, it_end_utf32 last, size_
 template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
 #endif
 uaix_always_inline_tmpl
-uaix_static bool fast_ascii_utf8to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst)
+uaix_static bool fast_utf16bytes_to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst, bool big_endian)
 {
-    // This optimization makes processing of ASCII strings by about 20-30% faster
+    // The same as fast_utf16bytes_to8 function but the result is UTF-16 so a code unit is copied as is,
+    // 4 bytes must be available so a surrogate pair can be read without the end checks.
     // C++ Note: works only with contiguous or random access input iterators
 
-    bool processed = false;
+    it_in_utf8 src = *s;
+    it_out_utf16 out = *dst;
 
-    for (it_in_utf8 end = *s + (last - *s) - ((last - *s) % 4); *s != end; *s += 4)
-    {
-        // There are 3 ways to perform unaligned load:
-        // 1. uint32_t = *((uint32_t*)uint8_t*); // Unsafe and not portable garbage.
-        // 2. memcpy(&uint32_t, uint8_t*, 4); // Better but won't work for us for many reasons.
-        // 3. Manual load. Harder to optimize for a compiler but safe and without potential function call in the worst case.
-        // So we use manual load here.
-        // In the best case scenario the following 4 lines will be optimized into one mov instruction
-        // in the worst case it won't but we only lose a bit performance, processing by 4 bytes is always faster.
-        // Note that manual load is endian agnostic too compared to other ways so we don't need to deal with that crap.
-        // This means the behaviour will be the same on little/big/middle endian systems the value c will be the same.
-        type_codept c = 0;
-        c |= ((type_codept)*(*s+0) & 0xFF);
-        c |= ((type_codept)*(*s+1) & 0xFF) << 8;
-        c |= ((type_codept)*(*s+2) & 0xFF) << 16;
-        c |= ((type_codept)*(*s+3) & 0xFF) << 24;
+    const type_codept shift1 = big_endian ? 8 : 0;
+    const type_codept shift2 = big_endian ? 0 : 8;
 
-        // If non-ASCII then drop from the function and proceed as usual
-        if ((c & 0x80808080) != 0)
-            break;
+    while (last - src >= 4)
+    {
+        const type_codept h = ((type_codept)(*(src+0) & 0xFF) << shift1) | ((type_codept)(*(src+1) & 0xFF) << shift2);
 
-        // This is not unaligned store even though it looks like it, we just do the usual thing here.
-        *(*dst)++ = (type_char16)(c & 0xFF);
-        *(*dst)++ = (type_char16)((c >> 8) & 0xFF);
-        *(*dst)++ = (type_char16)((c >> 16) & 0xFF);
-        *(*dst)++ = (type_char16)((c >> 24) & 0xFF);
+        if (h < 0xD800 || h > 0xDFFF)
+        {
+            *out++ = (type_char16)h;
+            src += 2;
+        }
+        else
+        {
+            const type_codept l = ((type_codept)(*(src+2) & 0xFF) << shift1) | ((type_codept)(*(src+3) & 0xFF) << shift2);
 
-        // This is how unaligned store should look like it can be used for potential utf8to8 function.
-        // Even though a compiler probably optimize both variants the same for such function.
-        //*(*dst+0) = (impl_char8)(c & 0xFF);
-        //*(*dst+1) = (impl_char8)((c >> 8) & 0xFF);
-        //*(*dst+2) = (impl_char8)((c >> 16) & 0xFF);
-        //*(*dst+3) = (impl_char8)((c >> 24) & 0xFF);
-        //*dst += 4;
+            if (h > 0xDBFF || l < 0xDC00 || l > 0xDFFF)
+                break;
 
-        processed = true;
+            *out++ = (type_char16)h;
+            *out++ = (type_char16)l;
+            src += 4;
+        }
     }
 
-    return processed;
-
-    // NOTE from mg152:
-    // In my observations MSVC never optimize manual load, GCC and Clang optimize it starting with version 5.
-    // See test/random_stuff/unaligned_load_store.h to check which compiler is able to optimize it properly.
-    // It is possible to make it faster by using long long and processing by 8 bytes or even intrinsics like _mm_loadu_si128
-    // but it will be much less portable and the number of defines to handle it will be enormous.
-    // So the basic optimization should be enough it's over optimization anyway I just did it for fun. At least it's always safe.
+    if (src == *s)
+        return false;
 
-    // For reference: https://blog.quarkslab.com/unaligned-accesses-in-cc-what-why-and-solutions-to-do-it-properly.html
+    *s = src;
+    *dst = out;
+    return true;
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32>
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf16>
 #endif
 uaix_always_inline_tmpl
-uaix_static bool fast_ascii_utf8to32(it_in_utf8* s, it_end_utf8 last, it_out_utf32* dst)
+uaix_static bool fast_utf32bytes_to16(it_in_utf8* s, it_end_utf8 last, it_out_utf16* dst, bool big_endian)
 {
-    bool processed = false;
+    // The same as fast_utf32bytes_to8 function but the result is UTF-16
+    // C++ Note: works only with contiguous or random access input iterators
 
-    for (it_in_utf8 end = *s + (last - *s) - ((last - *s) % 4); *s != end; *s += 4)
+    it_in_utf8 src = *s;
+    it_out_utf16 out = *dst;
+
+    const type_codept shift0 = big_endian ? 24 : 0;
+    const type_codept shift1 = big_endian ? 16 : 8;
+    const type_codept shift2 = big_endian ? 8 : 16;
+    const type_codept shift3 = big_endian ? 0 : 24;
+
+    while (last - src >= 4)
     {
-        type_codept c = 0;
-        c |= ((type_codept)*(*s+0) & 0xFF);
-        c |= ((type_codept)*(*s+1) & 0xFF) << 8;
-        c |= ((type_codept)*(*s+2) & 0xFF) << 16;
-        c |= ((type_codept)*(*s+3) & 0xFF) << 24;
+        const type_codept c = ((type_codept)(*(src+0) & 0xFF) << shift0) | ((type_codept)(*(src+1) & 0xFF) << shift1) |
+                              ((type_codept)(*(src+2) & 0xFF) << shift2) | ((type_codept)(*(src+3) & 0xFF) << shift3);
 
-        if ((c & 0x80808080) != 0)
-            break;
+        if (c <= 0xFFFF)
+        {
+            if (c >= 0xD800 && c <= 0xDFFF)
+                break;
 
-        *(*dst)++ = (type_char32)(c & 0xFF);
-        *(*dst)++ = (type_char32)((c >> 8) & 0xFF);
-        *(*dst)++ = (type_char32)((c >> 16) & 0xFF);
-        *(*dst)++ = (type_char32)((c >> 24) & 0xFF);
+            *out++ = (type_char16)c;
+        }
+        else if (c <= 0x10FFFF)
+        {
+            *out++ = (type_char16)(0xD7C0 + (c >> 10));
+            *out++ = (type_char16)(0xDC00 + (c & 0x3FF));
+        }
+        else
+            break;
 
-        processed = true;
+        src += 4;
     }
 
-    return processed;
+    if (src == *s)
+        return false;
+
+    *s = src;
+    *dst = out;
+    return true;
 }
 
 UNI_ALGO_IMPL_NAMESPACE_END
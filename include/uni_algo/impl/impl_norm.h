@@ -55,17 +55,21 @@ uaix_const size_t impl_x_norm_to_nfd_utf8       = 3;  // tag_unicode_unstable_va
 #ifndef UNI_ALGO_DISABLE_NFKC_NFKD
 uaix_const size_t impl_x_norm_to_nfkc_utf8      = 11; // tag_unicode_unstable_value
 uaix_const size_t impl_x_norm_to_nfkd_utf8      = 11; // tag_unicode_unstable_value
+uaix_const size_t impl_x_norm_to_nfkc_casefold_utf8  = 11; // tag_unicode_unstable_value
 #endif
 uaix_const size_t impl_x_norm_to_nfc_utf16      = 3;  // tag_unicode_stable_value
 uaix_const size_t impl_x_norm_to_nfd_utf16      = 4;  // tag_unicode_unstable_value
 #ifndef UNI_ALGO_DISABLE_NFKC_NFKD
 uaix_const size_t impl_x_norm_to_nfkc_utf16     = 18; // tag_unicode_unstable_value
 uaix_const size_t impl_x_norm_to_nfkd_utf16     = 18; // tag_unicode_unstable_value
+uaix_const size_t impl_x_norm_to_nfkc_casefold_utf16 = 18; // tag_unicode_unstable_value
 #endif
 #ifndef UNI_ALGO_DISABLE_PROP
 uaix_const size_t impl_x_norm_to_unaccent_utf8  = 3;  // tag_unicode_stable_value
 uaix_const size_t impl_x_norm_to_unaccent_utf16 = 3;  // tag_unicode_stable_value
 #endif
+uaix_const size_t impl_x_norm_to_stream_safe_utf8  = 3; // tag_unicode_stable_value
+uaix_const size_t impl_x_norm_to_stream_safe_utf16 = 2; // tag_unicode_stable_value
 // Only Decomposition_Mapping of NFC is Unicode stable value for strings.
 // https://www.unicode.org/policies/stability_policy.html#Property_Value
 
@@ -135,6 +139,27 @@ uaix_static type_codept stages_decomp_nfkd_cp(size_t offset, size_t i)
     return stage3_decomp_nfkd[offset + i + 1];
 }
 
+uaix_always_inline
+uaix_static size_t stages_nfkc_cf(type_codept c)
+{
+    // return offset to NFKC_Casefold mapping or 0 if there is no mapping
+    return stages(c, stage1_nfkc_cf, stage2_nfkc_cf);
+}
+
+uaix_always_inline
+uaix_static size_t stages_nfkc_cf_number(size_t offset)
+{
+    // return number of code points in NFKC_Casefold mapping (0 means the code point is removed)
+    return stage3_nfkc_cf[offset];
+}
+
+uaix_always_inline
+uaix_static type_codept stages_nfkc_cf_cp(size_t offset, size_t i)
+{
+    // return code point by index in NFKC_Casefold mapping (the mapping is in NFC)
+    return stage3_nfkc_cf[offset + i + 1];
+}
+
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 uaix_always_inline
@@ -203,6 +228,9 @@ uaix_const type_codept norm_bound_nfd  = 0x00C0;
 uaix_const type_codept norm_bound_nfkc = 0x00A0;
 uaix_const type_codept norm_bound_nfkd = 0x00A0;
 #endif
+// Everything below this bound is a stable starter in every normalization form and has no
+// non-starters in NFKD, unlike norm_bound_nfkd it exists if NFKC and NFKD are disabled
+uaix_const type_codept norm_bound_stable = 0x00A0;
 
 uaix_always_inline
 uaix_static bool stages_ccc_qc_yes(type_codept ccc_qc, type_codept bit)
@@ -227,7 +255,12 @@ uaix_static bool stages_ccc_qc_ns(type_codept ccc_qc, size_t* const count_ns)
     {
         *count_ns += ccc_qc >> 14;
         if (*count_ns > impl_max_norm_non_starters)
+        {
+            // CGJ will be inserted before the code point so only its non-starters must remain
+            // after norm_decomp_count_ns (or impl_norm_to_stream_safe) subtracts the max value
+            *count_ns = impl_max_norm_non_starters + (ccc_qc >> 14);
             return false;
+        }
     }
     else
     {
@@ -251,7 +284,7 @@ uaix_static bool stages_qc_yes_ns(type_codept c, size_t* const count_ns, type_co
      * Quick_Check=Yes and Canonical_Combining_Class=0.
      */
 
-    if (c >= norm_bound_nfkd) // NFKD lower bound
+    if (c >= norm_bound_stable) // NFKD lower bound
     {
         const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
         if (!stages_ccc_qc_ns(ccc_qc, count_ns))
@@ -718,6 +751,100 @@ uaix_static bool norm_decomp_nfkd(type_codept c, struct norm_buffer* const buffe
     return norm_decomp_return(buffer, m);
 }
 
+uaix_always_inline
+uaix_static void norm_push_nfkc_cf(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m)
+{
+    // The same as norm_decomp_count_ns but non-starters are counted after the mapping
+    // because the mapping can change starters to non-starters (U+FF9E -> U+3099) and vice versa
+    // (U+0345 -> U+03B9), so CGJ is inserted at the same positions when the function is applied
+    // to its own result again and the result is stable after CGJ is dropped from it
+
+    const unsigned char ccc = stages_ccc(c);
+    if (ccc == 0)
+        m->count_ns = 0;
+    else if (++m->count_ns > impl_max_norm_non_starters)
+    {
+        m->count_ns = 1;
+        buffer->cps[m->size] = 0x034F;
+        buffer->ccc[m->size] = 0;
+        m->last_qc = m->size;
+        ++m->size;
+    }
+
+    buffer->cps[m->size] = c;
+    buffer->ccc[m->size] = ccc;
+    if (stages_qc_yes(c, norm_bit_nfkc))
+        m->last_qc = m->size;
+    ++m->size;
+}
+
+uaix_always_inline
+uaix_static void norm_push_nfd_nfkc_cf(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m)
+{
+    // NFKC_Casefold mapping is in NFC so decompose it back to NFD for canonical ordering
+    // Do not decompose Hanguls the same as in norm_decomp_nfc
+
+    const size_t offset = stages_decomp_nfd(c);
+    if (offset == 0)
+        norm_push_nfkc_cf(c, buffer, m);
+    else
+    {
+        const size_t number = stages_decomp_nfd_number(offset);
+        for (size_t i = 0; i < number; ++i)
+            norm_push_nfkc_cf(stages_decomp_nfd_cp(offset, i), buffer, m);
+    }
+}
+
+uaix_always_inline
+uaix_static bool norm_map_nfkc_cf_fast(type_codept* const c)
+{
+    // Simple mapping to a starter with Quick_Check=Yes (for example A -> a)
+    // doesn't affect the fast loop so apply it in place, other mappings need the slow loop
+
+    const size_t offset = stages_nfkc_cf(*c);
+    if (offset == 0)
+        return true;
+    if (stages_nfkc_cf_number(offset) != 1)
+        return false;
+
+    const type_codept cp = stages_nfkc_cf_cp(offset, 0);
+    if (!stages_qc_yes(cp, norm_bit_nfkc))
+        return false;
+
+    *c = cp;
+    return true;
+}
+
+uaix_always_inline
+uaix_static bool norm_decomp_nfkc_cf(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m)
+{
+    // Algorithm: map every code point to NFKC_Casefold -> NFC
+    // https://www.unicode.org/reports/tr44/#NFKC_Casefold
+    // The mapping already includes compatibility decomposition and it is in NFC
+    // so only canonical decomposition of the mapped code points is needed before NFC,
+    // a code point that is removed by the mapping does not block canonical ordering
+    // Note that CGJ is inserted by norm_push_nfkc_cf and not by norm_decomp_count_ns
+
+    // The first code point is already mapped in the fast loop so only decompose it
+    if (m->size == 1)
+    {
+        m->size = 0;
+        norm_push_nfd_nfkc_cf(buffer->cps[0], buffer, m);
+    }
+
+    const size_t offset = stages_nfkc_cf(c);
+    if (offset == 0)
+        norm_push_nfd_nfkc_cf(c, buffer, m);
+    else
+    {
+        const size_t number = stages_nfkc_cf_number(offset);
+        for (size_t i = 0; i < number; ++i)
+            norm_push_nfd_nfkc_cf(stages_nfkc_cf_cp(offset, i), buffer, m);
+    }
+
+    return norm_decomp_return(buffer, m);
+}
+
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 #ifndef UNI_ALGO_DISABLE_PROP
@@ -782,7 +909,71 @@ uaix_static void norm_proc_buffer(struct norm_buffer* const buffer, struct norm_
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_in_utf8 fast_norm_skip_utf8(it_in_utf8 s, it_end_utf8 last, type_codept norm_bound)
+{
+    // This optimization makes normalization detection of ASCII strings several times faster
+    // and of Latin-1 etc. strings (2 byte sequences below the lower bound) about 1.5 times faster.
+    // It is also used in NFC normalization to find the spans that can be copied without changes.
+    // C++ Note: works only with contiguous or random access input iterators
+
+    // Everything below the lower bound has Quick_Check=Yes and Canonical_Combining_Class=0
+    // so such code points are skipped without decoding and the table lookup, ASCII by 8 bytes at once.
+    // Only well-formed sequences are skipped so ill-formed sequences are handled by the main loop.
+    // See fast_valid_utf8 in impl_conv.h for manual load and the masks, the bounds are always below U+0800.
+
+    while (last - s >= 4)
+    {
+        type_codept w = 0;
+        w |= ((type_codept)*(s+0) & 0xFF);
+        w |= ((type_codept)*(s+1) & 0xFF) << 8;
+        w |= ((type_codept)*(s+2) & 0xFF) << 16;
+        w |= ((type_codept)*(s+3) & 0xFF) << 24;
+
+        if ((w & 0x80808080) == 0) // 4 ASCII bytes
+        {
+            s += 4;
+
+            while (last - s >= 8)
+            {
+                type_codept w1 = 0, w2 = 0;
+                w1 |= ((type_codept)*(s+0) & 0xFF);
+                w1 |= ((type_codept)*(s+1) & 0xFF) << 8;
+                w1 |= ((type_codept)*(s+2) & 0xFF) << 16;
+                w1 |= ((type_codept)*(s+3) & 0xFF) << 24;
+                w2 |= ((type_codept)*(s+4) & 0xFF);
+                w2 |= ((type_codept)*(s+5) & 0xFF) << 8;
+                w2 |= ((type_codept)*(s+6) & 0xFF) << 16;
+                w2 |= ((type_codept)*(s+7) & 0xFF) << 24;
+
+                // Note that (w1 | w2) must not be used here because then
+                // compilers cannot optimize manual load into one instruction
+                if ((w1 & 0x80808080) != 0 || (w2 & 0x80808080) != 0)
+                    break;
+
+                s += 8;
+            }
+        }
+        else if ((w & 0x80) == 0) // ASCII byte
+        {
+            s += 1;
+        }
+        else if ((w & 0xC0E0) == 0x80C0 && (w & 0x1E) != 0 && // 2 byte sequence C2..DF 80..BF
+                 (((w & 0x1F) << 6) | ((w >> 8) & 0x3F)) < norm_bound)
+        {
+            s += 2;
+        }
+        else
+            break;
+    }
+
+    return s;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8, bool contiguous = true>
 #endif
 uaix_static size_t impl_norm_to_nfc_utf8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result)
 {
@@ -821,6 +1012,40 @@ uaix_static size_t impl_norm_to_nfc_utf8(it_in_utf8 first, it_end_utf8 last, it_
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+#ifdef __cplusplus
+                    if constexpr (contiguous)
+#endif
+                    {
+                        // Code points below the lower bound are always unchanged in NFC
+                        // so such spans are copied to the output without decoding and encoding.
+                        // The last code point of the span stays in the buffer because
+                        // it can be composed with the next code point.
+                        if (c < norm_bound_nfc)
+                        {
+                            it_in_utf8 s = fast_norm_skip_utf8(src, last, norm_bound_nfc);
+                            if (s != src)
+                            {
+                                // The span is well-formed and consists of 1 or 2 byte sequences
+                                it_in_utf8 s_last = s - 1;
+                                if (((type_codept)*s_last & 0xC0) == 0x80)
+                                    s_last = s - 2;
+
+                                dst = codepoint_to_utf8(buffer.cps[0], dst);
+                                for (; src != s_last; ++src)
+                                    *dst++ = (type_char8)*src;
+
+                                if (s_last + 1 == s)
+                                    buffer.cps[0] = (type_codept)*s_last & 0xFF;
+                                else
+                                    buffer.cps[0] = (((type_codept)*s_last & 0x1F) << 6) | ((type_codept)*(s_last+1) & 0x3F);
+                                src = s;
+
+                                // Count trailing non-starters of the last code point for Stream-Safe Text Process
+                                // it always returns true below the lower bound so the result is irrelevant
+                                stages_qc_yes_ns(buffer.cps[0], &m.count_ns, norm_bit_nfc);
+                            }
+                        }
+                    }
                     continue; // Fast loop ends here
                 }
             }
@@ -1015,6 +1240,67 @@ uaix_static size_t impl_norm_to_nfkd_utf8(it_in_utf8 first, it_end_utf8 last, it
     return (size_t)(dst - result);
 }
 
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_norm_to_nfkc_casefold_utf8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result)
+{
+    // The same as impl_norm_to_nfkc_utf8 but applies NFKC_Casefold mapping in the same pass
+
+    it_in_utf8 src = first;
+    it_out_utf8 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    struct norm_buffer buffer = {{0}, {0}}; // tag_can_be_uninitialized
+    struct norm_multi m = {0, 0, 0}; // tag_must_be_initialized
+
+    do
+    {
+        while (src != last)
+        {
+            src = iter_utf8(src, last, &c, iter_replacement);
+            if (uaix_likely((c < norm_bound_nfkc || stages_qc_yes(c, norm_bit_nfkc)) && norm_map_nfkc_cf_fast(&c)))
+            {
+                m.count_ns = 0;
+                if (uaix_likely(m.size == 1))
+                {
+                    dst = codepoint_to_utf8(buffer.cps[0], dst);
+                    m.size = 0;
+                }
+                if (uaix_likely(m.size == 0))
+                {
+                    buffer.cps[0] = c;
+                    buffer.ccc[0] = 0;
+                    m.size = 1;
+                    continue;
+                }
+            }
+            if (norm_decomp_nfkc_cf(c, &buffer, &m))
+                break;
+        }
+
+        if (m.last_qc == 0)
+            m.last_qc = m.size;
+
+        norm_order(&buffer, m.last_qc);
+        norm_comp(&buffer, m.last_qc);
+
+        // NFKC_Casefold removes CGJ so drop the one that was inserted by norm_push_nfkc_cf,
+        // otherwise the result is not stable: NFKC_Casefold(NFKC_Casefold(X)) != NFKC_Casefold(X)
+        for (size_t i = 0; i < m.last_qc; ++i)
+        {
+            if (buffer.ccc[i] != 255 && buffer.cps[i] != 0x034F)
+                dst = codepoint_to_utf8(buffer.cps[i], dst);
+        }
+
+        norm_proc_buffer(&buffer, &m);
+    }
+    while (m.size > 0);
+
+    return (size_t)(dst - result);
+}
+
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 #ifndef UNI_ALGO_DISABLE_PROP
@@ -1080,7 +1366,45 @@ uaix_static size_t impl_norm_to_unaccent_utf8(it_in_utf8 first, it_end_utf8 last
 #endif // UNI_ALGO_DISABLE_PROP
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8>
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_norm_to_stream_safe_utf8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result)
+{
+    // Stream-Safe Text Process without normalization
+    // https://unicode.org/reports/tr15/#Stream_Safe_Text_Process
+    // Insert U+034F COMBINING GRAPHEME JOINER (CGJ) before the code point that makes
+    // the sequence of non-starters in NFKD longer than 30. The normalization functions
+    // do the same (see norm_decomp_count_ns) so CGJ is never inserted again when the result is normalized.
+
+    it_in_utf8 src = first;
+    it_out_utf8 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    size_t count_ns = 0; // tag_must_be_initialized
+
+    while (src != last)
+    {
+        src = iter_utf8(src, last, &c, iter_replacement);
+        if (c >= norm_bound_stable)
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if (!stages_ccc_qc_ns(ccc_qc, &count_ns))
+            {
+                count_ns -= impl_max_norm_non_starters;
+                dst = codepoint_to_utf8(0x034F, dst);
+            }
+        }
+        else
+            count_ns = 0;
+
+        dst = codepoint_to_utf8(c, dst);
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, bool contiguous = true>
 #endif
 uaix_static int norm_detect_utf8(it_in_utf8 first, it_end_utf8 last, type_codept norm_bit, type_codept norm_bound)
 {
@@ -1095,7 +1419,15 @@ uaix_static int norm_detect_utf8(it_in_utf8 first, it_end_utf8 last, type_codept
         if (c == iter_error)
             return impl_norm_is_ill_formed;
         if (c < norm_bound)
+        {
             last_ccc = 0;
+
+            // Skip the following code points below the lower bound
+#ifdef __cplusplus
+            if constexpr (contiguous)
+#endif
+                src = fast_norm_skip_utf8(src, last, norm_bound);
+        }
         else
         {
             const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
@@ -1109,7 +1441,7 @@ uaix_static int norm_detect_utf8(it_in_utf8 first, it_end_utf8 last, type_codept
 }
 
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8>
+template<typename it_in_utf8, typename it_end_utf8, bool contiguous = true>
 #endif
 uaix_static int norm_detect_css_utf8(it_in_utf8 first, it_end_utf8 last, type_codept norm_bit, type_codept norm_bound)
 {
@@ -1128,6 +1460,12 @@ uaix_static int norm_detect_css_utf8(it_in_utf8 first, it_end_utf8 last, type_co
         {
             last_ccc = 0;
             count_ns = 0;
+
+            // Skip the following code points below the lower bound
+#ifdef __cplusplus
+            if constexpr (contiguous)
+#endif
+                src = fast_norm_skip_utf8(src, last, norm_bound);
         }
         else
         {
@@ -1163,8 +1501,140 @@ uaix_static int impl_norm_is_nfd_utf8(it_in_utf8 first, it_end_utf8 last, bool c
     return norm_detect_css_utf8(first, last, norm_bit_nfd, norm_bound_nfd);
 }
 
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, bool contiguous = true>
+#endif
+uaix_static size_t impl_norm_to_nfc_prefix_utf8(it_in_utf8 first, it_end_utf8 last)
+{
+    // Returns the length of the prefix that is unchanged in NFC and the rest of the string
+    // can be normalized separately so the string is already in NFC if the result is the length.
+    // The prefix ends at the last starter with Quick_Check=Yes before the first code point
+    // that fails the quick check because the composition and the reordering never cross such starter.
+    // The starter must not have initial non-starters in NFKD to keep Stream-Safe Text Process
+    // the same, so ill-formed sequences and the insertion of CGJ fail the quick check too.
+
+    it_in_utf8 src = first;
+    it_in_utf8 prefix = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    unsigned char last_ccc = 0; // tag_must_be_initialized
+    size_t count_ns = 0; // tag_must_be_initialized
+
+    while (src != last)
+    {
+        const it_in_utf8 prev = src;
+        src = iter_utf8(src, last, &c, iter_error);
+        if (c == iter_error)
+            return (size_t)(prefix - first);
+        if (c < norm_bound_nfc)
+        {
+            last_ccc = 0;
+            prefix = prev;
+            // Count trailing non-starters, it always returns true below the lower bound
+            stages_qc_yes_ns(c, &count_ns, norm_bit_nfc);
+
+            // Skip the following code points below the lower bound but the last one
+#ifdef __cplusplus
+            if constexpr (contiguous)
+#endif
+            {
+                const it_in_utf8 s = fast_norm_skip_utf8(src, last, norm_bound_nfc);
+                if (s != src)
+                {
+                    // The span is well-formed and consists of 1 or 2 byte sequences
+                    src = s - 1;
+                    if (((type_codept)*src & 0xC0) == 0x80)
+                        src = s - 2;
+                }
+            }
+        }
+        else
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if (!stages_ccc_qc_detect(ccc_qc, norm_bit_nfc) ||
+                !stages_ccc_qc_order(ccc_qc, &last_ccc) ||
+                !stages_ccc_qc_ns(ccc_qc, &count_ns))
+                return (size_t)(prefix - first);
+            if ((ccc_qc & 0xFF) == 0 && (ccc_qc >> 14) == 0)
+                prefix = prev;
+        }
+    }
+    return (size_t)(src - first);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static size_t impl_norm_split_utf8(it_in_utf8 first, it_end_utf8 last, type_codept norm_bit)
+{
+    // Returns the offset of the first stable starter or the length if there is no such starter.
+    // A stable starter is a starter with Quick_Check=Yes and without initial non-starters in NFKD
+    // the same as in impl_norm_to_nfc_prefix_utf8, so the string can be split at this point
+    // and the parts can be normalized separately with the same result as the whole string.
+    // Note that first can point to the middle of a sequence, ill-formed sequences are never stable.
+
+    it_in_utf8 src = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    while (src != last)
+    {
+        const it_in_utf8 prev = src;
+        src = iter_utf8(src, last, &c, iter_error);
+        if (c < norm_bound_stable)
+            return (size_t)(prev - first);
+        if (c != iter_error)
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if (stages_ccc_qc_yes(ccc_qc, norm_bit) && (ccc_qc >> 14) == 0)
+                return (size_t)(prev - first);
+        }
+    }
+    return (size_t)(src - first);
+}
+
 #ifndef UNI_ALGO_DISABLE_NFKC_NFKD
 
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static size_t impl_norm_split_nfkc_casefold_utf8(it_in_utf8 first, it_end_utf8 last, type_codept norm_bit)
+{
+    // The same as impl_norm_split_utf8 but NFKC_Casefold mapping must start with a stable starter too,
+    // for example a code point that is removed by the mapping cannot be used to split the string.
+
+    it_in_utf8 src = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    while (src != last)
+    {
+        const it_in_utf8 prev = src;
+        src = iter_utf8(src, last, &c, iter_error);
+        if (c < norm_bound_nfkd)
+            return (size_t)(prev - first);
+        if (c != iter_error)
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if ((ccc_qc >> 14) != 0)
+                continue;
+            const size_t offset = stages_nfkc_cf(c);
+            if (offset == 0)
+            {
+                if (stages_ccc_qc_yes(ccc_qc, norm_bit))
+                    return (size_t)(prev - first);
+            }
+            else if (stages_nfkc_cf_number(offset) != 0)
+            {
+                const type_codept cp_ccc_qc = stages(stages_nfkc_cf_cp(offset, 0), stage1_ccc_qc, stage2_ccc_qc);
+                if (stages_ccc_qc_yes(cp_ccc_qc, norm_bit) && (cp_ccc_qc >> 14) == 0)
+                    return (size_t)(prev - first);
+            }
+        }
+    }
+    return (size_t)(src - first);
+}
+
 #ifdef __cplusplus
 template<typename it_in_utf8, typename it_end_utf8>
 #endif
@@ -1408,6 +1878,67 @@ uaix_static size_t impl_norm_to_nfkd_utf16(it_in_utf16 first, it_end_utf16 last,
     return (size_t)(dst - result);
 }
 
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf16>
+#endif
+uaix_static size_t impl_norm_to_nfkc_casefold_utf16(it_in_utf16 first, it_end_utf16 last, it_out_utf16 result)
+{
+    // The same as impl_norm_to_nfkc_utf16 but applies NFKC_Casefold mapping in the same pass
+
+    it_in_utf16 src = first;
+    it_out_utf16 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    struct norm_buffer buffer = {{0}, {0}}; // tag_can_be_uninitialized
+    struct norm_multi m = {0, 0, 0}; // tag_must_be_initialized
+
+    do
+    {
+        while (src != last)
+        {
+            src = iter_utf16(src, last, &c, iter_replacement);
+            if (uaix_likely((c < norm_bound_nfkc || stages_qc_yes(c, norm_bit_nfkc)) && norm_map_nfkc_cf_fast(&c)))
+            {
+                m.count_ns = 0;
+                if (uaix_likely(m.size == 1))
+                {
+                    dst = codepoint_to_utf16(buffer.cps[0], dst);
+                    m.size = 0;
+                }
+                if (uaix_likely(m.size == 0))
+                {
+                    buffer.cps[0] = c;
+                    buffer.ccc[0] = 0;
+                    m.size = 1;
+                    continue;
+                }
+            }
+            if (norm_decomp_nfkc_cf(c, &buffer, &m))
+                break;
+        }
+
+        if (m.last_qc == 0)
+            m.last_qc = m.size;
+
+        norm_order(&buffer, m.last_qc);
+        norm_comp(&buffer, m.last_qc);
+
+        // NFKC_Casefold removes CGJ so drop the one that was inserted by norm_push_nfkc_cf,
+        // otherwise the result is not stable: NFKC_Casefold(NFKC_Casefold(X)) != NFKC_Casefold(X)
+        for (size_t i = 0; i < m.last_qc; ++i)
+        {
+            if (buffer.ccc[i] != 255 && buffer.cps[i] != 0x034F)
+                dst = codepoint_to_utf16(buffer.cps[i], dst);
+        }
+
+        norm_proc_buffer(&buffer, &m);
+    }
+    while (m.size > 0);
+
+    return (size_t)(dst - result);
+}
+
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 #ifndef UNI_ALGO_DISABLE_PROP
@@ -1470,6 +2001,44 @@ uaix_static size_t impl_norm_to_unaccent_utf16(it_in_utf16 first, it_end_utf16 l
 
 #endif // UNI_ALGO_DISABLE_PROP
 
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf16>
+#endif
+uaix_static size_t impl_norm_to_stream_safe_utf16(it_in_utf16 first, it_end_utf16 last, it_out_utf16 result)
+{
+    // Stream-Safe Text Process without normalization
+    // https://unicode.org/reports/tr15/#Stream_Safe_Text_Process
+    // Insert U+034F COMBINING GRAPHEME JOINER (CGJ) before the code point that makes
+    // the sequence of non-starters in NFKD longer than 30. The normalization functions
+    // do the same (see norm_decomp_count_ns) so CGJ is never inserted again when the result is normalized.
+
+    it_in_utf16 src = first;
+    it_out_utf16 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    size_t count_ns = 0; // tag_must_be_initialized
+
+    while (src != last)
+    {
+        src = iter_utf16(src, last, &c, iter_replacement);
+        if (c >= norm_bound_stable)
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if (!stages_ccc_qc_ns(ccc_qc, &count_ns))
+            {
+                count_ns -= impl_max_norm_non_starters;
+                dst = codepoint_to_utf16(0x034F, dst);
+            }
+        }
+        else
+            count_ns = 0;
+
+        dst = codepoint_to_utf16(c, dst);
+    }
+
+    return (size_t)(dst - result);
+}
+
 #ifdef __cplusplus
 template<typename it_in_utf16, typename it_end_utf16>
 #endif
@@ -1554,8 +2123,111 @@ uaix_static int impl_norm_is_nfd_utf16(it_in_utf16 first, it_end_utf16 last, boo
     return norm_detect_css_utf16(first, last, norm_bit_nfd, norm_bound_nfd);
 }
 
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static size_t impl_norm_to_nfc_prefix_utf16(it_in_utf16 first, it_end_utf16 last)
+{
+    it_in_utf16 src = first;
+    it_in_utf16 prefix = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    unsigned char last_ccc = 0; // tag_must_be_initialized
+    size_t count_ns = 0; // tag_must_be_initialized
+
+    while (src != last)
+    {
+        const it_in_utf16 prev = src;
+        src = iter_utf16(src, last, &c, iter_error);
+        if (c == iter_error)
+            return (size_t)(prefix - first);
+        if (c < norm_bound_nfc)
+        {
+            last_ccc = 0;
+            prefix = prev;
+            stages_qc_yes_ns(c, &count_ns, norm_bit_nfc);
+        }
+        else
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if (!stages_ccc_qc_detect(ccc_qc, norm_bit_nfc) ||
+                !stages_ccc_qc_order(ccc_qc, &last_ccc) ||
+                !stages_ccc_qc_ns(ccc_qc, &count_ns))
+                return (size_t)(prefix - first);
+            if ((ccc_qc & 0xFF) == 0 && (ccc_qc >> 14) == 0)
+                prefix = prev;
+        }
+    }
+    return (size_t)(src - first);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static size_t impl_norm_split_utf16(it_in_utf16 first, it_end_utf16 last, type_codept norm_bit)
+{
+    it_in_utf16 src = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    while (src != last)
+    {
+        const it_in_utf16 prev = src;
+        src = iter_utf16(src, last, &c, iter_error);
+        if (c < norm_bound_stable)
+            return (size_t)(prev - first);
+        if (c != iter_error)
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if (stages_ccc_qc_yes(ccc_qc, norm_bit) && (ccc_qc >> 14) == 0)
+                return (size_t)(prev - first);
+        }
+    }
+    return (size_t)(src - first);
+}
+
 #ifndef UNI_ALGO_DISABLE_NFKC_NFKD
 
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static size_t impl_norm_split_nfkc_casefold_utf16(it_in_utf16 first, it_end_utf16 last, type_codept norm_bit)
+{
+    // The same as impl_norm_split_utf16 but NFKC_Casefold mapping must start with a stable starter too,
+    // for example a code point that is removed by the mapping cannot be used to split the string.
+
+    it_in_utf16 src = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    while (src != last)
+    {
+        const it_in_utf16 prev = src;
+        src = iter_utf16(src, last, &c, iter_error);
+        if (c < norm_bound_nfkd)
+            return (size_t)(prev - first);
+        if (c != iter_error)
+        {
+            const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+            if ((ccc_qc >> 14) != 0)
+                continue;
+            const size_t offset = stages_nfkc_cf(c);
+            if (offset == 0)
+            {
+                if (stages_ccc_qc_yes(ccc_qc, norm_bit))
+                    return (size_t)(prev - first);
+            }
+            else if (stages_nfkc_cf_number(offset) != 0)
+            {
+                const type_codept cp_ccc_qc = stages(stages_nfkc_cf_cp(offset, 0), stage1_ccc_qc, stage2_ccc_qc);
+                if (stages_ccc_qc_yes(cp_ccc_qc, norm_bit) && (cp_ccc_qc >> 14) == 0)
+                    return (size_t)(prev - first);
+            }
+        }
+    }
+    return (size_t)(src - first);
+}
+
 #ifdef __cplusplus
 template<typename it_in_utf16, typename it_end_utf16>
 #endif
@@ -1782,6 +2454,159 @@ uaix_static bool inline_norm_iter_next_decomp(struct impl_norm_iter_state* const
     return true;
 }
 
+// The functions below write the whole buffer at once instead of one code point at a time.
+// They must be used instead of inline_norm_iter_next_comp/inline_norm_iter_next_decomp
+// and the buffer can be written only when it is ready or it is the end of the data.
+// The output must have space for norm_buffer_size code points.
+
+#ifdef __cplusplus
+template<typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf8 inline_norm_iter_flush_comp_utf8(struct impl_norm_iter_state* const s, it_out_utf8 dst)
+{
+    // The function must be used together with inline_norm_iter_nfc or inline_norm_iter_nfkc
+
+    // Fast path, the buffer is ready after Quick_Check=Yes starter that follows another one
+    // (see norm_state_fast_1) so the first code point can be written without processing the buffer
+    if (s->m.last_qc == 1 && s->m.size == 2)
+    {
+        dst = codepoint_to_utf8(s->buffer.cps[0], dst);
+        s->buffer.cps[0] = s->buffer.cps[1];
+        s->buffer.ccc[0] = s->buffer.ccc[1];
+        s->m.size = 1;
+        s->m.last_qc = 0;
+        s->pos = 0;
+        return dst;
+    }
+
+    if (s->m.last_qc == 0) // This is the last buffer
+        s->m.last_qc = s->m.size;
+
+    norm_order(&s->buffer, s->m.last_qc);
+    norm_comp(&s->buffer, s->m.last_qc);
+
+    for (size_t i = 0; i < s->m.last_qc; ++i)
+    {
+        if (s->buffer.ccc[i] != 255)
+            dst = codepoint_to_utf8(s->buffer.cps[i], dst);
+    }
+
+    norm_proc_buffer(&s->buffer, &s->m);
+    s->pos = 0;
+
+    return dst;
+}
+
+#ifdef __cplusplus
+template<typename it_out_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf8 inline_norm_iter_flush_decomp_utf8(struct impl_norm_iter_state* const s, it_out_utf8 dst)
+{
+    // The function must be used together with inline_norm_iter_nfd or inline_norm_iter_nfkd
+
+    // Fast path, the buffer is ready after Quick_Check=Yes starter that follows another one
+    // (see norm_state_fast_1) so the first code point can be written without processing the buffer
+    if (s->m.last_qc == 1 && s->m.size == 2)
+    {
+        dst = codepoint_to_utf8(s->buffer.cps[0], dst);
+        s->buffer.cps[0] = s->buffer.cps[1];
+        s->buffer.ccc[0] = s->buffer.ccc[1];
+        s->m.size = 1;
+        s->m.last_qc = 0;
+        s->pos = 0;
+        return dst;
+    }
+
+    if (s->m.last_qc == 0) // This is the last buffer
+        s->m.last_qc = s->m.size;
+
+    norm_order(&s->buffer, s->m.last_qc);
+
+    for (size_t i = 0; i < s->m.last_qc; ++i)
+        dst = codepoint_to_utf8(s->buffer.cps[i], dst);
+
+    norm_proc_buffer(&s->buffer, &s->m);
+    s->pos = 0;
+
+    return dst;
+}
+
+#ifdef __cplusplus
+template<typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf16 inline_norm_iter_flush_comp_utf16(struct impl_norm_iter_state* const s, it_out_utf16 dst)
+{
+    // The function must be used together with inline_norm_iter_nfc or inline_norm_iter_nfkc
+
+    // Fast path, the buffer is ready after Quick_Check=Yes starter that follows another one
+    // (see norm_state_fast_1) so the first code point can be written without processing the buffer
+    if (s->m.last_qc == 1 && s->m.size == 2)
+    {
+        dst = codepoint_to_utf16(s->buffer.cps[0], dst);
+        s->buffer.cps[0] = s->buffer.cps[1];
+        s->buffer.ccc[0] = s->buffer.ccc[1];
+        s->m.size = 1;
+        s->m.last_qc = 0;
+        s->pos = 0;
+        return dst;
+    }
+
+    if (s->m.last_qc == 0) // This is the last buffer
+        s->m.last_qc = s->m.size;
+
+    norm_order(&s->buffer, s->m.last_qc);
+    norm_comp(&s->buffer, s->m.last_qc);
+
+    for (size_t i = 0; i < s->m.last_qc; ++i)
+    {
+        if (s->buffer.ccc[i] != 255)
+            dst = codepoint_to_utf16(s->buffer.cps[i], dst);
+    }
+
+    norm_proc_buffer(&s->buffer, &s->m);
+    s->pos = 0;
+
+    return dst;
+}
+
+#ifdef __cplusplus
+template<typename it_out_utf16>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_out_utf16 inline_norm_iter_flush_decomp_utf16(struct impl_norm_iter_state* const s, it_out_utf16 dst)
+{
+    // The function must be used together with inline_norm_iter_nfd or inline_norm_iter_nfkd
+
+    // Fast path, the buffer is ready after Quick_Check=Yes starter that follows another one
+    // (see norm_state_fast_1) so the first code point can be written without processing the buffer
+    if (s->m.last_qc == 1 && s->m.size == 2)
+    {
+        dst = codepoint_to_utf16(s->buffer.cps[0], dst);
+        s->buffer.cps[0] = s->buffer.cps[1];
+        s->buffer.ccc[0] = s->buffer.ccc[1];
+        s->m.size = 1;
+        s->m.last_qc = 0;
+        s->pos = 0;
+        return dst;
+    }
+
+    if (s->m.last_qc == 0) // This is the last buffer
+        s->m.last_qc = s->m.size;
+
+    norm_order(&s->buffer, s->m.last_qc);
+
+    for (size_t i = 0; i < s->m.last_qc; ++i)
+        dst = codepoint_to_utf16(s->buffer.cps[i], dst);
+
+    norm_proc_buffer(&s->buffer, &s->m);
+    s->pos = 0;
+
+    return dst;
+}
+
 // Expose properties for a wrapper
 // Must always be at the end of the file
 
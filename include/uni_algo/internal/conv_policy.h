@@ -0,0 +1,35 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+#ifndef UNI_ALGO_INTERNAL_CONV_POLICY_H_UAIH
+#define UNI_ALGO_INTERNAL_CONV_POLICY_H_UAIH
+
+#include "../config.h"
+
+#include "../impl/impl_conv.h"
+
+namespace una {
+
+// Error policies for conversion functions and conversion views (template parameter Policy)
+// any other code point except surrogates means replace ill-formed sequences with this code point
+namespace conv_policy {
+
+inline constexpr char32_t replace = detail::impl_conv_replace; // Replace with U+FFFD (default)
+inline constexpr char32_t skip    = detail::impl_conv_skip;    // Drop ill-formed sequences
+inline constexpr char32_t escape  = detail::impl_conv_escape;  // Escape every code unit as \xNN
+inline constexpr char32_t stop    = detail::impl_conv_stop;    // Stop at the first ill-formed sequence
+
+} // namespace conv_policy
+
+namespace detail {
+
+template<char32_t Policy>
+inline constexpr bool is_conv_policy = Policy == conv_policy::skip || Policy == conv_policy::escape ||
+    Policy == conv_policy::stop || (Policy <= 0x10FFFF && !(Policy >= 0xD800 && Policy <= 0xDFFF));
+
+} // namespace detail
+
+} // namespace una
+
+#endif // UNI_ALGO_INTERNAL_CONV_POLICY_H_UAIH
@@ -162,7 +162,7 @@ private:
 public:
     friend uaiw_constexpr bool operator==(const in& x, const safe::end<Iter>& y) { return x.it == friend_it(y); }
     friend uaiw_constexpr bool operator!=(const in& x, const safe::end<Iter>& y) { return x.it != friend_it(y); }
-    // NOTE: The following is only used by fast ASCII functions
+    // NOTE: The following is only used by fast functions in impl_conv.h and impl_norm.h
     friend uaiw_constexpr std::ptrdiff_t operator-(const safe::end<Iter>& x, const in& y) { return friend_it(x) - y.it; }
 };
 
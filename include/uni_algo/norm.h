@@ -9,14 +9,17 @@
 #error "Normalization module is disabled via define UNI_ALGO_DISABLE_NORM"
 #endif
 
+#include <array>
 #include <string>
 #include <string_view>
-#include <iterator> // std::back_insert_iterator
+#include <utility> // std::move
 
 #include "config.h"
 #include "internal/safe_layer.h"
 #include "internal/error.h"
 
+#include "conv.h" // una::utf8to32_into, una::conv_state
+
 #include "impl/impl_norm.h"
 
 namespace una {
@@ -73,8 +76,6 @@ uaiw_constexpr Dst t_norm(const Alloc& alloc, const Src& src)
     return dst;
 }
 
-// For NFKC and NFKD it is ineffective to preallocate a string because max decomposition is 11/18
-// in these forms, so we are using back_inserter for these normalization forms.
 // Our functions are designed to work with most C++ iterators but sometimes proxy iterators are needed.
 // In this case we need a simple proxy output iterator where operator-() is no-op.
 // See impl/example/cpp_proxy_iterator.h
@@ -100,15 +101,25 @@ public:
 
 #ifndef UNI_ALGO_DISABLE_NFKC_NFKD
 
-template<typename Dst, typename Alloc, typename Src,
+// For NFKC and NFKD it is ineffective to preallocate a string because max decomposition is 11/18
+// in these forms, so the source is normalized by chunks that are split at stable starters
+// (see impl_norm_split_utf8) to a block that is preallocated with max decomposition of a chunk
+// and then the block is appended to the destination so it grows geometrically as usual.
+// The block is small so it stays in the cache and the overhead is one memcpy.
+inline constexpr std::size_t norm_chunk_size = 1024;
+
+template<typename Dst, typename Alloc, typename Src, size_t SizeX,
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
-    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, proxy_it_out<std::back_insert_iterator<Dst>>)>
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator),
+    size_t(*FnSplit)(typename Src::const_iterator, typename Src::const_iterator, type_codept)>
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
-    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, proxy_it_out<std::back_insert_iterator<Dst>>)>
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer),
+    size_t(*FnSplit)(typename Src::const_pointer, typename Src::const_pointer, type_codept)>
 #else // Safe layer
-    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, proxy_it_out<std::back_insert_iterator<Dst>>)>
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>),
+    size_t(*FnSplit)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, type_codept)>
 #endif
-uaiw_constexpr Dst t_norm2(const Alloc& alloc, const Src& src)
+uaiw_constexpr Dst t_norm2(const Alloc& alloc, const Src& src, type_codept norm_bit)
 {
     Dst dst{alloc};
 
@@ -127,15 +138,52 @@ uaiw_constexpr Dst t_norm2(const Alloc& alloc, const Src& src)
 
         dst.reserve(length * 3 / 2);
 
-        const proxy_it_out<std::back_insert_iterator<Dst>> it_out{std::back_inserter(dst)};
+        Dst block{alloc};
+
+        std::size_t first = 0;
 
+        while (first < length)
+        {
+            std::size_t last = length;
+            if (length - first > norm_chunk_size)
+            {
+                const std::size_t pos = first + norm_chunk_size;
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
-        FnNorm(src.cbegin(), src.cend(), it_out);
+                last = pos + FnSplit(src.cbegin() + static_cast<std::ptrdiff_t>(pos), src.cend(), norm_bit);
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
-        FnNorm(src.data(), src.data() + src.size(), it_out);
+                last = pos + FnSplit(src.data() + pos, src.data() + src.size(), norm_bit);
 #else // Safe layer
-        FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, it_out);
+                last = pos + FnSplit(safe::in{src.data() + pos, src.size() - pos}, safe::end{src.data() + src.size()}, norm_bit);
 #endif
+            }
+
+            // The chunk can be longer if there are no stable starters
+            if (block.size() < (last - first) * SizeX)
+            {
+                if (last - first > block.max_size() / SizeX) // Overflow protection
+                {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+                    throw std::bad_alloc();
+#else
+                    std::abort();
+#endif
+                }
+                block.resize((last - first) * SizeX);
+            }
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            const std::size_t size = FnNorm(src.cbegin() + static_cast<std::ptrdiff_t>(first),
+                                            src.cbegin() + static_cast<std::ptrdiff_t>(last), block.begin());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            const std::size_t size = FnNorm(src.data() + first, src.data() + last, block.data());
+#else // Safe layer
+            const std::size_t size = FnNorm(safe::in{src.data() + first, last - first}, safe::end{src.data() + last},
+                                            safe::out{block.data(), block.size()});
+#endif
+            dst.append(block.data(), size);
+
+            first = last;
+        }
 
 #ifndef UNI_ALGO_NO_SHRINK_TO_FIT
         dst.shrink_to_fit();
@@ -199,6 +247,111 @@ uaiw_constexpr bool t_detect(const Src& src, una::error& error)
     return false;
 }
 
+// Normalization prefix
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+template<typename Src, size_t(*FnPrefix)(typename Src::const_iterator, typename Src::const_iterator)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+template<typename Src, size_t(*FnPrefix)(typename Src::const_pointer, typename Src::const_pointer)>
+#else // Safe layer
+template<typename Src, size_t(*FnPrefix)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>)>
+#endif
+uaiw_constexpr std::size_t t_norm_prefix(const Src& src)
+{
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    return FnPrefix(src.cbegin(), src.cend());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    return FnPrefix(src.data(), src.data() + src.size());
+#else // Safe layer
+    return FnPrefix(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()});
+#endif
+}
+
+// Normalizes the source to the destination after the offset and returns the size of the result,
+// the destination is resized to hold max decomposition of the source if it is smaller.
+template<typename Dst, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>)>
+#endif
+uaiw_constexpr std::size_t t_norm_to(const Src& src, Dst& dst, std::size_t offset)
+{
+    const std::size_t length = src.size();
+
+    if (length > (dst.max_size() - offset) / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    if (dst.size() < offset + length * SizeX)
+        dst.resize(offset + length * SizeX);
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    return FnNorm(src.cbegin(), src.cend(), dst.begin() + static_cast<std::ptrdiff_t>(offset));
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    return FnNorm(src.data(), src.data() + src.size(), dst.data() + offset);
+#else // Safe layer
+    return FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()},
+                  safe::out{dst.data() + offset, dst.size() - offset});
+#endif
+}
+
+// Returns the length of the prefix that is unchanged in NFC. The prefix function stops at a code point
+// with Quick_Check=Maybe even if the text is in NFC so the segment from the last stable starter
+// to the next one is normalized to the buffer and compared with the source, if it is the same
+// then the scan continues after the segment so an already normalized string is never copied.
+template<typename Dst, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator),
+    size_t(*FnPrefix)(typename Src::const_iterator, typename Src::const_iterator),
+    size_t(*FnSplit)(typename Src::const_iterator, typename Src::const_iterator, type_codept)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer),
+    size_t(*FnPrefix)(typename Src::const_pointer, typename Src::const_pointer),
+    size_t(*FnSplit)(typename Src::const_pointer, typename Src::const_pointer, type_codept)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>),
+    size_t(*FnPrefix)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>),
+    size_t(*FnSplit)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, type_codept)>
+#endif
+uaiw_constexpr std::size_t t_norm_nfc_unchanged(const Src& src, Dst& buffer)
+{
+    const std::size_t length = src.size();
+
+    std::size_t first = 0;
+
+    while (true)
+    {
+        first += t_norm_prefix<Src, FnPrefix>(src.substr(first));
+        if (first == length)
+            return length;
+
+        // The code point at the start of the segment is skipped because it is the stable starter
+        const std::size_t pos = first + 1;
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        const std::size_t last = pos + FnSplit(src.cbegin() + static_cast<std::ptrdiff_t>(pos), src.cend(), norm_bit_nfc);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        const std::size_t last = pos + FnSplit(src.data() + pos, src.data() + src.size(), norm_bit_nfc);
+#else // Safe layer
+        const std::size_t last = pos + FnSplit(safe::in{src.data() + pos, src.size() - pos}, safe::end{src.data() + src.size()}, norm_bit_nfc);
+#endif
+
+        const Src segment = src.substr(first, last - first);
+        const std::size_t size = t_norm_to<Dst, Src, SizeX, FnNorm>(segment, buffer, 0);
+        if (segment != Src{buffer.data(), size})
+            return first;
+
+        first = last;
+    }
+}
+
 } // namespace detail
 
 namespace norm {
@@ -231,7 +384,7 @@ to_nfkc_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF8>);
 
     return detail::t_norm2<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_norm_to_nfkc_utf8>(alloc, source);
+            detail::impl_x_norm_to_nfkc_utf8, detail::impl_norm_to_nfkc_utf8, detail::impl_norm_split_utf8>(alloc, source, detail::norm_bit_nfkc);
 }
 
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
@@ -241,7 +394,18 @@ to_nfkd_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF8>);
 
     return detail::t_norm2<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_norm_to_nfkd_utf8>(alloc, source);
+            detail::impl_x_norm_to_nfkd_utf8, detail::impl_norm_to_nfkd_utf8, detail::impl_norm_split_utf8>(alloc, source, detail::norm_bit_nfkd);
+}
+
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfkc_casefold_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm2<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_nfkc_casefold_utf8, detail::impl_norm_to_nfkc_casefold_utf8,
+            detail::impl_norm_split_nfkc_casefold_utf8>(alloc, source, detail::norm_bit_nfkc);
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
@@ -257,6 +421,16 @@ to_unaccent_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc
 }
 #endif // UNI_ALGO_DISABLE_PROP
 
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_stream_safe_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_stream_safe_utf8, detail::impl_norm_to_stream_safe_utf8>(alloc, source);
+}
+
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
 to_nfc_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
@@ -285,7 +459,7 @@ to_nfkc_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc()
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
     return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_norm_to_nfkc_utf16>(alloc, source);
+            detail::impl_x_norm_to_nfkc_utf16, detail::impl_norm_to_nfkc_utf16, detail::impl_norm_split_utf16>(alloc, source, detail::norm_bit_nfkc);
 }
 
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
@@ -295,7 +469,18 @@ to_nfkd_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc()
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
     return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_norm_to_nfkd_utf16>(alloc, source);
+            detail::impl_x_norm_to_nfkd_utf16, detail::impl_norm_to_nfkd_utf16, detail::impl_norm_split_utf16>(alloc, source, detail::norm_bit_nfkd);
+}
+
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfkc_casefold_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_nfkc_casefold_utf16, detail::impl_norm_to_nfkc_casefold_utf16,
+            detail::impl_norm_split_nfkc_casefold_utf16>(alloc, source, detail::norm_bit_nfkc);
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
@@ -311,6 +496,298 @@ to_unaccent_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = All
 }
 #endif // UNI_ALGO_DISABLE_PROP
 
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_stream_safe_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_stream_safe_utf16, detail::impl_norm_to_stream_safe_utf16>(alloc, source);
+}
+
+// The result of copy-on-write normalization functions, it is a view of the source string
+// if the string is already normalized, otherwise it owns the normalized string.
+// Note that the source string must outlive the result in the first case.
+template<typename UTF, typename Alloc = std::allocator<UTF>>
+class cow_string
+{
+public:
+    using string_type = std::basic_string<UTF, std::char_traits<UTF>, Alloc>;
+    using view_type = std::basic_string_view<UTF>;
+
+private:
+    view_type source;
+    string_type result;
+    bool is_owner = false;
+
+public:
+    uaiw_constexpr explicit cow_string(view_type view, const Alloc& alloc = Alloc()) : source{view}, result{alloc} {}
+    uaiw_constexpr explicit cow_string(string_type&& str) : source{}, result{std::move(str)}, is_owner{true} {}
+    uaiw_constexpr bool owns() const noexcept { return is_owner; }
+    uaiw_constexpr view_type view() const noexcept { return is_owner ? view_type{result} : source; }
+    uaiw_constexpr operator view_type() const noexcept { return view(); }
+    uaiw_constexpr string_type to_string() const&
+    {
+        if (is_owner)
+            return result;
+        return string_type{source, result.get_allocator()};
+    }
+    uaiw_constexpr string_type to_string() &&
+    {
+        if (is_owner)
+            return std::move(result);
+        return string_type{source, result.get_allocator()};
+    }
+};
+
+template<typename UTF8, typename Alloc>
+uaiw_constexpr void to_nfc_utf8_inplace(std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& source)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using string_type = std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>;
+    using view_type = std::basic_string_view<UTF8>;
+
+    const view_type view{source};
+
+    string_type buffer{source.get_allocator()};
+
+    // The prefix that is already in NFC stays untouched
+    const std::size_t prefix = detail::t_norm_nfc_unchanged<string_type, view_type, detail::impl_x_norm_to_nfc_utf8,
+            detail::impl_norm_to_nfc_utf8, detail::impl_norm_to_nfc_prefix_utf8, detail::impl_norm_split_utf8>(view, buffer);
+
+    if (prefix == view.size())
+        return;
+
+    const std::size_t size = detail::t_norm_to<string_type, view_type, detail::impl_x_norm_to_nfc_utf8,
+            detail::impl_norm_to_nfc_utf8>(view.substr(prefix), buffer, 0);
+    source.replace(prefix, view.size() - prefix, buffer.data(), size);
+}
+
+template<typename UTF16, typename Alloc>
+uaiw_constexpr void to_nfc_utf16_inplace(std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& source)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using string_type = std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>;
+    using view_type = std::basic_string_view<UTF16>;
+
+    const view_type view{source};
+
+    string_type buffer{source.get_allocator()};
+
+    const std::size_t prefix = detail::t_norm_nfc_unchanged<string_type, view_type, detail::impl_x_norm_to_nfc_utf16,
+            detail::impl_norm_to_nfc_utf16, detail::impl_norm_to_nfc_prefix_utf16, detail::impl_norm_split_utf16>(view, buffer);
+
+    if (prefix == view.size())
+        return;
+
+    const std::size_t size = detail::t_norm_to<string_type, view_type, detail::impl_x_norm_to_nfc_utf16,
+            detail::impl_norm_to_nfc_utf16>(view.substr(prefix), buffer, 0);
+    source.replace(prefix, view.size() - prefix, buffer.data(), size);
+}
+
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr cow_string<UTF8, Alloc>
+to_nfc_utf8_cow(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using string_type = std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>;
+    using view_type = std::basic_string_view<UTF8>;
+
+    string_type result{alloc};
+
+    const std::size_t prefix = detail::t_norm_nfc_unchanged<string_type, view_type, detail::impl_x_norm_to_nfc_utf8,
+            detail::impl_norm_to_nfc_utf8, detail::impl_norm_to_nfc_prefix_utf8, detail::impl_norm_split_utf8>(source, result);
+
+    if (prefix == source.size())
+        return cow_string<UTF8, Alloc>{source, alloc};
+
+    // The prefix is copied and the rest is normalized right after it in the same string
+    result.assign(source.data(), prefix);
+    result.resize(prefix + detail::t_norm_to<string_type, view_type, detail::impl_x_norm_to_nfc_utf8,
+            detail::impl_norm_to_nfc_utf8>(source.substr(prefix), result, prefix));
+#ifndef UNI_ALGO_NO_SHRINK_TO_FIT
+    result.shrink_to_fit();
+#endif
+    return cow_string<UTF8, Alloc>{std::move(result)};
+}
+
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr cow_string<UTF16, Alloc>
+to_nfc_utf16_cow(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using string_type = std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>;
+    using view_type = std::basic_string_view<UTF16>;
+
+    string_type result{alloc};
+
+    const std::size_t prefix = detail::t_norm_nfc_unchanged<string_type, view_type, detail::impl_x_norm_to_nfc_utf16,
+            detail::impl_norm_to_nfc_utf16, detail::impl_norm_to_nfc_prefix_utf16, detail::impl_norm_split_utf16>(source, result);
+
+    if (prefix == source.size())
+        return cow_string<UTF16, Alloc>{source, alloc};
+
+    result.assign(source.data(), prefix);
+    result.resize(prefix + detail::t_norm_to<string_type, view_type, detail::impl_x_norm_to_nfc_utf16,
+            detail::impl_norm_to_nfc_utf16>(source.substr(prefix), result, prefix));
+#ifndef UNI_ALGO_NO_SHRINK_TO_FIT
+    result.shrink_to_fit();
+#endif
+    return cow_string<UTF16, Alloc>{std::move(result)};
+}
+
+// Normalization forms for una::norm::stream_normalizer
+struct nfc {};
+struct nfd {};
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+struct nfkc {};
+struct nfkd {};
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+// Normalizes the input that comes by chunks, everything before the last stable code point
+// is written to the destination after every chunk so the memory usage does not depend on
+// the size of the input. The result is the same as the result of the normalization of the whole input.
+template<typename Form, typename UTF>
+class stream_normalizer
+{
+    static_assert(std::is_integral_v<UTF>);
+    static_assert(sizeof(UTF) == sizeof(char) || sizeof(UTF) == sizeof(char16_t));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    static_assert(std::is_same_v<Form, nfc> || std::is_same_v<Form, nfd> ||
+                  std::is_same_v<Form, nfkc> || std::is_same_v<Form, nfkd>);
+#else
+    static_assert(std::is_same_v<Form, nfc> || std::is_same_v<Form, nfd>);
+#endif
+
+private:
+    // The chunks are decoded by blocks and incomplete sequences at the end of a chunk are kept
+    // in the conversion state, the result is encoded to a block too and appended to the destination
+    // when the block is full so the memory usage does not depend on the size of the chunks.
+    static constexpr std::size_t block_size = 256;
+
+    conv_state decoder;
+    std::array<char32_t, block_size> codepoints{};
+    std::array<UTF, block_size> encoded{};
+    std::size_t encoded_size = 0;
+    detail::impl_norm_iter_state state{};
+
+    uaiw_constexpr bool push(detail::type_codept c)
+    {
+        if constexpr (std::is_same_v<Form, nfc>)
+            return detail::inline_norm_iter_nfc(&state, c);
+        else if constexpr (std::is_same_v<Form, nfd>)
+            return detail::inline_norm_iter_nfd(&state, c);
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        else if constexpr (std::is_same_v<Form, nfkc>)
+            return detail::inline_norm_iter_nfkc(&state, c);
+        else
+            return detail::inline_norm_iter_nfkd(&state, c);
+#endif
+    }
+    uaiw_constexpr bool next(detail::type_codept* c)
+    {
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        if constexpr (std::is_same_v<Form, nfc> || std::is_same_v<Form, nfkc>)
+#else
+        if constexpr (std::is_same_v<Form, nfc>)
+#endif
+            return detail::inline_norm_iter_next_comp(&state, c);
+        else
+            return detail::inline_norm_iter_next_decomp(&state, c);
+    }
+    uaiw_constexpr conv_result decode(std::basic_string_view<UTF> chunk)
+    {
+        if constexpr (sizeof(UTF) == sizeof(char))
+            return utf8to32_into<UTF, char32_t>(chunk, codepoints.data(), codepoints.size(), decoder);
+        else
+            return utf16to32_into<UTF, char32_t>(chunk, codepoints.data(), codepoints.size(), decoder);
+    }
+    template<typename Alloc>
+    uaiw_constexpr void flush(std::basic_string<UTF, std::char_traits<UTF>, Alloc>& dst)
+    {
+        dst.append(encoded.data(), encoded_size);
+        encoded_size = 0;
+    }
+    template<typename Alloc>
+    uaiw_constexpr void output(detail::type_codept c, std::basic_string<UTF, std::char_traits<UTF>, Alloc>& dst)
+    {
+        if (encoded.size() - encoded_size < 4)
+            flush(dst);
+
+        UTF* const first = encoded.data() + encoded_size;
+        UTF* last = first;
+        if constexpr (sizeof(UTF) == sizeof(char))
+            last = detail::codepoint_to_utf8(c, last);
+        else
+            last = detail::codepoint_to_utf16(c, last);
+        encoded_size += static_cast<std::size_t>(last - first);
+    }
+    template<typename Alloc>
+    uaiw_constexpr void process(std::basic_string_view<UTF> chunk, std::basic_string<UTF, std::char_traits<UTF>, Alloc>& dst)
+    {
+        // An empty chunk means the end of the input for the decoder
+        do
+        {
+            const conv_result result = decode(chunk);
+            chunk.remove_prefix(result.read);
+
+            for (std::size_t i = 0; i < result.written; ++i)
+            {
+                // The buffer is ready when the code point is stable (Quick_Check=Yes starter)
+                // so all the code points before it can be written
+                if (push(codepoints[i]))
+                {
+                    detail::type_codept cp = 0;
+                    do
+                    {
+                        if (next(&cp))
+                            output(cp, dst);
+                    }
+                    while (detail::inline_norm_iter_ready(&state));
+                }
+            }
+        }
+        while (!chunk.empty());
+    }
+
+public:
+    uaiw_constexpr stream_normalizer() { detail::impl_norm_iter_state_reset(&state); }
+    template<typename Alloc>
+    uaiw_constexpr void normalize(std::basic_string_view<UTF> chunk, std::basic_string<UTF, std::char_traits<UTF>, Alloc>& dst)
+    {
+        if (chunk.empty())
+            return;
+
+        process(chunk, dst);
+        flush(dst);
+    }
+    template<typename Alloc>
+    uaiw_constexpr void finish(std::basic_string<UTF, std::char_traits<UTF>, Alloc>& dst)
+    {
+        if (!decoder.empty())
+            process(std::basic_string_view<UTF>{}, dst);
+
+        detail::type_codept cp = 0;
+        while (next(&cp))
+            output(cp, dst);
+        flush(dst);
+
+        reset();
+    }
+    uaiw_constexpr bool pending() const noexcept { return !decoder.empty() || state.m.size != 0; }
+    uaiw_constexpr void reset()
+    {
+        decoder.reset();
+        encoded_size = 0;
+        detail::impl_norm_iter_state_reset(&state);
+    }
+};
+
 template<typename UTF8>
 uaiw_constexpr bool is_nfc_utf8(std::basic_string_view<UTF8> source)
 {
@@ -453,7 +930,7 @@ template<typename Iter, typename Sent, typename Dest>
 uaiw_constexpr void to_nfc_utf8(Iter first, Sent last, Dest result)
 {
     detail::proxy_it_out it_out(result);
-    detail::impl_norm_to_nfc_utf8(first, last, it_out);
+    detail::impl_norm_to_nfc_utf8<Iter, Sent, decltype(it_out), false>(first, last, it_out);
 }
 
 template<typename Iter, typename Sent, typename Dest>
@@ -498,6 +975,10 @@ inline uaiw_constexpr std::string to_nfkd_utf8(std::string_view source)
 {
     return to_nfkd_utf8<char>(source);
 }
+inline uaiw_constexpr std::string to_nfkc_casefold_utf8(std::string_view source)
+{
+    return to_nfkc_casefold_utf8<char>(source);
+}
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 #ifndef UNI_ALGO_DISABLE_PROP
 inline uaiw_constexpr std::string to_unaccent_utf8(std::string_view source)
@@ -505,6 +986,10 @@ inline uaiw_constexpr std::string to_unaccent_utf8(std::string_view source)
     return to_unaccent_utf8<char>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::string to_stream_safe_utf8(std::string_view source)
+{
+    return to_stream_safe_utf8<char>(source);
+}
 
 inline uaiw_constexpr std::u16string to_nfc_utf16(std::u16string_view source)
 {
@@ -523,6 +1008,10 @@ inline uaiw_constexpr std::u16string to_nfkd_utf16(std::u16string_view source)
 {
     return to_nfkd_utf16<char16_t>(source);
 }
+inline uaiw_constexpr std::u16string to_nfkc_casefold_utf16(std::u16string_view source)
+{
+    return to_nfkc_casefold_utf16<char16_t>(source);
+}
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 #ifndef UNI_ALGO_DISABLE_PROP
 inline uaiw_constexpr std::u16string to_unaccent_utf16(std::u16string_view source)
@@ -530,6 +1019,19 @@ inline uaiw_constexpr std::u16string to_unaccent_utf16(std::u16string_view sourc
     return to_unaccent_utf16<char16_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::u16string to_stream_safe_utf16(std::u16string_view source)
+{
+    return to_stream_safe_utf16<char16_t>(source);
+}
+
+inline uaiw_constexpr cow_string<char> to_nfc_utf8_cow(std::string_view source)
+{
+    return to_nfc_utf8_cow<char>(source);
+}
+inline uaiw_constexpr cow_string<char16_t> to_nfc_utf16_cow(std::u16string_view source)
+{
+    return to_nfc_utf16_cow<char16_t>(source);
+}
 
 inline uaiw_constexpr bool is_nfc_utf8(std::string_view source)
 {
@@ -625,6 +1127,10 @@ inline uaiw_constexpr std::wstring to_nfkd_utf16(std::wstring_view source)
 {
     return to_nfkd_utf16<wchar_t>(source);
 }
+inline uaiw_constexpr std::wstring to_nfkc_casefold_utf16(std::wstring_view source)
+{
+    return to_nfkc_casefold_utf16<wchar_t>(source);
+}
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 #ifndef UNI_ALGO_DISABLE_PROP
 inline uaiw_constexpr std::wstring to_unaccent_utf16(std::wstring_view source)
@@ -632,6 +1138,15 @@ inline uaiw_constexpr std::wstring to_unaccent_utf16(std::wstring_view source)
     return to_unaccent_utf16<wchar_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::wstring to_stream_safe_utf16(std::wstring_view source)
+{
+    return to_stream_safe_utf16<wchar_t>(source);
+}
+
+inline uaiw_constexpr cow_string<wchar_t> to_nfc_utf16_cow(std::wstring_view source)
+{
+    return to_nfc_utf16_cow<wchar_t>(source);
+}
 
 inline uaiw_constexpr bool is_nfc_utf16(std::wstring_view source)
 {
@@ -692,6 +1207,10 @@ inline uaiw_constexpr std::u8string to_nfkd_utf8(std::u8string_view source)
 {
     return to_nfkd_utf8<char8_t>(source);
 }
+inline uaiw_constexpr std::u8string to_nfkc_casefold_utf8(std::u8string_view source)
+{
+    return to_nfkc_casefold_utf8<char8_t>(source);
+}
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 #ifndef UNI_ALGO_DISABLE_PROP
 inline uaiw_constexpr std::u8string to_unaccent_utf8(std::u8string_view source)
@@ -699,6 +1218,15 @@ inline uaiw_constexpr std::u8string to_unaccent_utf8(std::u8string_view source)
     return to_unaccent_utf8<char8_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::u8string to_stream_safe_utf8(std::u8string_view source)
+{
+    return to_stream_safe_utf8<char8_t>(source);
+}
+
+inline uaiw_constexpr cow_string<char8_t> to_nfc_utf8_cow(std::u8string_view source)
+{
+    return to_nfc_utf8_cow<char8_t>(source);
+}
 
 inline uaiw_constexpr bool is_nfc_utf8(std::u8string_view source)
 {
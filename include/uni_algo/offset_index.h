@@ -0,0 +1,207 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See notice at the end of this file. */
+
+#ifndef UNI_ALGO_OFFSET_INDEX_H_UAIH
+#define UNI_ALGO_OFFSET_INDEX_H_UAIH
+
+#include <string_view>
+#include <vector>
+#include <algorithm>
+
+#include "config.h"
+
+#include "impl/impl_iter.h"
+
+namespace una {
+
+// Index for the translation of offsets in UTF-8 text to UTF-16 offsets and code point indexes
+// and back, for example when the text is stored in UTF-8 but a protocol uses UTF-16 offsets.
+// The index keeps a checkpoint every 64 code points so a query is a binary search of the checkpoint
+// and a short scan of at most 64 code points from it instead of a scan of the whole text.
+// Every ill-formed sequence counts as one code point (U+FFFD) the same as in conversion functions.
+// An offset in the middle of a code point (or a surrogate pair) is rounded down to the start of it
+// and an offset that is greater than the size of the text is the end of the text.
+// The index doesn't own the text, the text must not be changed without the update of the index.
+// Example: una::offset_index index{text}; index.utf16_offset(pos);
+
+class offset_index
+{
+private:
+    struct checkpoint
+    {
+        std::size_t utf8 = 0;
+        std::size_t utf16 = 0;
+        std::size_t codepoint = 0;
+    };
+
+    // The maximum number of code points between checkpoints
+    static constexpr std::size_t step = 64;
+
+    std::string_view source;
+    std::vector<checkpoint> checkpoints;
+
+    checkpoint next(checkpoint p) const
+    {
+        const auto it = source.cbegin() + static_cast<std::ptrdiff_t>(p.utf8);
+        char32_t c = 0;
+
+        p.utf8 += static_cast<std::size_t>(detail::inline_iter_utf8(it, source.cend(), &c, detail::impl_iter_replacement) - it);
+        p.utf16 += (c >= 0x10000) ? 2 : 1;
+        p.codepoint += 1;
+
+        return p;
+    }
+    void scan(std::vector<checkpoint> tail, std::size_t tail_shift)
+    {
+        // Scan from the last checkpoint and add checkpoints until the end of the text or until
+        // a checkpoint from the tail (the old checkpoints after the edit that are shifted by tail_shift)
+        // is reached, the text after the checkpoint is not changed so the rest of the tail can be reused.
+        // Note that the tail checkpoints are always after the edit so it is enough to compare the offsets.
+
+        checkpoint p = checkpoints.back();
+        std::size_t t = 0;
+
+        while (p.utf8 < source.size())
+        {
+            p = next(p);
+
+            if (p.codepoint - checkpoints.back().codepoint == step)
+                checkpoints.push_back(p);
+
+            while (t < tail.size() && tail[t].utf8 + tail_shift < p.utf8)
+                ++t;
+
+            if (t < tail.size() && tail[t].utf8 + tail_shift == p.utf8)
+            {
+                if (checkpoints.back().codepoint != p.codepoint)
+                    checkpoints.push_back(p);
+
+                // Note that unsigned overflow is fine here, it gives the right result in the end
+                for (std::size_t i = t + 1; i < tail.size(); ++i)
+                {
+                    checkpoints.push_back({tail[i].utf8 + p.utf8 - tail[t].utf8,
+                                           tail[i].utf16 + p.utf16 - tail[t].utf16,
+                                           tail[i].codepoint + p.codepoint - tail[t].codepoint});
+                }
+                return;
+            }
+        }
+    }
+    checkpoint find(std::size_t checkpoint::* field, std::size_t value) const
+    {
+        auto it = std::upper_bound(checkpoints.cbegin(), checkpoints.cend(), value,
+            [field](std::size_t v, const checkpoint& c) { return v < c.*field; });
+
+        checkpoint p = *(it - 1);
+
+        while (p.*field < value && p.utf8 < source.size())
+        {
+            const checkpoint n = next(p);
+            if (n.*field > value)
+                break;
+            p = n;
+        }
+
+        return p;
+    }
+
+public:
+    offset_index() : offset_index{std::string_view{}} {}
+    explicit offset_index(std::string_view text) : source{text}
+    {
+        checkpoints.push_back(checkpoint{});
+        scan({}, 0);
+    }
+
+    // Must be called when count code units at pos of the text were replaced with new_count code units,
+    // text is the whole text after the change. Only the changed part of the text is scanned again.
+    void update(std::string_view text, std::size_t pos, std::size_t count, std::size_t new_count)
+    {
+        source = text;
+
+        // The checkpoints before pos stay but not at pos because an incomplete sequence
+        // before pos can be completed by the new code units
+        auto first = std::lower_bound(checkpoints.begin() + 1, checkpoints.end(), pos,
+            [](const checkpoint& c, std::size_t v) { return c.utf8 < v; });
+        auto last = std::lower_bound(first, checkpoints.end(), pos + count,
+            [](const checkpoint& c, std::size_t v) { return c.utf8 < v; });
+
+        std::vector<checkpoint> tail(last, checkpoints.end());
+        checkpoints.erase(first, checkpoints.end());
+
+        scan(std::move(tail), new_count - count);
+    }
+
+    std::size_t utf16_offset(std::size_t utf8_offset) const
+    {
+        return find(&checkpoint::utf8, utf8_offset).utf16;
+    }
+    std::size_t codepoint_index(std::size_t utf8_offset) const
+    {
+        return find(&checkpoint::utf8, utf8_offset).codepoint;
+    }
+    std::size_t utf8_offset_from_utf16(std::size_t utf16_offset) const
+    {
+        return find(&checkpoint::utf16, utf16_offset).utf8;
+    }
+    std::size_t utf8_offset_from_codepoint(std::size_t codepoint_index) const
+    {
+        return find(&checkpoint::codepoint, codepoint_index).utf8;
+    }
+    std::size_t utf16_offset_from_codepoint(std::size_t codepoint_index) const
+    {
+        return find(&checkpoint::codepoint, codepoint_index).utf16;
+    }
+    std::size_t codepoint_index_from_utf16(std::size_t utf16_offset) const
+    {
+        return find(&checkpoint::utf16, utf16_offset).codepoint;
+    }
+};
+
+} // namespace una
+
+#endif // UNI_ALGO_OFFSET_INDEX_H_UAIH
+
+/* Public Domain License
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+ * software, either in source code form or as a compiled binary, for any purpose,
+ * commercial or non-commercial, and by any means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors of this
+ * software dedicate any and all copyright interest in the software to the public
+ * domain. We make this dedication for the benefit of the public at large and to
+ * the detriment of our heirs and successors. We intend this dedication to be an
+ * overt act of relinquishment in perpetuity of all present and future rights to
+ * this software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
@@ -0,0 +1,572 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See notice at the end of this file. */
+
+#ifndef UNI_ALGO_PAR_CONV_H_UAIH
+#define UNI_ALGO_PAR_CONV_H_UAIH
+
+// Parallel versions of conversion and validation functions for big strings.
+// This file is not included in uni_algo/all.h because it uses std::thread
+// so the threads library must be linked (for example Threads::Threads in CMake).
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "config.h"
+#include "conv.h"
+
+namespace una {
+
+namespace detail {
+
+// The source is split into parts (one part per thread) at the same points where
+// conversion functions that write to a buffer split it (see t_into_split in conv.h)
+// so the result and the error position are always the same as for the usual functions.
+// Every part is converted to the destination at the offset part_begin * SizeX and
+// then the parts are moved together, so it is one allocation and one pass over the source.
+
+// The minimum number of code units per thread, smaller parts are not worth a thread
+inline constexpr std::size_t par_min_part = 64 * 1024;
+
+inline std::size_t par_parts(std::size_t length, std::size_t threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    const std::size_t max_parts = length / par_min_part;
+
+    if (threads > max_parts)
+        threads = max_parts;
+
+    return threads ? threads : 1;
+}
+
+template<int UTF, typename Src>
+std::vector<std::size_t> par_split(const Src& src, std::size_t parts)
+{
+    std::vector<std::size_t> bounds(parts + 1, 0);
+
+    bounds[parts] = src.size();
+    for (std::size_t i = 1; i < parts; ++i)
+        bounds[i] = t_into_split<UTF>(src, bounds[i - 1], src.size() / parts * i);
+
+    return bounds;
+}
+
+// Strict functions stop at the first error so every part is processed by blocks that are split
+// the same way as the parts and the workers share the offset of the first error that is found.
+// A worker stops between the blocks if an earlier offset has failed already,
+// the result of such part is never used because the parts are moved together up to the first error.
+inline constexpr std::size_t par_block = 16 * 1024;
+
+template<int UTF, typename Src, typename Func>
+void par_blocks(const Src& src, std::size_t first, std::size_t last, std::atomic<std::size_t>& failed, Func func)
+{
+    // func(block_first, block_last) returns the error offset in the source or impl_npos
+
+    while (first < last)
+    {
+        if (failed.load(std::memory_order_relaxed) < first)
+            return;
+
+        const std::size_t end = (last - first > par_block) ? t_into_split<UTF>(src, first, first + par_block) : last;
+
+        const std::size_t err = func(first, end);
+        if (err != impl_npos)
+        {
+            std::size_t prev = failed.load(std::memory_order_relaxed);
+            while (err < prev && !failed.compare_exchange_weak(prev, err, std::memory_order_relaxed)) {}
+            return;
+        }
+
+        first = end;
+    }
+}
+
+template<typename Func>
+void par_run(std::size_t parts, Func func)
+{
+    // Run func(0) ... func(parts - 1) in parallel, the last one in the calling thread
+
+    std::vector<std::thread> workers;
+
+    struct join_all
+    {
+        std::vector<std::thread>& threads;
+        ~join_all()
+        {
+            for (std::thread& t : threads)
+                t.join();
+        }
+    } join{workers};
+
+    workers.reserve(parts - 1);
+    for (std::size_t i = 0; i < parts - 1; ++i)
+        workers.emplace_back(func, i);
+
+    func(parts - 1);
+}
+
+template<typename Dst, typename Alloc, typename Src, int UTF, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*)>
+#endif
+Dst t_par_utf(const Alloc& alloc, const Src& src, std::size_t threads, una::error* error)
+{
+    const std::size_t parts = par_parts(src.size(), threads);
+
+    if (parts == 1)
+        return error ? t_utf<Dst, Alloc, Src, SizeX, FnUTF>(alloc, src, *error) : t_utf<Dst, Alloc, Src, SizeX, FnUTF>(alloc, src);
+
+    if (error)
+        error->reset();
+
+    Dst dst{alloc};
+
+    if (src.size() > dst.max_size() / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    dst.resize(src.size() * SizeX);
+
+    const std::vector<std::size_t> bounds = par_split<UTF>(src, parts);
+    std::vector<std::size_t> written(parts, 0);
+    std::vector<std::size_t> errors(parts, impl_npos);
+    std::atomic<std::size_t> failed{impl_npos};
+
+    // Convert [first, last) to the destination at the offset out
+    auto convert = [&src, &dst](std::size_t first, std::size_t last, std::size_t out, size_t* err) -> std::size_t {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        return FnUTF(src.cbegin() + static_cast<std::ptrdiff_t>(first), src.cbegin() + static_cast<std::ptrdiff_t>(last),
+                     dst.begin() + static_cast<std::ptrdiff_t>(out), err);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        return FnUTF(src.data() + first, src.data() + last, dst.data() + out, err);
+#else // Safe layer
+        return FnUTF(safe::in{src.data() + first, last - first}, safe::end{src.data() + last},
+                     safe::out{dst.data() + out, (last - first) * SizeX}, err);
+#endif
+    };
+
+    par_run(parts, [&](std::size_t i) {
+        const std::size_t first = bounds[i];
+        const std::size_t last = bounds[i + 1];
+
+        if (!error)
+        {
+            written[i] = convert(first, last, first * SizeX, nullptr);
+            return;
+        }
+
+        par_blocks<UTF>(src, first, last, failed, [&](std::size_t block_first, std::size_t block_last) {
+            std::size_t err = impl_npos;
+            written[i] += convert(block_first, block_last, first * SizeX + written[i], &err);
+            if (err == impl_npos)
+                return impl_npos;
+            errors[i] = block_first - first + err;
+            return block_first + err;
+        });
+    });
+
+    // Move the parts together and stop at the first error
+
+    std::size_t size = written[0];
+    for (std::size_t i = 0; i < parts; ++i)
+    {
+        if (i != 0)
+        {
+            const std::size_t offset = bounds[i] * SizeX;
+            for (std::size_t j = 0; j < written[i]; ++j)
+                dst[size + j] = dst[offset + j];
+            size += written[i];
+        }
+
+        if (errors[i] != impl_npos)
+        {
+            *error = una::error{una::error::code::ill_formed_utf, bounds[i] + errors[i]};
+
+            // Return valid part of a string if the define is defined
+#ifndef UNI_ALGO_STRICT_CONV_RET_VALID_PART
+            size = 0;
+#endif
+            break;
+        }
+    }
+
+    dst.resize(size);
+
+#ifndef UNI_ALGO_NO_SHRINK_TO_FIT
+    dst.shrink_to_fit();
+#endif
+
+    return dst;
+}
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+template<typename Src, int UTF, bool(*FnValid)(typename Src::const_iterator, typename Src::const_iterator, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+template<typename Src, int UTF, bool(*FnValid)(typename Src::const_pointer, typename Src::const_pointer, size_t*)>
+#else // Safe layer
+template<typename Src, int UTF, bool(*FnValid)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, size_t*)>
+#endif
+bool t_par_valid(const Src& src, std::size_t threads, una::error* error)
+{
+    const std::size_t parts = par_parts(src.size(), threads);
+
+    if (parts == 1)
+        return error ? t_valid<Src, FnValid>(src, *error) : t_valid<Src, FnValid>(src);
+
+    const std::vector<std::size_t> bounds = par_split<UTF>(src, parts);
+    std::vector<std::size_t> errors(parts, impl_npos);
+    std::atomic<std::size_t> failed{impl_npos};
+
+    par_run(parts, [&](std::size_t i) {
+        par_blocks<UTF>(src, bounds[i], bounds[i + 1], failed, [&](std::size_t first, std::size_t last) {
+            std::size_t err = impl_npos;
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            FnValid(src.cbegin() + static_cast<std::ptrdiff_t>(first), src.cbegin() + static_cast<std::ptrdiff_t>(last), &err);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            FnValid(src.data() + first, src.data() + last, &err);
+#else // Safe layer
+            FnValid(safe::in{src.data() + first, last - first}, safe::end{src.data() + last}, &err);
+#endif
+            if (err == impl_npos)
+                return impl_npos;
+            errors[i] = first - bounds[i] + err;
+            return first + err;
+        });
+    });
+
+    for (std::size_t i = 0; i < parts; ++i)
+    {
+        if (errors[i] != impl_npos)
+        {
+            if (error)
+                *error = una::error{una::error::code::ill_formed_utf, bounds[i] + errors[i]};
+            return false;
+        }
+    }
+
+    if (error)
+        error->reset();
+
+    return true;
+}
+
+} // namespace detail
+
+namespace par {
+
+// The same as the usual conversion and validation functions but the work is split between threads.
+// threads = 0 means std::thread::hardware_concurrency(), a string that is smaller
+// than 64 KiB per thread is processed by less threads or in the calling thread.
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_par_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            8, detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source, threads, nullptr);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_par_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            16, detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source, threads, nullptr);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            8, detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source, threads, nullptr);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            32, detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source, threads, nullptr);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            16, detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source, threads, nullptr);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            32, detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source, threads, nullptr);
+}
+
+// Short non-template functions for std::string, std::u16string, std::u32string
+
+inline std::u16string utf8to16u(std::string_view source, std::size_t threads = 0)
+{
+    return utf8to16<char, char16_t>(source, threads);
+}
+inline std::string utf16to8(std::u16string_view source, std::size_t threads = 0)
+{
+    return utf16to8<char16_t, char>(source, threads);
+}
+inline std::u32string utf8to32u(std::string_view source, std::size_t threads = 0)
+{
+    return utf8to32<char, char32_t>(source, threads);
+}
+inline std::string utf32to8(std::u32string_view source, std::size_t threads = 0)
+{
+    return utf32to8<char32_t, char>(source, threads);
+}
+inline std::u32string utf16to32u(std::u16string_view source, std::size_t threads = 0)
+{
+    return utf16to32<char16_t, char32_t>(source, threads);
+}
+inline std::u16string utf32to16u(std::u32string_view source, std::size_t threads = 0)
+{
+    return utf32to16<char32_t, char16_t>(source, threads);
+}
+
+template<typename UTF8>
+bool is_valid_utf8(std::basic_string_view<UTF8> source, std::size_t threads = 0)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_par_valid<std::basic_string_view<UTF8>, 8, detail::impl_is_valid_utf8>(source, threads, nullptr);
+}
+template<typename UTF8>
+bool is_valid_utf8(std::basic_string_view<UTF8> source, una::error& error, std::size_t threads = 0)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_par_valid<std::basic_string_view<UTF8>, 8, detail::impl_is_valid_utf8>(source, threads, &error);
+}
+template<typename UTF16>
+bool is_valid_utf16(std::basic_string_view<UTF16> source, std::size_t threads = 0)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_par_valid<std::basic_string_view<UTF16>, 16, detail::impl_is_valid_utf16>(source, threads, nullptr);
+}
+template<typename UTF16>
+bool is_valid_utf16(std::basic_string_view<UTF16> source, una::error& error, std::size_t threads = 0)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_par_valid<std::basic_string_view<UTF16>, 16, detail::impl_is_valid_utf16>(source, threads, &error);
+}
+template<typename UTF32>
+bool is_valid_utf32(std::basic_string_view<UTF32> source, std::size_t threads = 0)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_valid<std::basic_string_view<UTF32>, 32, detail::impl_is_valid_utf32>(source, threads, nullptr);
+}
+template<typename UTF32>
+bool is_valid_utf32(std::basic_string_view<UTF32> source, una::error& error, std::size_t threads = 0)
+{
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_valid<std::basic_string_view<UTF32>, 32, detail::impl_is_valid_utf32>(source, threads, &error);
+}
+
+// Short non-template functions for std::string, std::u16string, std::u32string
+
+inline bool is_valid_utf8(std::string_view source, std::size_t threads = 0)
+{
+    return is_valid_utf8<char>(source, threads);
+}
+inline bool is_valid_utf8(std::string_view source, una::error& error, std::size_t threads = 0)
+{
+    return is_valid_utf8<char>(source, error, threads);
+}
+inline bool is_valid_utf16(std::u16string_view source, std::size_t threads = 0)
+{
+    return is_valid_utf16<char16_t>(source, threads);
+}
+inline bool is_valid_utf16(std::u16string_view source, una::error& error, std::size_t threads = 0)
+{
+    return is_valid_utf16<char16_t>(source, error, threads);
+}
+inline bool is_valid_utf32(std::u32string_view source, std::size_t threads = 0)
+{
+    return is_valid_utf32<char32_t>(source, threads);
+}
+inline bool is_valid_utf32(std::u32string_view source, una::error& error, std::size_t threads = 0)
+{
+    return is_valid_utf32<char32_t>(source, error, threads);
+}
+
+namespace strict {
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, una::error& error, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_par_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            8, detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source, threads, &error);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, una::error& error, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_par_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            16, detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source, threads, &error);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, una::error& error, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            8, detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source, threads, &error);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, una::error& error, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            32, detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source, threads, &error);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, una::error& error, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            16, detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source, threads, &error);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, una::error& error, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_par_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            32, detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source, threads, &error);
+}
+
+// Short non-template functions for std::string, std::u16string, std::u32string
+
+inline std::u16string utf8to16u(std::string_view source, una::error& error, std::size_t threads = 0)
+{
+    return utf8to16<char, char16_t>(source, error, threads);
+}
+inline std::string utf16to8(std::u16string_view source, una::error& error, std::size_t threads = 0)
+{
+    return utf16to8<char16_t, char>(source, error, threads);
+}
+inline std::u32string utf8to32u(std::string_view source, una::error& error, std::size_t threads = 0)
+{
+    return utf8to32<char, char32_t>(source, error, threads);
+}
+inline std::string utf32to8(std::u32string_view source, una::error& error, std::size_t threads = 0)
+{
+    return utf32to8<char32_t, char>(source, error, threads);
+}
+inline std::u32string utf16to32u(std::u16string_view source, una::error& error, std::size_t threads = 0)
+{
+    return utf16to32<char16_t, char32_t>(source, error, threads);
+}
+inline std::u16string utf32to16u(std::u32string_view source, una::error& error, std::size_t threads = 0)
+{
+    return utf32to16<char32_t, char16_t>(source, error, threads);
+}
+
+} // namespace strict
+
+} // namespace par
+
+} // namespace una
+
+#endif // UNI_ALGO_PAR_CONV_H_UAIH
+
+/* Public Domain License
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+ * software, either in source code form or as a compiled binary, for any purpose,
+ * commercial or non-commercial, and by any means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors of this
+ * software dedicate any and all copyright interest in the software to the public
+ * domain. We make this dedication for the benefit of the public at large and to
+ * the detriment of our heirs and successors. We intend this dedication to be an
+ * overt act of relinquishment in perpetuity of all present and future rights to
+ * this software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
@@ -0,0 +1,221 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See notice at the end of this file. */
+
+#ifndef UNI_ALGO_PAR_NORM_H_UAIH
+#define UNI_ALGO_PAR_NORM_H_UAIH
+
+#ifdef UNI_ALGO_DISABLE_NORM
+#error "Normalization module is disabled via define UNI_ALGO_DISABLE_NORM"
+#endif
+
+// Parallel versions of normalization functions for big strings.
+// This file is not included in uni_algo/all.h because it uses std::thread
+// so the threads library must be linked (for example Threads::Threads in CMake).
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "config.h"
+#include "norm.h"
+#include "par_conv.h" // par_parts, par_run
+
+namespace una {
+
+namespace detail {
+
+// The source is split into parts (one part per thread) at stable starters near evenly spaced offsets
+// (see impl_norm_split_utf8) so the parts can be normalized separately and the result is always
+// the same as for the usual functions. Every part is normalized to the destination at the offset
+// part_begin * SizeX and then the parts are moved together the same as in par_conv.h.
+
+template<typename Src>
+std::vector<std::size_t> par_split_norm(const Src& src, std::size_t parts, type_codept norm_bit)
+{
+    std::vector<std::size_t> bounds(parts + 1, 0);
+
+    bounds[parts] = src.size();
+    for (std::size_t i = 1; i < parts; ++i)
+    {
+        std::size_t pos = src.size() / parts * i;
+        if (pos < bounds[i - 1])
+            pos = bounds[i - 1];
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        bounds[i] = pos + impl_norm_split_utf8(src.cbegin() + static_cast<std::ptrdiff_t>(pos), src.cend(), norm_bit);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        bounds[i] = pos + impl_norm_split_utf8(src.data() + pos, src.data() + src.size(), norm_bit);
+#else // Safe layer
+        bounds[i] = pos + impl_norm_split_utf8(safe::in{src.data() + pos, src.size() - pos}, safe::end{src.data() + src.size()}, norm_bit);
+#endif
+    }
+
+    return bounds;
+}
+
+template<typename Dst, typename Alloc, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>)>
+#endif
+Dst t_par_norm(const Alloc& alloc, const Src& src, std::size_t threads, type_codept norm_bit)
+{
+    const std::size_t parts = par_parts(src.size(), threads);
+
+    if (parts == 1)
+        return t_norm<Dst, Alloc, Src, SizeX, FnNorm>(alloc, src);
+
+    Dst dst{alloc};
+
+    if (src.size() > dst.max_size() / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    dst.resize(src.size() * SizeX);
+
+    const std::vector<std::size_t> bounds = par_split_norm(src, parts, norm_bit);
+    std::vector<std::size_t> written(parts, 0);
+
+    par_run(parts, [&](std::size_t i) {
+        const std::size_t first = bounds[i];
+        const std::size_t last = bounds[i + 1];
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        written[i] = FnNorm(src.cbegin() + static_cast<std::ptrdiff_t>(first), src.cbegin() + static_cast<std::ptrdiff_t>(last),
+                            dst.begin() + static_cast<std::ptrdiff_t>(first * SizeX));
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        written[i] = FnNorm(src.data() + first, src.data() + last, dst.data() + first * SizeX);
+#else // Safe layer
+        written[i] = FnNorm(safe::in{src.data() + first, last - first}, safe::end{src.data() + last},
+                            safe::out{dst.data() + first * SizeX, (last - first) * SizeX});
+#endif
+    });
+
+    // Move the parts together
+
+    std::size_t size = written[0];
+    for (std::size_t i = 1; i < parts; ++i)
+    {
+        const std::size_t offset = bounds[i] * SizeX;
+        for (std::size_t j = 0; j < written[i]; ++j)
+            dst[size + j] = dst[offset + j];
+        size += written[i];
+    }
+
+    dst.resize(size);
+
+#ifndef UNI_ALGO_NO_SHRINK_TO_FIT
+    dst.shrink_to_fit();
+#endif
+
+    return dst;
+}
+
+} // namespace detail
+
+namespace norm::par {
+
+// The same as the usual normalization functions but the work is split between threads.
+// threads = 0 means std::thread::hardware_concurrency(), a string that is smaller
+// than 64 KiB per thread is processed by less threads or in the calling thread.
+
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfc_utf8(std::basic_string_view<UTF8> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_par_norm<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_nfc_utf8, detail::impl_norm_to_nfc_utf8>(alloc, source, threads, detail::norm_bit_nfc);
+}
+
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfd_utf8(std::basic_string_view<UTF8> source, std::size_t threads = 0, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_par_norm<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_nfd_utf8, detail::impl_norm_to_nfd_utf8>(alloc, source, threads, detail::norm_bit_nfd);
+}
+
+// Short non-template functions for std::string
+
+inline std::string to_nfc_utf8(std::string_view source, std::size_t threads = 0)
+{
+    return to_nfc_utf8<char>(source, threads);
+}
+inline std::string to_nfd_utf8(std::string_view source, std::size_t threads = 0)
+{
+    return to_nfd_utf8<char>(source, threads);
+}
+
+#ifdef __cpp_lib_char8_t
+
+inline std::u8string to_nfc_utf8(std::u8string_view source, std::size_t threads = 0)
+{
+    return to_nfc_utf8<char8_t>(source, threads);
+}
+inline std::u8string to_nfd_utf8(std::u8string_view source, std::size_t threads = 0)
+{
+    return to_nfd_utf8<char8_t>(source, threads);
+}
+
+#endif // __cpp_lib_char8_t
+
+} // namespace norm::par
+
+} // namespace una
+
+#endif // UNI_ALGO_PAR_NORM_H_UAIH
+
+/* Public Domain License
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+ * software, either in source code form or as a compiled binary, for any purpose,
+ * commercial or non-commercial, and by any means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors of this
+ * software dedicate any and all copyright interest in the software to the public
+ * domain. We make this dedication for the benefit of the public at large and to
+ * the detriment of our heirs and successors. We intend this dedication to be an
+ * overt act of relinquishment in perpetuity of all present and future rights to
+ * this software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
@@ -11,6 +11,7 @@
 
 #include "config.h"
 #include "internal/ranges_core.h"
+#include "internal/conv_policy.h"
 
 #include "impl/impl_iter.h"
 
@@ -28,8 +29,11 @@ private:
         static_assert(std::is_integral_v<detail::rng::iter_value_t<Iter>>,
                       "utf8 view requires integral UTF-8 range");
 
-        // Error is only used for tests, do not document it
-        static_assert(Error == detail::impl_iter_error || Error == detail::impl_iter_replacement);
+        // Error is a replacement code point or una::conv_policy::skip, escape and stop policies
+        // are not supported because the view must give the same result in both directions.
+        // detail::impl_iter_error is only used for tests, do not document it
+        static_assert(Error == detail::impl_iter_error || (detail::is_conv_policy<Error> &&
+                      Error != una::conv_policy::escape && Error != una::conv_policy::stop));
 
     private:
         utf8_view* parent = nullptr;
@@ -42,6 +46,41 @@ private:
         using is_bidirectional_or_better = std::is_convertible<iter_tag, std::bidirectional_iterator_tag>;
         using is_forward_or_better       = std::is_convertible<iter_tag, std::forward_iterator_tag>;
 
+        uaiw_constexpr void iter_next(Sent end)
+        {
+            if constexpr (Error == una::conv_policy::skip)
+            {
+                // Drop ill-formed sequences, if there are only ill-formed sequences
+                // until the end then the iterator is at the end too
+                do
+                {
+                    it_next = detail::impl_iter_utf8(it_pos, end, &codepoint, detail::impl_iter_error);
+                    if (codepoint != detail::impl_iter_error)
+                        return;
+                    it_pos = it_next;
+                }
+                while (it_pos != end);
+            }
+            else
+                it_next = detail::impl_iter_utf8(it_next, end, &codepoint, Error);
+        }
+        uaiw_constexpr void iter_prev()
+        {
+            if constexpr (Error == una::conv_policy::skip)
+            {
+                do
+                {
+                    it_pos = detail::impl_iter_rev_utf8(std::begin(parent->range), it_pos, &codepoint, detail::impl_iter_error);
+                    if (codepoint != detail::impl_iter_error)
+                        return;
+                    it_next = it_pos;
+                }
+                while (it_pos != std::begin(parent->range));
+            }
+            else
+                it_pos = detail::impl_iter_rev_utf8(std::begin(parent->range), it_pos, &codepoint, Error);
+        }
+
     public:
         using iterator_category = std::conditional_t<is_bidirectional_or_better::value,
             std::bidirectional_iterator_tag, std::conditional_t<is_forward_or_better::value,
@@ -56,7 +95,7 @@ private:
             : parent{std::addressof(p)}, it_pos{begin}, it_next{begin}
         {
             if (begin != end)
-                it_next = detail::impl_iter_utf8(it_next, end, &codepoint, Error);
+                iter_next(end);
         }
         //uaiw_constexpr const Iter& base() const & noexcept { return it_pos; }
         //uaiw_constexpr Iter base() && { return std::move(it_pos); }
@@ -71,7 +110,7 @@ private:
             it_pos = it_next;
             if (it_pos == std::end(parent->range))
                 return *this;
-            it_next = detail::impl_iter_utf8(it_next, std::end(parent->range), &codepoint, Error);
+            iter_next(std::end(parent->range));
             return *this;
         }
         uaiw_constexpr utf8 operator++(int)
@@ -89,7 +128,7 @@ private:
             it_next = it_pos;
             if (it_pos == std::begin(parent->range))
                 return *this;
-            it_pos = detail::impl_iter_rev_utf8(std::begin(parent->range), it_pos, &codepoint, Error);
+            iter_prev();
             return *this;
         }
         template<class T = utf8> typename std::enable_if_t<is_bidirectional_or_better::value, T>
@@ -152,8 +191,11 @@ private:
                       sizeof(detail::rng::iter_value_t<Iter>) >= sizeof(char16_t),
                       "utf16 view requires integral UTF-16 range");
 
-        // Error is only used for tests, do not document it
-        static_assert(Error == detail::impl_iter_error || Error == detail::impl_iter_replacement);
+        // Error is a replacement code point or una::conv_policy::skip, escape and stop policies
+        // are not supported because the view must give the same result in both directions.
+        // detail::impl_iter_error is only used for tests, do not document it
+        static_assert(Error == detail::impl_iter_error || (detail::is_conv_policy<Error> &&
+                      Error != una::conv_policy::escape && Error != una::conv_policy::stop));
 
     private:
         utf16_view* parent = nullptr;
@@ -166,6 +208,41 @@ private:
         using is_bidirectional_or_better = std::is_convertible<iter_tag, std::bidirectional_iterator_tag>;
         using is_forward_or_better       = std::is_convertible<iter_tag, std::forward_iterator_tag>;
 
+        uaiw_constexpr void iter_next(Sent end)
+        {
+            if constexpr (Error == una::conv_policy::skip)
+            {
+                // Drop ill-formed sequences, if there are only ill-formed sequences
+                // until the end then the iterator is at the end too
+                do
+                {
+                    it_next = detail::impl_iter_utf16(it_pos, end, &codepoint, detail::impl_iter_error);
+                    if (codepoint != detail::impl_iter_error)
+                        return;
+                    it_pos = it_next;
+                }
+                while (it_pos != end);
+            }
+            else
+                it_next = detail::impl_iter_utf16(it_next, end, &codepoint, Error);
+        }
+        uaiw_constexpr void iter_prev()
+        {
+            if constexpr (Error == una::conv_policy::skip)
+            {
+                do
+                {
+                    it_pos = detail::impl_iter_rev_utf16(std::begin(parent->range), it_pos, &codepoint, detail::impl_iter_error);
+                    if (codepoint != detail::impl_iter_error)
+                        return;
+                    it_next = it_pos;
+                }
+                while (it_pos != std::begin(parent->range));
+            }
+            else
+                it_pos = detail::impl_iter_rev_utf16(std::begin(parent->range), it_pos, &codepoint, Error);
+        }
+
     public:
         using iterator_category = std::conditional_t<is_bidirectional_or_better::value,
             std::bidirectional_iterator_tag, std::conditional_t<is_forward_or_better::value,
@@ -180,7 +257,7 @@ private:
             : parent{std::addressof(p)}, it_pos{begin}, it_next{begin}
         {
             if (begin != end)
-                it_next = detail::impl_iter_utf16(it_next, end, &codepoint, Error);
+                iter_next(end);
         }
         //uaiw_constexpr const Iter& base() const & noexcept { return it_pos; }
         //uaiw_constexpr Iter base() && { return std::move(it_pos); }
@@ -195,7 +272,7 @@ private:
             it_pos = it_next;
             if (it_pos == std::end(parent->range))
                 return *this;
-            it_next = detail::impl_iter_utf16(it_next, std::end(parent->range), &codepoint, Error);
+            iter_next(std::end(parent->range));
             return *this;
         }
         uaiw_constexpr utf16 operator++(int)
@@ -213,7 +290,7 @@ private:
             it_next = it_pos;
             if (it_pos == std::begin(parent->range))
                 return *this;
-            it_pos = detail::impl_iter_rev_utf16(std::begin(parent->range), it_pos, &codepoint, Error);
+            iter_prev();
             return *this;
         }
         template<class T = utf16> typename std::enable_if_t<is_bidirectional_or_better::value, T>
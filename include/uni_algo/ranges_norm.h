@@ -5,6 +5,8 @@
 #ifndef UNI_ALGO_RANGES_NORM_H_UAIH
 #define UNI_ALGO_RANGES_NORM_H_UAIH
 
+#include <string_view>
+
 #include "config.h"
 #include "internal/safe_layer.h"
 #include "internal/ranges_core.h"
@@ -399,6 +401,263 @@ public:
 
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
+} // namespace ranges::norm
+
+namespace detail::rng {
+
+inline constexpr int norm_view_nfc = 0;
+inline constexpr int norm_view_nfd = 1;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline constexpr int norm_view_nfkc = 2;
+inline constexpr int norm_view_nfkd = 3;
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+// Normalization views for UTF-8/UTF-16 ranges, see ranges::norm::nfc_utf8_view etc.
+// The input is decoded directly and the normalized text is written in the same encoding
+// by whole buffers of the normalization algorithm to a chunk that is stored in the iterator,
+// so there is no per code point overhead of utf8_view | norm::nfc | to_utf8 adaptors.
+// The element of the view is std::basic_string_view of the chunk that is valid until
+// the iterator is incremented, the concatenation of the chunks is the same as the result
+// of una::norm::to_nfc_utf8 etc.
+template<class Range, int Form, bool UTF16>
+class norm_utf_view : public view_base
+{
+private:
+    template<class Iter, class Sent>
+    class utf
+    {
+        static_assert(std::is_integral_v<iter_value_t<Iter>>,
+                      "norm::nfc_utf8 etc. view requires integral UTF-8 or UTF-16 range");
+        static_assert(!UTF16 || sizeof(iter_value_t<Iter>) >= sizeof(char16_t),
+                      "norm::nfc_utf16 etc. view requires integral UTF-16 range");
+
+    private:
+        using char_type = iter_value_t<Iter>;
+
+        // Max size of a buffer of the normalization algorithm in code units
+        static constexpr std::size_t max_buffer = norm_buffer_size * (UTF16 ? 2 : 4);
+        static constexpr std::size_t chunk_size = max_buffer * 2;
+
+        norm_utf_view* parent = nullptr;
+        Iter it_pos = Iter{};
+
+        bool stream_end = false;
+
+        std::size_t size = 0;
+        char_type chunk[chunk_size] = {};
+        impl_norm_iter_state state{};
+
+        static uaiw_constexpr bool iter_func_push(impl_norm_iter_state* st, type_codept c)
+        {
+            if constexpr (Form == norm_view_nfc)
+                return inline_norm_iter_nfc(st, c);
+            else if constexpr (Form == norm_view_nfd)
+                return inline_norm_iter_nfd(st, c);
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+            else if constexpr (Form == norm_view_nfkc)
+                return inline_norm_iter_nfkc(st, c);
+            else
+                return inline_norm_iter_nfkd(st, c);
+#endif
+        }
+        static uaiw_constexpr char_type* iter_func_flush(impl_norm_iter_state* st, char_type* dst)
+        {
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+            if constexpr (Form == norm_view_nfc || Form == norm_view_nfkc)
+#else
+            if constexpr (Form == norm_view_nfc)
+#endif
+            {
+                if constexpr (UTF16)
+                    return inline_norm_iter_flush_comp_utf16(st, dst);
+                else
+                    return inline_norm_iter_flush_comp_utf8(st, dst);
+            }
+            else
+            {
+                if constexpr (UTF16)
+                    return inline_norm_iter_flush_decomp_utf16(st, dst);
+                else
+                    return inline_norm_iter_flush_decomp_utf8(st, dst);
+            }
+        }
+        uaiw_constexpr void iter_func_norm_utf()
+        {
+            // Local copies help the compiler to keep the state in registers
+            // because the output code units can alias everything
+            Iter it = it_pos;
+            const Sent last = std::end(parent->range);
+            impl_norm_iter_state st = state;
+
+            char_type* dst = chunk;
+            char_type* const dst_last = chunk + (chunk_size - max_buffer);
+
+            // Fill the chunk while the next buffer of the normalization algorithm fits in it
+            while (dst <= dst_last && it != last)
+            {
+                type_codept codepoint = 0;
+                if constexpr (UTF16)
+                    it = inline_iter_utf16(it, last, &codepoint, impl_iter_replacement);
+                else
+                    it = inline_iter_utf8(it, last, &codepoint, impl_iter_replacement);
+                if (iter_func_push(&st, codepoint))
+                    dst = iter_func_flush(&st, dst);
+            }
+            // The end of the data, flush the rest of the buffer
+            if (dst <= dst_last && it == last && st.m.size != 0)
+                dst = iter_func_flush(&st, dst);
+
+            it_pos = it;
+            state = st;
+
+            size = static_cast<std::size_t>(dst - chunk);
+            if (size == 0)
+                stream_end = true;
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = std::basic_string_view<char_type>;
+        using pointer           = void;
+        using reference         = value_type;
+        using difference_type   = std::ptrdiff_t;
+
+        uaiw_constexpr utf() = default;
+        uaiw_constexpr explicit utf(norm_utf_view& p, Iter begin, Sent) : parent{std::addressof(p)}, it_pos{begin}
+        {
+            impl_norm_iter_state_reset(&state);
+
+            iter_func_norm_utf(); // Fn call must not be inlined
+        }
+        uaiw_constexpr reference operator*() const noexcept { return reference{chunk, size}; }
+        uaiw_constexpr utf& operator++()
+        {
+            iter_func_norm_utf(); // Fn call must not be inlined
+
+            return *this;
+        }
+        uaiw_constexpr utf operator++(int)
+        {
+            utf tmp = *this;
+            operator++();
+            return tmp;
+        }
+        friend uaiw_constexpr bool operator==(const utf& x, const utf& y) { return x.stream_end == y.stream_end; }
+        friend uaiw_constexpr bool operator!=(const utf& x, const utf& y) { return x.stream_end != y.stream_end; }
+        friend uaiw_constexpr bool operator==(const utf& x, una::sentinel_t) { return x.stream_end; }
+        friend uaiw_constexpr bool operator!=(const utf& x, una::sentinel_t) { return !x.stream_end; }
+        friend uaiw_constexpr bool operator==(una::sentinel_t, const utf& x) { return x.stream_end; }
+        friend uaiw_constexpr bool operator!=(una::sentinel_t, const utf& x) { return !x.stream_end; }
+    };
+
+    using iter_t = iterator_t<Range>;
+    using sent_t = sentinel_t<Range>;
+
+    Range range = Range{};
+    cache<utf<iter_t, sent_t>> cached_begin;
+
+public:
+    uaiw_constexpr norm_utf_view() = default;
+    uaiw_constexpr explicit norm_utf_view(Range r) : range{std::move(r)} {}
+    uaiw_constexpr auto begin()
+    {
+        if (cached_begin.has_value())
+            return cached_begin.get_value();
+
+        cached_begin.set_value(utf<iter_t, sent_t>{*this, std::begin(range), std::end(range)});
+
+        return cached_begin.get_value();
+    }
+    uaiw_constexpr auto end()
+    {
+        return una::sentinel;
+    }
+};
+
+} // namespace detail::rng
+
+namespace ranges::norm {
+
+template<class Range>
+class nfc_utf8_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfc, false>
+{
+public:
+    uaiw_constexpr nfc_utf8_view() = default;
+    uaiw_constexpr explicit nfc_utf8_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfc, false>{std::move(r)} {}
+};
+
+template<class Range>
+class nfd_utf8_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfd, false>
+{
+public:
+    uaiw_constexpr nfd_utf8_view() = default;
+    uaiw_constexpr explicit nfd_utf8_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfd, false>{std::move(r)} {}
+};
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<class Range>
+class nfkc_utf8_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkc, false>
+{
+public:
+    uaiw_constexpr nfkc_utf8_view() = default;
+    uaiw_constexpr explicit nfkc_utf8_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkc, false>{std::move(r)} {}
+};
+
+template<class Range>
+class nfkd_utf8_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkd, false>
+{
+public:
+    uaiw_constexpr nfkd_utf8_view() = default;
+    uaiw_constexpr explicit nfkd_utf8_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkd, false>{std::move(r)} {}
+};
+
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<class Range>
+class nfc_utf16_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfc, true>
+{
+public:
+    uaiw_constexpr nfc_utf16_view() = default;
+    uaiw_constexpr explicit nfc_utf16_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfc, true>{std::move(r)} {}
+};
+
+template<class Range>
+class nfd_utf16_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfd, true>
+{
+public:
+    uaiw_constexpr nfd_utf16_view() = default;
+    uaiw_constexpr explicit nfd_utf16_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfd, true>{std::move(r)} {}
+};
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<class Range>
+class nfkc_utf16_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkc, true>
+{
+public:
+    uaiw_constexpr nfkc_utf16_view() = default;
+    uaiw_constexpr explicit nfkc_utf16_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkc, true>{std::move(r)} {}
+};
+
+template<class Range>
+class nfkd_utf16_view : public detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkd, true>
+{
+public:
+    uaiw_constexpr nfkd_utf16_view() = default;
+    uaiw_constexpr explicit nfkd_utf16_view(Range r)
+        : detail::rng::norm_utf_view<Range, detail::rng::norm_view_nfkd, true>{std::move(r)} {}
+};
+
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
 template<class Range>
 nfc_view(Range&&) -> nfc_view<views::all_t<Range>>;
 template<class Range>
@@ -409,6 +668,26 @@ nfkc_view(Range&&) -> nfkc_view<views::all_t<Range>>;
 template<class Range>
 nfkd_view(Range&&) -> nfkd_view<views::all_t<Range>>;
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
+template<class Range>
+nfc_utf8_view(Range&&) -> nfc_utf8_view<views::all_t<Range>>;
+template<class Range>
+nfd_utf8_view(Range&&) -> nfd_utf8_view<views::all_t<Range>>;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<class Range>
+nfkc_utf8_view(Range&&) -> nfkc_utf8_view<views::all_t<Range>>;
+template<class Range>
+nfkd_utf8_view(Range&&) -> nfkd_utf8_view<views::all_t<Range>>;
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+template<class Range>
+nfc_utf16_view(Range&&) -> nfc_utf16_view<views::all_t<Range>>;
+template<class Range>
+nfd_utf16_view(Range&&) -> nfd_utf16_view<views::all_t<Range>>;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<class Range>
+nfkc_utf16_view(Range&&) -> nfkc_utf16_view<views::all_t<Range>>;
+template<class Range>
+nfkd_utf16_view(Range&&) -> nfkd_utf16_view<views::all_t<Range>>;
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 } // namespace ranges::norm
 
@@ -462,6 +741,102 @@ uaiw_constexpr auto operator|(R&& r, const adaptor_nfkd& a) { return a(std::forw
 
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
+/* NFC_UTF8_VIEW */
+
+struct adaptor_nfc_utf8
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfc_utf8_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfc_utf8& a) { return a(std::forward<R>(r)); }
+
+/* NFD_UTF8_VIEW */
+
+struct adaptor_nfd_utf8
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfd_utf8_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfd_utf8& a) { return a(std::forward<R>(r)); }
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+
+/* NFKC_UTF8_VIEW */
+
+struct adaptor_nfkc_utf8
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfkc_utf8_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfkc_utf8& a) { return a(std::forward<R>(r)); }
+
+/* NFKD_UTF8_VIEW */
+
+struct adaptor_nfkd_utf8
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfkd_utf8_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfkd_utf8& a) { return a(std::forward<R>(r)); }
+
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+/* NFC_UTF16_VIEW */
+
+struct adaptor_nfc_utf16
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfc_utf16_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfc_utf16& a) { return a(std::forward<R>(r)); }
+
+/* NFD_UTF16_VIEW */
+
+struct adaptor_nfd_utf16
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfd_utf16_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfd_utf16& a) { return a(std::forward<R>(r)); }
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+
+/* NFKC_UTF16_VIEW */
+
+struct adaptor_nfkc_utf16
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfkc_utf16_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfkc_utf16& a) { return a(std::forward<R>(r)); }
+
+/* NFKD_UTF16_VIEW */
+
+struct adaptor_nfkd_utf16
+{
+    template<class R>
+    uaiw_constexpr auto operator()(R&& r) const
+    { return ranges::norm::nfkd_utf16_view{std::forward<R>(r)}; }
+};
+template<class R>
+uaiw_constexpr auto operator|(R&& r, const adaptor_nfkd_utf16& a) { return a(std::forward<R>(r)); }
+
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
 } // namespace detail::rng
 
 namespace ranges::views::norm {
@@ -472,6 +847,18 @@ inline constexpr detail::rng::adaptor_nfd nfd;
 inline constexpr detail::rng::adaptor_nfkc nfkc;
 inline constexpr detail::rng::adaptor_nfkd nfkd;
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
+inline constexpr detail::rng::adaptor_nfc_utf8 nfc_utf8;
+inline constexpr detail::rng::adaptor_nfd_utf8 nfd_utf8;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline constexpr detail::rng::adaptor_nfkc_utf8 nfkc_utf8;
+inline constexpr detail::rng::adaptor_nfkd_utf8 nfkd_utf8;
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+inline constexpr detail::rng::adaptor_nfc_utf16 nfc_utf16;
+inline constexpr detail::rng::adaptor_nfd_utf16 nfd_utf16;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline constexpr detail::rng::adaptor_nfkc_utf16 nfkc_utf16;
+inline constexpr detail::rng::adaptor_nfkd_utf16 nfkd_utf16;
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 } // namespace ranges::views::norm
 
@@ -37,6 +37,8 @@
 #include "../../include/uni_algo/ranges_norm.h"
 #include "../../include/uni_algo/ranges_grapheme.h"
 #include "../../include/uni_algo/ranges_word.h"
+#include "../../include/uni_algo/par_conv.h"
+#include "../../include/uni_algo/par_norm.h"
 // Extensions
 #include "../../include/uni_algo/ext/ascii.h"
 // Transliterators
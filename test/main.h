@@ -18,6 +18,7 @@
 #include "../include/uni_algo/script.h"
 #include "../include/uni_algo/ranges.h"
 #include "../include/uni_algo/ranges_conv.h"
+#include "../include/uni_algo/offset_index.h"
 #include "../include/uni_algo/ranges_norm.h"
 #include "../include/uni_algo/ranges_grapheme.h"
 #include "../include/uni_algo/ranges_word.h"
@@ -26,6 +27,9 @@
 // Transliterators
 #include "../include/uni_algo/ext/translit/macedonian_to_latin_docs.h"
 #include "../include/uni_algo/ext/translit/japanese_kana_to_romaji_hepburn.h"
+// Parallel functions (not a part of single include)
+#include "../include/uni_algo/par_conv.h"
+#include "../include/uni_algo/par_norm.h"
 #else
 #include "uni_algo_ext.h"
 #endif
@@ -93,6 +97,21 @@
 #include "test_strict2.h"
 #include "test_valid.h"
 #include "test_fast_ascii.h"
+#include "test_fast_conv.h"
+#include "test_ill_formed.h"
+#include "test_length.h"
+#include "test_conv_into.h"
+#include "test_stream_conv.h"
+#include "test_conv_batch.h"
+#include "test_conv_bytes.h"
+#include "test_conv_diag.h"
+#include "test_conv_policy.h"
+#include "test_conv_sanitize.h"
+#ifndef TEST_MODE_SINGLE_INCLUDE
+#include "test_par_conv.h"
+#include "test_par_norm.h"
+#endif
+#include "test_offset_index.h"
 #include "test_extra.h"
 #include "test_visual.h"
 
@@ -112,6 +131,9 @@
 #include "test_case.h"
 #include "test_norm.h"
 #include "test_norm_unaccent.h"
+#include "test_norm_nfkc_casefold.h"
+#include "test_fast_norm.h"
+#include "test_stream_norm.h"
 #include "test_segment.h"
 #include "test_segment_cursor.h"
 #include "test_prop.h"
@@ -215,6 +237,34 @@ int main7()
     STATIC_TESTX(test_fast_ascii_utf8to16());
     STATIC_TESTX(test_fast_ascii_utf8to32());
 
+    STATIC_TESTX(test_length_utf8());
+    STATIC_TESTX(test_length_utf16());
+    STATIC_TESTX(test_length_utf32());
+    STATIC_TESTX(test_conv_into_utf8());
+    STATIC_TESTX(test_conv_into_utf16());
+    STATIC_TESTX(test_conv_into_utf32());
+    STATIC_TESTX(test_conv_into_full());
+    STATIC_TESTX(test_conv_into_strict());
+    STATIC_TESTX(test_stream_conv_utf8());
+    STATIC_TESTX(test_stream_conv_utf16());
+    STATIC_TESTX(test_stream_conv_utf32());
+    STATIC_TESTX(test_stream_conv_pending());
+    STATIC_TESTX(test_conv_batch_utf8());
+    STATIC_TESTX(test_conv_batch_utf16());
+    STATIC_TESTX(test_conv_batch_utf32());
+    STATIC_TESTX(test_conv_batch_range());
+    STATIC_TESTX(test_conv_bytes_utf16());
+    STATIC_TESTX(test_conv_bytes_utf32());
+    STATIC_TESTX(test_conv_bytes_auto());
+    STATIC_TESTX(test_conv_diag_utf8());
+    STATIC_TESTX(test_conv_diag_utf16());
+    STATIC_TESTX(test_conv_diag_utf32());
+    STATIC_TESTX(test_conv_policy_utf8());
+    STATIC_TESTX(test_conv_policy_utf16());
+    STATIC_TESTX(test_conv_policy_utf32());
+    STATIC_TESTX(test_conv_policy_ranges());
+    STATIC_TESTX(test_conv_sanitize_utf8());
+
     STATIC_TESTX(test_overflow());
     STATIC_TESTX(test_alter_value());
 
@@ -322,6 +372,17 @@ int main7()
 
     STATIC_TESTX(test_conv_and_iter_conv());
     STATIC_TESTX(test_conv_and_iter_iter());
+    STATIC_TESTX(test_fast_utf8to16());
+    STATIC_TESTX(test_fast_valid_utf8());
+    STATIC_TESTX(test_fast_length_utf8());
+    STATIC_TESTX(test_fast_utf16to8());
+    STATIC_TESTX(test_fast_utf32());
+#ifndef TEST_MODE_SINGLE_INCLUDE
+    TESTX(test_par_conv_utf8());
+    TESTX(test_par_conv_error());
+#endif
+    TESTX(test_offset_index());
+    TESTX(test_offset_index_update());
 
     std::cout << "DONE: Conversion and Ranges Extra" << '\n';
 #else
@@ -336,10 +397,31 @@ int main7()
 #endif
     STATIC_TESTX(test_norm_detect());
     STATIC_TESTX(test_norm_detect_error());
+    STATIC_TESTX(test_fast_norm_detect());
+    STATIC_TESTX(test_fast_norm_to_nfc());
     std::cout << "DONE: Detecting Normalization Forms" << '\n';
     STATIC_TESTX(test_norm_stream_safe());
+    STATIC_TESTX(test_norm_to_stream_safe());
+    STATIC_TESTX(test_norm_utf_views());
     std::cout << "DONE: Normalization Stream-Safe Text Format" << '\n';
+    STATIC_TESTX(test_stream_norm_utf8());
+    STATIC_TESTX(test_stream_norm_utf16());
+    STATIC_TESTX(test_stream_norm_stream_safe());
+    TESTX(test_stream_norm_long());
+    STATIC_TESTX(test_stream_norm_pending());
+    STATIC_TESTX(test_norm_nfc_inplace());
+#ifndef TEST_MODE_CONSTEXPR
+    STATIC_TESTX(test_norm_nfc_inplace_all());
+    STATIC_TESTX(test_norm_nfkc_chunks());
+    STATIC_TESTX(test_norm_nfkc_casefold_long());
+    STATIC_TESTX(test_norm_utf_views_long());
+#ifndef TEST_MODE_SINGLE_INCLUDE
+    TESTX(test_par_norm_utf8());
+#endif
+#endif
     STATIC_TESTX(test_norm_unaccent());
+    STATIC_TESTX(test_norm_nfkc_casefold());
+    STATIC_TESTX(test_norm_nfkc_casefold_stable());
 
     std::cout << "DONE: Normalization" << '\n';
 
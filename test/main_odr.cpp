@@ -0,0 +1,28 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// The second translation unit that includes all files, the test fails to link
+// if a non-template function in a header is not inline (ODR violation).
+// Main test cannot test this because it includes all files in big main.cpp file.
+
+#include "../include/uni_algo/version.h"
+#include "../include/uni_algo/conv.h"
+#include "../include/uni_algo/locale.h"
+#include "../include/uni_algo/case.h"
+#include "../include/uni_algo/norm.h"
+#include "../include/uni_algo/prop.h"
+#include "../include/uni_algo/script.h"
+#include "../include/uni_algo/ranges.h"
+#include "../include/uni_algo/ranges_conv.h"
+#include "../include/uni_algo/offset_index.h"
+#include "../include/uni_algo/ranges_norm.h"
+#include "../include/uni_algo/ranges_grapheme.h"
+#include "../include/uni_algo/ranges_word.h"
+#include "../include/uni_algo/par_conv.h"
+#include "../include/uni_algo/par_norm.h"
+// Extensions
+#include "../include/uni_algo/ext/ascii.h"
+// Transliterators
+#include "../include/uni_algo/ext/translit/macedonian_to_latin_docs.h"
+#include "../include/uni_algo/ext/translit/japanese_kana_to_romaji_hepburn.h"
@@ -236,6 +236,7 @@ void amalgam(bool with_ext)
 
     // Internals must be first
     output << amalgam_part("uni_algo/internal/error.h");
+    output << amalgam_part("uni_algo/internal/conv_policy.h");
     output << amalgam_part("uni_algo/internal/found.h");
     output << amalgam_part("uni_algo/internal/ranges_core.h");
     output << amalgam_part("uni_algo/internal/ranges_translit.h");
@@ -249,6 +250,7 @@ void amalgam(bool with_ext)
     output << amalgam_part("uni_algo/norm.h");
     output << amalgam_part("uni_algo/ranges.h");
     output << amalgam_part("uni_algo/ranges_conv.h");
+    output << amalgam_part("uni_algo/offset_index.h");
     output << amalgam_part("uni_algo/ranges_norm.h");
     output << amalgam_part("uni_algo/ranges_grapheme.h");
     output << amalgam_part("uni_algo/ranges_word.h");
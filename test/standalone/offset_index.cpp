@@ -0,0 +1 @@
+#include "../../include/uni_algo/offset_index.h"
@@ -0,0 +1 @@
+#include "../../include/uni_algo/par_conv.h"
@@ -13,9 +13,12 @@ target_sources(${PROJECT_NAME} PRIVATE
     "${PROJECT_SOURCE_DIR}/standalone/script.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ranges.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ranges_conv.cpp"
+    "${PROJECT_SOURCE_DIR}/standalone/offset_index.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ranges_norm.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ranges_grapheme.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ranges_word.cpp"
+    "${PROJECT_SOURCE_DIR}/standalone/par_conv.cpp"
+    "${PROJECT_SOURCE_DIR}/standalone/par_norm.cpp"
     # Extensions
     "${PROJECT_SOURCE_DIR}/standalone/ext/ascii.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ext/translit/macedonian_to_latin_docs.cpp"
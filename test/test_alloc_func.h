@@ -154,6 +154,7 @@ test_constexpr bool test_alloc_func_norm()
 #ifndef UNI_ALGO_DISABLE_PROP
     TESTX(una::norm::to_unaccent_utf8<char>(str, alloc) == str);
 #endif // UNI_ALGO_DISABLE_PROP
+    TESTX(una::norm::to_nfc_utf8_cow<char>(str, alloc).to_string() == str);
 
     TESTX(una::norm::to_nfc_utf16<char16_t>(u16str, alloc16) == u16str);
     TESTX(una::norm::to_nfd_utf16<char16_t>(u16str, alloc16) == u16str);
@@ -164,6 +165,7 @@ test_constexpr bool test_alloc_func_norm()
 #ifndef UNI_ALGO_DISABLE_PROP
     TESTX(una::norm::to_unaccent_utf16<char16_t>(u16str, alloc16) == u16str);
 #endif // UNI_ALGO_DISABLE_PROP
+    TESTX(una::norm::to_nfc_utf16_cow<char16_t>(u16str, alloc16).to_string() == u16str);
 
     return true;
 }
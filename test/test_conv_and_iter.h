@@ -14,6 +14,11 @@ test_constexpr bool test_conv_and_iter_conv()
         std::string str8 = una::utf32to8<char32_t, char>(str32);
         std::u16string str16 = una::utf32to16<char32_t, char16_t>(str32);
 
+        TESTX((str8 == una::exact::utf32to8<char32_t, char>(str32)));
+        TESTX((str16 == una::exact::utf32to16<char32_t, char16_t>(str32)));
+        TESTX(str8.size() == una::utf8_length_from_utf32(str32));
+        TESTX(str16.size() == una::utf16_length_from_utf32(str32));
+
         if (c <= 0x10FFFF && !(c >= 0xD800 && c <= 0xDFFF))
         {
             TESTX((str8 == una::utf16to8<char16_t, char>(str16)));
@@ -36,6 +41,9 @@ test_constexpr bool test_conv_and_iter_conv()
         std::string str8 = una::utf16to8<char16_t, char>(str16);
         std::u32string str32 = una::utf16to32<char16_t, char32_t>(str16);
 
+        TESTX((str8 == una::exact::utf16to8<char16_t, char>(str16)));
+        TESTX(str8.size() == una::utf8_length_from_utf16(str16));
+
         if (!(c >= 0xD800 && c <= 0xDFFF))
         {
             TESTX((str8 == una::utf32to8<char32_t, char>(str32)));
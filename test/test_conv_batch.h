@@ -0,0 +1,151 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test batch conversion functions, every result in the arena must always be the same
+// as the result of the conversion of the string alone, an incomplete sequence
+// at the end of a string must not be continued by the next string.
+
+template<typename From, typename To, typename Range, typename FnBatch, typename FnWhole>
+test_constexpr bool test_conv_batch_check(const Range& strings, FnBatch fn_batch, FnWhole fn_whole)
+{
+    // Library-allocated arena
+    {
+        std::basic_string<To> arena;
+        const std::vector<std::size_t> offsets = fn_batch(strings, arena);
+        TESTX(offsets.size() == std::size(strings) + 1);
+        TESTX(offsets.front() == 0 && offsets.back() == arena.size());
+
+        std::size_t i = 0;
+        for (std::basic_string_view<From> str : strings)
+        {
+            TESTX(arena.substr(offsets[i], offsets[i + 1] - offsets[i]) == fn_whole(str));
+            ++i;
+        }
+    }
+
+    // Caller-supplied arena, the result is appended to it
+    {
+        std::basic_string<To> arena(3, 'x');
+        const std::vector<std::size_t> offsets1 = fn_batch(strings, arena);
+        const std::vector<std::size_t> offsets2 = fn_batch(strings, arena);
+        TESTX(offsets1.front() == 3 && offsets1.back() == offsets2.front() && offsets2.back() == arena.size());
+        TESTX(arena.substr(0, 3) == std::basic_string<To>(3, 'x'));
+        TESTX(arena.substr(offsets1.front(), offsets1.back() - offsets1.front()) ==
+              arena.substr(offsets2.front(), offsets2.back() - offsets2.front()));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_batch_utf8()
+{
+    // The shared strings end with an incomplete sequence
+    const std::vector<std::string_view> strings = test_ill_formed_utf8_with({
+        "\x80\xBF",                                                     // Continues the previous string if merged
+        "\xE4\xBD"
+    });
+
+    TESTX((test_conv_batch_check<char, char16_t>(strings,
+        [](const auto& s, std::u16string& a) { return una::batch::utf8to16u(s, a); },
+        [](std::string_view s) { return una::utf8to16u(s); })));
+    TESTX((test_conv_batch_check<char, char32_t>(strings,
+        [](const auto& s, std::u32string& a) { return una::batch::utf8to32u(s, a); },
+        [](std::string_view s) { return una::utf8to32u(s); })));
+
+    return true;
+}
+
+test_constexpr bool test_conv_batch_utf16()
+{
+    // The shared strings end with a high surrogate
+    const std::vector<std::u16string_view> strings = test_ill_formed_utf16_with({
+        u"\xDC00",                                                      // Continues the previous string if merged
+        u"",
+        u"\xDC00\xD800" u"A"
+    });
+
+    TESTX((test_conv_batch_check<char16_t, char>(strings,
+        [](const auto& s, std::string& a) { return una::batch::utf16to8(s, a); },
+        [](std::u16string_view s) { return una::utf16to8(s); })));
+    TESTX((test_conv_batch_check<char16_t, char32_t>(strings,
+        [](const auto& s, std::u32string& a) { return una::batch::utf16to32u(s, a); },
+        [](std::u16string_view s) { return una::utf16to32u(s); })));
+
+    return true;
+}
+
+test_constexpr bool test_conv_batch_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"",
+        U"A\xD800\xDC00\x00110000\xFFFFFFFF"                            // Surrogates and out of range
+    };
+
+    TESTX((test_conv_batch_check<char32_t, char>(strings,
+        [](const auto& s, std::string& a) { return una::batch::utf32to8(s, a); },
+        [](std::u32string_view s) { return una::utf32to8(s); })));
+    TESTX((test_conv_batch_check<char32_t, char16_t>(strings,
+        [](const auto& s, std::u16string& a) { return una::batch::utf32to16u(s, a); },
+        [](std::u32string_view s) { return una::utf32to16u(s); })));
+
+    return true;
+}
+
+// Input range that counts how many times it is passed, the same as std::istream_iterator
+// it can be passed only once
+struct test_conv_batch_input_range
+{
+    struct iterator
+    {
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const std::string_view*;
+        using reference         = const std::string_view&;
+
+        const std::string_view* ptr = nullptr;
+
+        test_constexpr reference operator*() const { return *ptr; }
+        test_constexpr iterator& operator++() { ++ptr; return *this; }
+        test_constexpr iterator operator++(int) { iterator tmp = *this; ++ptr; return tmp; }
+        friend test_constexpr bool operator==(const iterator& x, const iterator& y) { return x.ptr == y.ptr; }
+        friend test_constexpr bool operator!=(const iterator& x, const iterator& y) { return x.ptr != y.ptr; }
+    };
+
+    const std::string_view* first = nullptr;
+    const std::string_view* last = nullptr;
+    std::size_t* passes = nullptr;
+
+    test_constexpr iterator begin() const { ++*passes; return iterator{first}; }
+    test_constexpr iterator end() const { return iterator{last}; }
+};
+
+test_constexpr bool test_conv_batch_range()
+{
+    // A range of strings instead of string views and an empty range
+    const std::vector<std::string> strings = {"Ab", "\xD0\x9F\xD1\x80", "\xF0\x9F\x98\x80"};
+    std::u16string arena;
+    std::vector<std::size_t> offsets = una::batch::utf8to16u(strings, arena);
+    TESTX(arena == u"Ab\x041F\x0440\xD83D\xDE00");
+    TESTX((offsets == std::vector<std::size_t>{0, 2, 4, 6}));
+
+    offsets = una::batch::utf8to16u(std::vector<std::string_view>{}, arena);
+    TESTX(arena.size() == 6 && (offsets == std::vector<std::size_t>{6}));
+
+    // An input range must be passed only once
+    const std::string_view views[] = {"Ab", "\xD0\x9F\xD1\x80", "\xF0\x9F\x98\x80\x80"};
+    std::size_t passes = 0;
+    offsets = una::batch::utf8to16u(test_conv_batch_input_range{std::begin(views), std::end(views), &passes}, arena);
+    TESTX(passes == 1);
+    TESTX(arena == u"Ab\x041F\x0440\xD83D\xDE00" u"Ab\x041F\x0440\xD83D\xDE00\xFFFD");
+    TESTX((offsets == std::vector<std::size_t>{6, 8, 10, 13}));
+    std::u32string arena32;
+    offsets = una::batch::utf8to32u(test_conv_batch_input_range{std::begin(views), std::end(views), &passes}, arena32);
+    TESTX(passes == 2);
+    TESTX(arena32 == U"Ab\x041F\x0440\x0001F600\xFFFD");
+    TESTX((offsets == std::vector<std::size_t>{0, 2, 4, 6}));
+
+    return true;
+}
@@ -0,0 +1,184 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test conversion functions from UTF-16BE/LE and UTF-32BE/LE bytes to UTF-8
+// the result must always be the same as the result of the conversion of native code units
+// and an incomplete code unit at the end must be replaced with U+FFFD.
+
+template<typename UTF>
+test_constexpr std::string test_conv_bytes_make(std::basic_string_view<UTF> str, bool big_endian)
+{
+    std::string bytes;
+    for (UTF c : str)
+    {
+        for (std::size_t i = 0; i < sizeof(UTF); ++i)
+        {
+            const std::size_t shift = big_endian ? (sizeof(UTF) - 1 - i) * 8 : i * 8;
+            bytes += static_cast<char>((static_cast<char32_t>(c) >> shift) & 0xFF);
+        }
+    }
+    return bytes;
+}
+
+template<typename UTF, typename FnBytes, typename FnStrict>
+test_constexpr bool test_conv_bytes_check(std::basic_string_view<UTF> str, bool big_endian, FnBytes fn_bytes, FnStrict fn_strict)
+{
+    const std::string bytes = test_conv_bytes_make(str, big_endian);
+
+    std::string whole, whole_strict;
+    una::error error1, error2;
+
+    if constexpr (sizeof(UTF) == sizeof(char16_t))
+    {
+        whole = una::utf16to8<UTF, char>(str);
+        whole_strict = una::strict::utf16to8<UTF, char>(str, error2);
+    }
+    else
+    {
+        whole = una::utf32to8<UTF, char>(str);
+        whole_strict = una::strict::utf32to8<UTF, char>(str, error2);
+    }
+
+    TESTX(fn_bytes(bytes) == whole);
+    TESTX(fn_strict(bytes, error1) == whole_strict);
+    TESTX(!error1 == !error2);
+    TESTX(!error1 || error1.pos() == error2.pos() * sizeof(UTF));
+
+    // Incomplete code unit at the end
+    for (std::size_t i = 1; i < sizeof(UTF); ++i)
+    {
+        TESTX(fn_bytes(bytes + std::string(i, '\x00')) == whole + "\xEF\xBF\xBD");
+        TESTX(fn_bytes(bytes + std::string(i, '\xD8')) == whole + "\xEF\xBF\xBD");
+
+        fn_strict(bytes + std::string(i, '\x00'), error1);
+        TESTX(error1 && error1.pos() == (error2 ? error2.pos() * sizeof(UTF) : bytes.size()));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_bytes_utf16()
+{
+    const std::u16string_view strings[] = {
+        u"",
+        u"ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+        u"ABCDEFG\x0080" u"ABCDEFGH\x0100" u"ABCDEFGH\xFF21",
+        u"A\x0410\xFF21\xD835\xDC00\xD835\xDC01",
+        u"\xD800\xDC00\xDC00\xD800" u"A\xD800\xD800\xDC00",             // Lone and reversed surrogates
+        u"AB\xD835"                                                     // High surrogate at the end
+    };
+
+    for (std::u16string_view str : strings)
+    {
+        for (bool big_endian : {false, true})
+        {
+            if (big_endian)
+            {
+                TESTX(test_conv_bytes_check(str, big_endian,
+                    [](std::string_view s) { return una::utf16be_bytes_to8(s); },
+                    [](std::string_view s, una::error& e) { return una::strict::utf16be_bytes_to8(s, e); }));
+            }
+            else
+            {
+                TESTX(test_conv_bytes_check(str, big_endian,
+                    [](std::string_view s) { return una::utf16le_bytes_to8(s); },
+                    [](std::string_view s, una::error& e) { return una::strict::utf16le_bytes_to8(s, e); }));
+            }
+        }
+    }
+
+    // Odd trailing byte after a high surrogate
+    TESTX(una::utf16be_bytes_to8(std::string_view{"\x00" "A\xD8\x35\xDC", 5}) == "A\xEF\xBF\xBD\xEF\xBF\xBD");
+    TESTX(una::utf16le_bytes_to8(std::string_view{"A\x00\x35\xD8\x00", 5}) == "A\xEF\xBF\xBD\xEF\xBF\xBD");
+
+    return true;
+}
+
+test_constexpr bool test_conv_bytes_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"",
+        U"ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+        U"ABC\x0080" U"ABCD\x0100" U"ABCD\x00010000",
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"A\xD800\xDC00\x00110000\xFFFFFFFF"                            // Surrogates and out of range
+    };
+
+    for (std::u32string_view str : strings)
+    {
+        for (bool big_endian : {false, true})
+        {
+            if (big_endian)
+            {
+                TESTX(test_conv_bytes_check(str, big_endian,
+                    [](std::string_view s) { return una::utf32be_bytes_to8(s); },
+                    [](std::string_view s, una::error& e) { return una::strict::utf32be_bytes_to8(s, e); }));
+            }
+            else
+            {
+                TESTX(test_conv_bytes_check(str, big_endian,
+                    [](std::string_view s) { return una::utf32le_bytes_to8(s); },
+                    [](std::string_view s, una::error& e) { return una::strict::utf32le_bytes_to8(s, e); }));
+            }
+        }
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_bytes_auto()
+{
+    using namespace std::literals;
+
+    // BOM
+    TESTX(una::decode_auto("\xEF\xBB\xBF" "A\xD0\x96"sv) == "A\xD0\x96");
+    TESTX(una::decode_auto("\xFF\xFE" "A\0\x16\x04"sv) == "A\xD0\x96");
+    TESTX(una::decode_auto("\xFE\xFF" "\0A\x04\x16"sv) == "A\xD0\x96");
+    TESTX(una::decode_auto("\xFF\xFE\0\0" "A\0\0\0\x16\x04\0\0"sv) == "A\xD0\x96");
+    TESTX(una::decode_auto("\0\0\xFE\xFF" "\0\0\0A\0\0\x04\x16"sv) == "A\xD0\x96");
+    TESTX(una::decode_auto("\xFF\xFE"sv).empty());
+    TESTX(una::decode_auto("\xFF\xFE" "A"sv) == "\xEF\xBF\xBD");
+
+    // No BOM
+    TESTX(una::decode_auto(""sv).empty());
+    TESTX(una::decode_auto("ABC\xD0\x96"sv) == "ABC\xD0\x96");
+    TESTX(una::decode_auto("AB\xD0\x96\x80"sv) == "AB\xD0\x96\xEF\xBF\xBD");
+    TESTX(una::decode_auto("\xFF\xFF"sv) == "\xEF\xBF\xBD\xEF\xBF\xBD");
+    TESTX(una::decode_auto("A\0B\0\x16\x04"sv) == "AB\xD0\x96");
+    TESTX(una::decode_auto("\0A\0B\x04\x16"sv) == "AB\xD0\x96");
+    TESTX(una::decode_auto("\x16\x04" "A\0B\0"sv) == "\xD0\x96" "AB");
+    TESTX(una::decode_auto("A\0\0\0\x16\x04\0\0\0\xF6\x01\0"sv) == "A\xD0\x96\xF0\x9F\x98\x80");
+    TESTX(una::decode_auto("\0\0\0A\0\0\x04\x16\0\x01\xF6\0"sv) == "A\xD0\x96\xF0\x9F\x98\x80");
+    TESTX(una::decode_auto("A\0B\0C\0D\0"sv) == "ABCD"); // Not UTF-32 because of the next byte after 0
+    TESTX(una::decode_auto("A\0\0B"sv) == "A\0\0B"sv);   // The same number of NUL bytes in both positions
+
+    // NUL bytes in valid UTF-8
+    TESTX(una::decode_auto("abc\0"sv) == "abc\0"sv);
+    TESTX(una::decode_auto("\0abc"sv) == "\0abc"sv);
+    TESTX(una::decode_auto("hello\0world"sv) == "hello\0world"sv);
+    TESTX(una::decode_auto("hello\0\0world"sv) == "hello\0\0world"sv);
+    TESTX(una::decode_auto("ab\0cd\0ef\0gh\0"sv) == "ab\0cd\0ef\0gh\0"sv);
+    TESTX(una::decode_auto("\xD0\x96\0\xD0\x96\0"sv) == "\xD0\x96\0\xD0\x96\0"sv);
+    // Not valid UTF-8 so decoded as UTF-16 by the parity of NUL bytes even without the pattern
+    TESTX(una::decode_auto("\xD0\x04\xD1\x04\xD2\x04\xD3\x04" "A\0B\0"sv) == "\xD3\x90\xD3\x91\xD3\x92\xD3\x93" "AB");
+
+    // UTF-16
+    TESTX(una::decode_auto_utf16("\xEF\xBB\xBF" "A\xD0\x96"sv) == u"A\x0416");
+    TESTX(una::decode_auto_utf16("A\xD0\x96\x80"sv) == u"A\x0416\xFFFD");
+    TESTX(una::decode_auto_utf16("\xFE\xFF" "\0A\xD8\x3D\xDE\x00"sv) == u"A\xD83D\xDE00");
+    TESTX(una::decode_auto_utf16("A\0\0\0\x16\x04\0\0"sv) == u"A\x0416");
+    // The same as UTF-8 in the middle
+    const std::string_view bytes[] = {
+        "\xFF\xFE" "A\0\x3D\xD8\0\xDE\x3D\xD8" "A"sv,               // UTF-16LE pair, high surrogate and odd byte
+        "\xFE\xFF" "\xDC\0\xD8\x3D\xDE\0\xD8\x3D"sv,                // UTF-16BE reversed pair and high at the end
+        "A\0B\0\0\xDC" "C\0\x3D\xD8\0\xDE"sv,                       // UTF-16LE without BOM
+        "\xFF\xFE\0\0" "A\0\0\0\0\xD8\0\0\0\0\x11\0\0\xF6\x01\0\x01"sv, // UTF-32LE surrogate, out of range, incomplete
+        "\0\0\xFE\xFF" "\0\x01\xF6\0\0\0\xD8\0\0\x10\xFF\xFF\0"sv,  // UTF-32BE surrogate, incomplete
+        "\0\0\0A\0\0\x04\x16\0\x01\xF6\0"sv                       // UTF-32BE without BOM
+    };
+    for (std::string_view b : bytes)
+        TESTX(una::decode_auto_utf16(b) == una::utf8to16u(una::decode_auto(b)));
+
+    return true;
+}
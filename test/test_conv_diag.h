@@ -0,0 +1,153 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test diagnostic conversion and validation functions, the result must always be the same
+// as the result of lenient functions, every U+FFFD in the result must have an issue
+// and the first issue must be the same as the error of strict functions.
+
+template<typename From, typename To, typename FnDiag, typename FnValid, typename FnWhole, typename FnStrict>
+test_constexpr bool test_conv_diag_check(std::basic_string_view<From> str,
+                                         FnDiag fn_diag, FnValid fn_valid, FnWhole fn_whole, FnStrict fn_strict)
+{
+    std::vector<una::conv_issue> issues, issues_valid;
+
+    const std::basic_string<To> result = fn_diag(str, issues);
+    TESTX(result == fn_whole(str));
+    TESTX(fn_valid(str, issues_valid) == issues.empty());
+
+    std::u32string result32;
+    if constexpr (std::is_same_v<To, char>)
+        result32 = una::utf8to32u(result);
+    else if constexpr (std::is_same_v<To, char16_t>)
+        result32 = una::utf16to32u(result);
+    else
+        result32 = result;
+
+    std::size_t replacements = 0;
+    for (char32_t c : result32)
+    {
+        if (c == 0xFFFD)
+            ++replacements;
+    }
+    TESTX(issues.size() == replacements);
+    TESTX(issues.size() == issues_valid.size());
+
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < issues.size(); ++i)
+    {
+        TESTX(issues[i].pos >= pos && issues[i].count > 0);
+        TESTX(issues[i].pos == issues_valid[i].pos && issues[i].count == issues_valid[i].count);
+        TESTX(issues[i].type == issues_valid[i].type);
+        pos = issues[i].pos + issues[i].count;
+    }
+    TESTX(pos <= str.size());
+
+    una::error error;
+    fn_strict(str, error);
+    TESTX(issues.empty() ? !error : (error && error.pos() == issues.front().pos));
+
+    return true;
+}
+
+test_constexpr bool test_conv_diag_utf8()
+{
+    for (std::string_view str : test_ill_formed_utf8)
+    {
+        TESTX((test_conv_diag_check<char, char16_t>(str,
+            [](std::string_view s, std::vector<una::conv_issue>& i) { return una::diag::utf8to16u(s, i); },
+            [](std::string_view s, std::vector<una::conv_issue>& i) { return una::diag::is_valid_utf8(s, i); },
+            [](std::string_view s) { return una::utf8to16u(s); },
+            [](std::string_view s, una::error& e) { return una::strict::utf8to16u(s, e); })));
+        TESTX((test_conv_diag_check<char, char32_t>(str,
+            [](std::string_view s, std::vector<una::conv_issue>& i) { return una::diag::utf8to32u(s, i); },
+            [](std::string_view s, std::vector<una::conv_issue>& i) { return una::diag::is_valid_utf8(s, i); },
+            [](std::string_view s) { return una::utf8to32u(s); },
+            [](std::string_view s, una::error& e) { return una::strict::utf8to32u(s, e); })));
+    }
+
+    using kind = una::conv_issue::kind;
+
+    std::vector<una::conv_issue> issues;
+    una::diag::utf8to16u("A\x80\xC1\x81\xE0\x9F\x80\xED\xA0\x80\xF4\x90\x80\x80\xF8\xE4\xBD" "B\xF0\x9F\x98", issues);
+    const una::conv_issue expected[] = {
+        {1, 1, kind::invalid},
+        {2, 1, kind::overlong}, {3, 1, kind::invalid},
+        {4, 1, kind::overlong}, {5, 1, kind::invalid}, {6, 1, kind::invalid},
+        {7, 1, kind::surrogate}, {8, 1, kind::invalid}, {9, 1, kind::invalid},
+        {10, 1, kind::out_of_range}, {11, 1, kind::invalid}, {12, 1, kind::invalid}, {13, 1, kind::invalid},
+        {14, 1, kind::invalid},
+        {15, 2, kind::truncated},
+        {18, 3, kind::truncated}
+    };
+    TESTX(issues.size() == std::size(expected));
+    for (std::size_t i = 0; i < issues.size() && i < std::size(expected); ++i)
+    {
+        TESTX(issues[i].pos == expected[i].pos);
+        TESTX(issues[i].count == expected[i].count);
+        TESTX(issues[i].type == expected[i].type);
+    }
+
+    // Issues are appended to the vector
+    TESTX(!una::diag::is_valid_utf8("\xFF", issues));
+    TESTX(issues.size() == std::size(expected) + 1 && issues.back().pos == 0);
+
+    return true;
+}
+
+test_constexpr bool test_conv_diag_utf16()
+{
+    for (std::u16string_view str : test_ill_formed_utf16)
+    {
+        TESTX((test_conv_diag_check<char16_t, char>(str,
+            [](std::u16string_view s, std::vector<una::conv_issue>& i) { return una::diag::utf16to8(s, i); },
+            [](std::u16string_view s, std::vector<una::conv_issue>& i) { return una::diag::is_valid_utf16(s, i); },
+            [](std::u16string_view s) { return una::utf16to8(s); },
+            [](std::u16string_view s, una::error& e) { return una::strict::utf16to8(s, e); })));
+        TESTX((test_conv_diag_check<char16_t, char32_t>(str,
+            [](std::u16string_view s, std::vector<una::conv_issue>& i) { return una::diag::utf16to32u(s, i); },
+            [](std::u16string_view s, std::vector<una::conv_issue>& i) { return una::diag::is_valid_utf16(s, i); },
+            [](std::u16string_view s) { return una::utf16to32u(s); },
+            [](std::u16string_view s, una::error& e) { return una::strict::utf16to32u(s, e); })));
+    }
+
+    std::vector<una::conv_issue> issues;
+    una::diag::utf16to8(u"\xDC00" u"A\xD800" u"B\xD800", issues);
+    TESTX(issues.size() == 3);
+    TESTX(issues[0].pos == 0 && issues[0].type == una::conv_issue::kind::surrogate);
+    TESTX(issues[1].pos == 2 && issues[1].type == una::conv_issue::kind::surrogate);
+    TESTX(issues[2].pos == 4 && issues[2].type == una::conv_issue::kind::truncated);
+
+    return true;
+}
+
+test_constexpr bool test_conv_diag_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"",
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"A\xD800\xDC00\x00110000\xFFFFFFFF"                            // Surrogates and out of range
+    };
+
+    for (std::u32string_view str : strings)
+    {
+        TESTX((test_conv_diag_check<char32_t, char>(str,
+            [](std::u32string_view s, std::vector<una::conv_issue>& i) { return una::diag::utf32to8(s, i); },
+            [](std::u32string_view s, std::vector<una::conv_issue>& i) { return una::diag::is_valid_utf32(s, i); },
+            [](std::u32string_view s) { return una::utf32to8(s); },
+            [](std::u32string_view s, una::error& e) { return una::strict::utf32to8(s, e); })));
+        TESTX((test_conv_diag_check<char32_t, char16_t>(str,
+            [](std::u32string_view s, std::vector<una::conv_issue>& i) { return una::diag::utf32to16u(s, i); },
+            [](std::u32string_view s, std::vector<una::conv_issue>& i) { return una::diag::is_valid_utf32(s, i); },
+            [](std::u32string_view s) { return una::utf32to16u(s); },
+            [](std::u32string_view s, una::error& e) { return una::strict::utf32to16u(s, e); })));
+    }
+
+    std::vector<una::conv_issue> issues;
+    una::diag::utf32to8(U"A\xDFFF\x00110000", issues);
+    TESTX(issues.size() == 2);
+    TESTX(issues[0].pos == 1 && issues[0].type == una::conv_issue::kind::surrogate);
+    TESTX(issues[1].pos == 2 && issues[1].type == una::conv_issue::kind::out_of_range);
+
+    return true;
+}
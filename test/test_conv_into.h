@@ -0,0 +1,224 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test conversion functions that write to a buffer (*_into functions)
+// the result must always be the same as the result of the conversion of the whole string
+// no matter how small the buffer is and where the source is split.
+
+template<typename From, typename To, typename FnInto, typename FnIntoState, typename FnWhole>
+test_constexpr bool test_conv_into_check(std::basic_string_view<From> str,
+                                        FnInto fn_into, FnIntoState fn_into_state, FnWhole fn_whole)
+{
+    const std::basic_string<To> whole = fn_whole(str);
+
+    // Enough space
+    {
+        std::basic_string<To> result(whole.size() + 4, 0);
+        una::conv_result r = fn_into(str, result.data(), result.size());
+        TESTX(r.read == str.size() && r.written == whole.size() && !r.error);
+        result.resize(r.written);
+        TESTX(result == whole);
+    }
+
+    // Small buffer (4 code units is enough for any sequence in all conversions)
+    for (std::size_t size = 4; size <= 9; ++size)
+    {
+        std::basic_string<To> result;
+        std::basic_string_view<From> src = str;
+        To buf[9] = {};
+        while (!src.empty())
+        {
+            una::conv_result r = fn_into(src, buf, size);
+            TESTX(r.written <= size && (r.read != 0 || r.written != 0));
+            if (r.read == 0 && r.written == 0)
+                return false;
+            result.append(buf, r.written);
+            src.remove_prefix(r.read);
+        }
+        TESTX(result == whole);
+    }
+
+    // Split source with state
+    for (std::size_t i = 0; i <= str.size(); ++i)
+    {
+        std::basic_string<To> result(whole.size() + 4, 0);
+        una::conv_state state;
+        una::conv_result r1 = fn_into_state(str.substr(0, i), result.data(), result.size(), state);
+        TESTX(r1.read == i);
+        una::conv_result r2 = fn_into_state(str.substr(i), result.data() + r1.written, result.size() - r1.written, state);
+        TESTX(r2.read == str.size() - i);
+        una::conv_result r3 = fn_into_state({}, result.data() + r1.written + r2.written, result.size() - r1.written - r2.written, state);
+        TESTX(r3.read == 0 && state.empty());
+        result.resize(r1.written + r2.written + r3.written);
+        TESTX(result == whole);
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_into_utf8()
+{
+    const std::vector<std::string_view> strings = test_ill_formed_utf8_with({
+        "A\x80\x80\x80\x80\x80\x80" "B"                                 // Many continuation bytes
+    });
+
+    for (std::string_view str : strings)
+    {
+        TESTX((test_conv_into_check<char, char16_t>(str,
+            [](std::string_view s, char16_t* d, std::size_t n) { return una::utf8to16_into<char, char16_t>(s, d, n); },
+            [](std::string_view s, char16_t* d, std::size_t n, una::conv_state& st) { return una::utf8to16_into<char, char16_t>(s, d, n, st); },
+            [](std::string_view s) { return una::utf8to16u(s); })));
+        TESTX((test_conv_into_check<char, char32_t>(str,
+            [](std::string_view s, char32_t* d, std::size_t n) { return una::utf8to32_into<char, char32_t>(s, d, n); },
+            [](std::string_view s, char32_t* d, std::size_t n, una::conv_state& st) { return una::utf8to32_into<char, char32_t>(s, d, n, st); },
+            [](std::string_view s) { return una::utf8to32u(s); })));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_into_utf16()
+{
+    const std::vector<std::u16string_view> strings = test_ill_formed_utf16_with({
+        u"ABC"
+    });
+
+    for (std::u16string_view str : strings)
+    {
+        TESTX((test_conv_into_check<char16_t, char>(str,
+            [](std::u16string_view s, char* d, std::size_t n) { return una::utf16to8_into<char16_t, char>(s, d, n); },
+            [](std::u16string_view s, char* d, std::size_t n, una::conv_state& st) { return una::utf16to8_into<char16_t, char>(s, d, n, st); },
+            [](std::u16string_view s) { return una::utf16to8(s); })));
+        TESTX((test_conv_into_check<char16_t, char32_t>(str,
+            [](std::u16string_view s, char32_t* d, std::size_t n) { return una::utf16to32_into<char16_t, char32_t>(s, d, n); },
+            [](std::u16string_view s, char32_t* d, std::size_t n, una::conv_state& st) { return una::utf16to32_into<char16_t, char32_t>(s, d, n, st); },
+            [](std::u16string_view s) { return una::utf16to32u(s); })));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_into_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"",
+        U"ABC",
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"A\xD800\xDC00\x00110000\xFFFFFFFF"                            // Surrogates and out of range
+    };
+
+    for (std::u32string_view str : strings)
+    {
+        TESTX((test_conv_into_check<char32_t, char>(str,
+            [](std::u32string_view s, char* d, std::size_t n) { return una::utf32to8_into<char32_t, char>(s, d, n); },
+            [](std::u32string_view s, char* d, std::size_t n, una::conv_state& st) { return una::utf32to8_into<char32_t, char>(s, d, n, st); },
+            [](std::u32string_view s) { return una::utf32to8(s); })));
+        TESTX((test_conv_into_check<char32_t, char16_t>(str,
+            [](std::u32string_view s, char16_t* d, std::size_t n) { return una::utf32to16_into<char32_t, char16_t>(s, d, n); },
+            [](std::u32string_view s, char16_t* d, std::size_t n, una::conv_state& st) { return una::utf32to16_into<char32_t, char16_t>(s, d, n, st); },
+            [](std::u32string_view s) { return una::utf32to16u(s); })));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_conv_into_full()
+{
+    una::conv_result r;
+    char16_t buf16[4] = {};
+    char buf8[4] = {};
+
+    // The buffer is too small for the sequence (less than 4 code units)
+    // so nothing is read and written, calling it again with the same buffer never makes progress
+    r = una::utf8to16_into<char, char16_t>("\xF0\x9F\x98\x80", buf16, 1);
+    TESTX(r.read == 0 && r.written == 0 && !r.error);
+    r = una::utf16to8_into<char16_t, char>(u"\x0410", buf8, 1);
+    TESTX(r.read == 0 && r.written == 0 && !r.error);
+    r = una::utf16to8_into<char16_t, char>(u"A\x0410", buf8, 2);
+    TESTX(r.read == 1 && r.written == 1 && !r.error);
+    r = una::utf16to8_into<char16_t, char>(u"A\x0410", buf8, 0);
+    TESTX(r.read == 0 && r.written == 0 && !r.error);
+    // 4 code units are enough for any sequence
+    r = una::utf16to8_into<char16_t, char>(u"\xD83D\xDE00", buf8, 4);
+    TESTX(r.read == 2 && r.written == 4 && !r.error);
+    r = una::utf16to8_into<char16_t, char>(u"\xDC00", buf8, 4);
+    TESTX(r.read == 1 && r.written == 3 && !r.error);
+
+    // The buffer is full
+    r = una::utf8to16_into<char, char16_t>("ABCDEF", buf16, 4);
+    TESTX(r.read == 4 && r.written == 4 && !r.error);
+    TESTX(std::u16string_view(buf16, 4) == u"ABCD");
+
+    // Incomplete sequence is stored in the state
+    una::conv_state state;
+    r = una::utf8to16_into<char, char16_t>("A\xF0\x9F", buf16, 4, state);
+    TESTX(r.read == 3 && r.written == 1 && !state.empty());
+    r = una::utf8to16_into<char, char16_t>("\x98", buf16, 4, state);
+    TESTX(r.read == 1 && r.written == 0 && !state.empty());
+    r = una::utf8to16_into<char, char16_t>("\x80" "B", buf16, 1, state); // The buffer is too small
+    TESTX(r.read == 0 && r.written == 0 && !state.empty());
+    r = una::utf8to16_into<char, char16_t>("\x80" "B", buf16, 4, state);
+    TESTX(r.read == 2 && r.written == 3 && state.empty());
+    TESTX(std::u16string_view(buf16, 3) == u"\xD83D\xDE00" u"B");
+
+    // Incomplete sequence at the end of the input
+    r = una::utf8to16_into<char, char16_t>("\xE4\xBD", buf16, 4, state);
+    TESTX(r.read == 2 && r.written == 0 && !state.empty());
+    r = una::utf8to16_into<char, char16_t>("", buf16, 4, state);
+    TESTX(r.read == 0 && r.written == 1 && state.empty());
+    TESTX(buf16[0] == 0xFFFD);
+
+    state.reset();
+    r = una::utf16to8_into<char16_t, char>(u"\xD835", buf8, 4, state);
+    TESTX(r.read == 1 && r.written == 0 && !state.empty());
+    state.reset();
+    TESTX(state.empty());
+
+    return true;
+}
+
+test_constexpr bool test_conv_into_strict()
+{
+    una::conv_result r;
+    char16_t buf16[16] = {};
+    char buf8[16] = {};
+
+    r = una::strict::utf8to16_into<char, char16_t>("ABC", buf16, 16);
+    TESTX(r.read == 3 && r.written == 3 && !r.error);
+
+    r = una::strict::utf8to16_into<char, char16_t>("AB\x80" "C", buf16, 16);
+    TESTX(r.read == 2 && r.written == 2 && r.error && r.error.pos() == 2);
+
+    r = una::strict::utf8to16_into<char, char16_t>("ABCDEFGH\xE4\xBD" "C", buf16, 16);
+    TESTX(r.read == 8 && r.written == 8 && r.error && r.error.pos() == 8);
+
+    // The error after the buffer is full is not reached
+    r = una::strict::utf8to16_into<char, char16_t>("ABCD\x80", buf16, 2);
+    TESTX(r.read == 2 && r.written == 2 && !r.error);
+
+    r = una::strict::utf16to8_into<char16_t, char>(u"A\x0410\xDC00", buf8, 16);
+    TESTX(r.read == 2 && r.written == 3 && r.error && r.error.pos() == 2);
+
+    r = una::strict::utf32to16_into<char32_t, char16_t>(U"AB\x00110000", buf16, 16);
+    TESTX(r.read == 2 && r.written == 2 && r.error && r.error.pos() == 2);
+
+    // Error in the sequence from the previous call
+    una::conv_state state;
+    r = una::strict::utf8to16_into<char, char16_t>("A\xE4", buf16, 16, state);
+    TESTX(r.read == 2 && r.written == 1 && !r.error && !state.empty());
+    r = una::strict::utf8to16_into<char, char16_t>("BC", buf16, 16, state);
+    TESTX(r.read == 0 && r.written == 0 && r.error && r.error.pos() == 0 && state.empty());
+
+    r = una::strict::utf8to16_into<char, char16_t>("A\xE4", buf16, 16, state);
+    TESTX(r.read == 2 && r.written == 1 && !r.error && !state.empty());
+    r = una::strict::utf8to16_into<char, char16_t>("\xBD\xA0" "B\x80", buf16, 16, state);
+    TESTX(r.read == 3 && r.written == 2 && r.error && r.error.pos() == 3 && state.empty());
+
+    r = una::strict::utf8to16_into<char, char16_t>("\xE4\xBD", buf16, 16, state);
+    TESTX(r.read == 2 && r.written == 0 && !r.error && !state.empty());
+    r = una::strict::utf8to16_into<char, char16_t>("", buf16, 16, state);
+    TESTX(r.read == 0 && r.written == 0 && r.error && r.error.pos() == 0 && state.empty());
+
+    return true;
+}
@@ -0,0 +1,176 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test conversion functions and views with error policies, replace policy must always give
+// the same result as lenient functions, skip policy the same result without U+FFFD,
+// stop policy the same result as the valid part before the first error.
+
+template<typename To>
+test_constexpr std::basic_string<To> test_conv_policy_erase(std::basic_string<To> str, char32_t replacement)
+{
+    std::basic_string<To> result;
+    for (std::size_t i = 0; i < str.size(); ++i)
+    {
+        if constexpr (std::is_same_v<To, char>)
+        {
+            if (str.compare(i, 3, "\xEF\xBF\xBD") == 0)
+            {
+                i += 2;
+                if (replacement)
+                    result += una::utf32to8(std::u32string(1, replacement));
+                continue;
+            }
+        }
+        else if (str[i] == static_cast<To>(0xFFFD))
+        {
+            if (replacement)
+            {
+                if constexpr (std::is_same_v<To, char16_t>)
+                    result += una::utf32to16u(std::u32string(1, replacement));
+                else
+                    result += static_cast<To>(replacement);
+            }
+            continue;
+        }
+        result += str[i];
+    }
+    return result;
+}
+
+template<typename From, typename To, typename FnPolicy, typename FnWhole, typename FnStrict>
+test_constexpr bool test_conv_policy_check(std::basic_string_view<From> str,
+                                           FnPolicy fn_policy, FnWhole fn_whole, FnStrict fn_strict)
+{
+    const std::basic_string<To> whole = fn_whole(str);
+
+    TESTX(fn_policy(str, std::integral_constant<char32_t, una::conv_policy::replace>{}) == whole);
+    TESTX(fn_policy(str, std::integral_constant<char32_t, una::conv_policy::skip>{}) == test_conv_policy_erase(whole, 0));
+    TESTX(fn_policy(str, std::integral_constant<char32_t, U'?'>{}) == test_conv_policy_erase(whole, U'?'));
+    TESTX(fn_policy(str, std::integral_constant<char32_t, U'\x1F600'>{}) == test_conv_policy_erase(whole, U'\x1F600'));
+
+    una::error error;
+    fn_strict(str, error);
+    TESTX(fn_policy(str, std::integral_constant<char32_t, una::conv_policy::stop>{}) ==
+          fn_whole(error ? str.substr(0, error.pos()) : str));
+
+    return true;
+}
+
+test_constexpr bool test_conv_policy_utf8()
+{
+    for (std::string_view str : test_ill_formed_utf8)
+    {
+        TESTX((test_conv_policy_check<char, char16_t>(str,
+            [](std::string_view s, auto p) { return una::utf8to16u<decltype(p)::value>(s); },
+            [](std::string_view s) { return una::utf8to16u(s); },
+            [](std::string_view s, una::error& e) { return una::strict::utf8to16u(s, e); })));
+        TESTX((test_conv_policy_check<char, char32_t>(str,
+            [](std::string_view s, auto p) { return una::utf8to32u<decltype(p)::value>(s); },
+            [](std::string_view s) { return una::utf8to32u(s); },
+            [](std::string_view s, una::error& e) { return una::strict::utf8to32u(s, e); })));
+    }
+
+    // The maximal subpart is escaped byte by byte
+    TESTX(una::utf8to16u<una::conv_policy::escape>("A\x80" "B\xE0\xA0" "C\xF0\x9F\x98\x80\xF4\x90\xFF") ==
+          u"A\\x80B\\xE0\\xA0C\xD83D\xDE00\\xF4\\x90\\xFF");
+    TESTX(una::utf8to32u<una::conv_policy::escape>("\xC0\xAF\xF0\x9F\x98") == U"\\xC0\\xAF\\xF0\\x9F\\x98");
+    TESTX(una::utf8to16u<una::conv_policy::escape>("\\x80") == u"\\x80"); // Not escaped if well-formed
+
+    // Explicit types
+    TESTX((una::utf8to16<una::conv_policy::skip, char, char16_t>("A\x80") == u"A"));
+
+    return true;
+}
+
+test_constexpr bool test_conv_policy_utf16()
+{
+    for (std::u16string_view str : test_ill_formed_utf16)
+    {
+        TESTX((test_conv_policy_check<char16_t, char>(str,
+            [](std::u16string_view s, auto p) { return una::utf16to8<decltype(p)::value>(s); },
+            [](std::u16string_view s) { return una::utf16to8(s); },
+            [](std::u16string_view s, una::error& e) { return una::strict::utf16to8(s, e); })));
+        TESTX((test_conv_policy_check<char16_t, char32_t>(str,
+            [](std::u16string_view s, auto p) { return una::utf16to32u<decltype(p)::value>(s); },
+            [](std::u16string_view s) { return una::utf16to32u(s); },
+            [](std::u16string_view s, una::error& e) { return una::strict::utf16to32u(s, e); })));
+    }
+
+    TESTX(una::utf16to8<una::conv_policy::escape>(u"A\xDC00" u"B\xD835") == "A\\xDC00B\\xD835");
+    TESTX(una::utf16to32u<una::conv_policy::escape>(u"\xD800\xD835\xDC00") == U"\\xD800\U0001D400");
+
+    return true;
+}
+
+test_constexpr bool test_conv_policy_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"",
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"A\xD800\xDC00\x00110000\xFFFFFFFF"                            // Surrogates and out of range
+    };
+
+    for (std::u32string_view str : strings)
+    {
+        TESTX((test_conv_policy_check<char32_t, char>(str,
+            [](std::u32string_view s, auto p) { return una::utf32to8<decltype(p)::value>(s); },
+            [](std::u32string_view s) { return una::utf32to8(s); },
+            [](std::u32string_view s, una::error& e) { return una::strict::utf32to8(s, e); })));
+        TESTX((test_conv_policy_check<char32_t, char16_t>(str,
+            [](std::u32string_view s, auto p) { return una::utf32to16u<decltype(p)::value>(s); },
+            [](std::u32string_view s) { return una::utf32to16u(s); },
+            [](std::u32string_view s, una::error& e) { return una::strict::utf32to16u(s, e); })));
+    }
+
+    TESTX(una::utf32to8<una::conv_policy::escape>(U"A\xD800\x00110000") == "A\\x0000D800\\x00110000");
+    TESTX(una::utf32to16u<una::conv_policy::escape>(U"\xFFFFFFFF\xFFFFFFFF") == u"\\xFFFFFFFF\\xFFFFFFFF");
+
+    return true;
+}
+
+test_constexpr bool test_conv_policy_ranges()
+{
+    // Views must give the same result in both directions
+    {
+        std::string_view str = "\x80" "A\xE0\xA0" "B\xF0\x9F\x98\x80\xFF\xFF";
+        una::ranges::utf8_view<std::string_view, una::conv_policy::skip> view{str};
+        std::u32string result;
+        for (char32_t c : view)
+            result += c;
+        TESTX(result == U"AB\x0001F600");
+
+        std::u32string result_rev;
+        auto it = view.end();
+        while (it != view.begin())
+            result_rev.insert(0, 1, *--it);
+        TESTX(result_rev == result);
+        TESTX(view.begin().begin() == str.begin() + 1);
+
+        una::ranges::utf8_view<std::string_view, una::conv_policy::skip> view_invalid{"\x80\x80\xFF"};
+        TESTX(view_invalid.begin() == view_invalid.end());
+    }
+    {
+        std::u16string_view str = u"\xDC00" u"A\xD800" u"B\xD835\xDC00\xD800";
+        una::ranges::utf16_view<std::u16string_view, una::conv_policy::skip> view{str};
+        std::u32string result;
+        for (char32_t c : view)
+            result += c;
+        TESTX(result == U"AB\x0001D400");
+
+        std::u32string result_rev;
+        auto it = view.end();
+        while (it != view.begin())
+            result_rev.insert(0, 1, *--it);
+        TESTX(result_rev == result);
+    }
+    {
+        una::ranges::utf8_view<std::string_view, U'?'> view{"A\x80" "B\xF0\x9F\x98"};
+        std::u32string result;
+        for (char32_t c : view)
+            result += c;
+        TESTX(result == U"A?B?");
+    }
+
+    return true;
+}
@@ -0,0 +1,45 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test in place sanitization of UTF-8, the result must always be the same
+// as the result of lenient conversion functions and a valid string must not be modified.
+
+test_constexpr bool test_conv_sanitize_utf8()
+{
+    const std::vector<std::string_view> strings = test_ill_formed_utf8_with({
+        "\x80",
+        "ABCDEFGH\xD0\x9F\xD1\x80\xD0\x9F\xD1\x80\xE4\xBD\xA0\xE5\xA5\xBD\xF0\x9F\x98\x80\xFF" "ABCDEFGH",
+        "\xF0\x9F\x98" "ABCDEFGH\xF0\x9F\x98"
+    });
+
+    for (std::string_view str : strings)
+    {
+        const std::string expected = una::utf32to8(una::utf8to32u(str));
+
+        std::string result{str};
+        TESTX(una::sanitize_utf8(result) == !una::is_valid_utf8(str));
+        TESTX(result == expected);
+
+        // A long string to use all fast paths
+        std::string long_str;
+        for (std::size_t i = 0; i < 10; ++i)
+            long_str += str;
+        const std::string long_expected = una::utf32to8(una::utf8to32u(long_str));
+        una::sanitize_utf8(long_str);
+        TESTX(long_str == long_expected);
+    }
+
+    // No reallocation if the capacity is enough
+    std::string str = "A\x80" "B";
+    str.reserve(100);
+    const char* data = str.data();
+    TESTX(una::sanitize_utf8(str));
+    TESTX(str == "A\xEF\xBF\xBD" "B" && str.data() == data);
+
+    // Valid string is not modified
+    TESTX(!una::sanitize_utf8(str));
+    TESTX(str == "A\xEF\xBF\xBD" "B");
+
+    return true;
+}
@@ -0,0 +1,244 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test functions that use fast optimizations for non-ASCII sequences and UTF-16.
+// Ill-formed sequences are placed at every position of a mixed string
+// (that also means truncated sequences at every position) and the result
+// is compared with the result of UTF-8 or UTF-16 view that doesn't use the optimizations.
+
+// Cyrillic, CJK, Latin-1, ASCII, the bounds of 2, 3 and 4 byte ranges
+constexpr std::string_view test_fast_conv_mixed_utf8 =
+    "\xD0\x9F\xD1\x80\xE4\xBD\xA0\xE5\xA5\xBD\xC2\xA9 Ab"
+    "\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBF"
+    "\xF0\x9F\x98\x80\xF0\x90\x80\x80\xF4\x8F\xBF\xBF\xE4\xB8\x96\xD0\x96"
+    "Long ASCII run 0123456789\xD0\x96";
+
+constexpr std::string_view test_fast_conv_ill_formed_utf8[] = {
+    "\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xC2", "\xC2\x41", "\xDF\xC0",
+    "\xE0\x80\x80", "\xE0\x9F\xBF", "\xE0\xA0", "\xE4\xBD", "\xE4\xBD\x41",
+    "\xED\xA0\x80", "\xED\xBF\xBF", "\xEF\xBF", "\xEF\xC0\x80",
+    "\xF0\x8F\xBF\xBF", "\xF0\x9F\x98", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80",
+    "\xF7\xBF\xBF\xBF", "\xF8", "\xFF"
+};
+
+test_constexpr std::u16string test_fast_conv_view_utf8to16(std::string_view str)
+{
+    return str | una::views::utf8 | una::ranges::to_utf16<std::u16string>();
+}
+
+test_constexpr std::size_t test_fast_conv_view_error_utf8(std::string_view str)
+{
+    una::ranges::utf8_view<std::string_view, una::detail::impl_iter_error> view{str};
+
+    for (auto it = view.begin(); it != view.end(); ++it)
+    {
+        if (*it == una::detail::impl_iter_error)
+            return static_cast<std::size_t>(it.begin() - str.begin());
+    }
+
+    return una::detail::impl_npos;
+}
+
+test_constexpr bool test_fast_utf8to16()
+{
+    const std::string_view mixed = test_fast_conv_mixed_utf8;
+
+    TESTX(una::utf8to16u(mixed) == test_fast_conv_view_utf8to16(mixed));
+
+    for (std::size_t i = 0; i <= mixed.size(); ++i)
+    {
+        for (std::string_view bad : test_fast_conv_ill_formed_utf8)
+        {
+            std::string str{mixed.substr(0, i)};
+            str += bad;
+            str += mixed;
+
+            TESTX(una::utf8to16u(str) == test_fast_conv_view_utf8to16(str));
+
+            // Note that the ill-formed sequence can complete a truncated sequence before it
+            const std::size_t pos = test_fast_conv_view_error_utf8(str);
+
+            una::error error;
+            std::u16string result = una::strict::utf8to16u(str, error);
+            if (pos == una::detail::impl_npos)
+                TESTX(!error && result == test_fast_conv_view_utf8to16(str));
+            else
+                TESTX(result.empty() && error && error.pos() == pos);
+        }
+    }
+
+    return true;
+}
+
+test_constexpr bool test_fast_length_utf8()
+{
+    const std::string_view mixed = test_fast_conv_mixed_utf8;
+
+    // Every ill-formed sequence must be counted the same way as U+FFFD in the conversion functions
+    for (std::size_t i = 0; i <= mixed.size(); ++i)
+    {
+        for (std::string_view bad : test_fast_conv_ill_formed_utf8)
+        {
+            std::string str{mixed.substr(0, i)};
+            str += bad;
+            str += mixed;
+
+            TESTX(una::utf16_length_from_utf8(str) == una::utf8to16u(str).size());
+            TESTX(una::count_codepoints_utf8(str) == una::utf8to32u(str).size());
+        }
+    }
+
+    return true;
+}
+
+test_constexpr bool test_fast_valid_utf8()
+{
+    const std::string_view mixed = test_fast_conv_mixed_utf8;
+
+    TESTX(una::is_valid_utf8(mixed));
+
+    for (std::size_t i = 0; i <= mixed.size(); ++i)
+    {
+        for (std::string_view bad : test_fast_conv_ill_formed_utf8)
+        {
+            std::string str{mixed.substr(0, i)};
+            str += bad;
+            str += mixed;
+
+            const std::size_t pos = test_fast_conv_view_error_utf8(str);
+
+            una::error error;
+            if (pos == una::detail::impl_npos)
+                TESTX(una::is_valid_utf8(str, error) && !error);
+            else
+                TESTX(!una::is_valid_utf8(str, error) && error && error.pos() == pos);
+        }
+    }
+
+    return true;
+}
+
+test_constexpr std::string test_fast_conv_view_utf16to8(std::u16string_view str)
+{
+    return str | una::views::utf16 | una::ranges::to_utf8<std::string>();
+}
+
+test_constexpr bool test_fast_utf16to8()
+{
+    // Cyrillic, CJK, Latin-1, ASCII, the bounds of 2 and 3 byte ranges and surrogate pairs
+    const std::u16string_view mixed =
+        u"\x041F\x0440\x4F60\x597D\x00A9 Ab\x0080\x07FF\x0800\xD7FF\xE000\xFFFF"
+        u"\xD83D\xDE00\xD800\xDC00\xDBFF\xDFFF\x4E16\x0416" u"Long ASCII run 0123456789\x0416";
+
+    const std::u16string_view ill_formed[] = {
+        u"\xD800", u"\xDBFF", u"\xDC00", u"\xDFFF", u"\xDC00\xD800", u"\xD800\xD800", u"\xD83D" u"A"
+    };
+
+    TESTX(una::utf16to8(mixed) == test_fast_conv_view_utf16to8(mixed));
+
+    for (std::size_t i = 0; i <= mixed.size(); ++i)
+    {
+        for (std::u16string_view bad : ill_formed)
+        {
+            std::u16string str{mixed.substr(0, i)};
+            str += bad;
+            str += mixed;
+
+            TESTX(una::utf16to8(str) == test_fast_conv_view_utf16to8(str));
+
+            // Note that the ill-formed sequence can complete a high surrogate before it
+            una::ranges::utf16_view<std::u16string_view, una::detail::impl_iter_error> view{str};
+            std::size_t pos = una::detail::impl_npos;
+            for (auto it = view.begin(); it != view.end(); ++it)
+            {
+                if (*it == una::detail::impl_iter_error)
+                {
+                    pos = static_cast<std::size_t>(it.begin() - view.begin().begin());
+                    break;
+                }
+            }
+
+            una::error error;
+            std::string result = una::strict::utf16to8(str, error);
+            if (pos == una::detail::impl_npos)
+                TESTX(!error && result == test_fast_conv_view_utf16to8(str));
+            else
+                TESTX(result.empty() && error && error.pos() == pos);
+        }
+    }
+
+    return true;
+}
+
+template<typename Src, typename Dst, std::size_t (*FnFast)(const Src*, const Src*, Dst*, std::size_t*),
+         std::size_t (*FnSlow)(const Src*, const Src*, Dst*, std::size_t*)>
+test_constexpr bool test_fast_conv_check(std::basic_string_view<Src> str)
+{
+    std::basic_string<Dst> result1(str.size() * 4, 0), result2(str.size() * 4, 0);
+    result1.resize(FnFast(str.data(), str.data() + str.size(), result1.data(), nullptr));
+    result2.resize(FnSlow(str.data(), str.data() + str.size(), result2.data(), nullptr));
+    TESTX(result1 == result2);
+
+    std::size_t error1 = una::detail::impl_npos, error2 = una::detail::impl_npos;
+    TESTX(FnFast(str.data(), str.data() + str.size(), result1.data(), &error1) ==
+          FnSlow(str.data(), str.data() + str.size(), result2.data(), &error2));
+    TESTX(error1 == error2);
+
+    return true;
+}
+
+test_constexpr bool test_fast_utf32()
+{
+    using namespace una::detail;
+
+    // The same as above but for UTF-32, the result is compared with the result
+    // of the functions without the optimizations (template parameter contiguous is false)
+
+    const std::u32string_view mixed =
+        U"\x041F\x0440\x4F60\x597D\x00A9 Ab\x0080\x07FF\x0800\xD7FF\xE000\xFFFF"
+        U"\x0001F600\x00010000\x0010FFFF\x4E16\x0416" U"Long ASCII run 0123456789\x0416";
+
+    const std::u32string_view invalid[] = {
+        U"\xD800", U"\xDBFF", U"\xDC00", U"\xDFFF", U"\x00110000", U"\xFFFFFFFF"
+    };
+
+    const std::u16string str16 = una::utf32to16u(mixed);
+
+    const std::u16string_view ill_formed16[] = {
+        u"\xD800", u"\xDBFF", u"\xDC00", u"\xDFFF", u"\xDC00\xD800", u"\xD800\xD800", u"\xD83D" u"A"
+    };
+
+    for (std::size_t i = 0; i <= mixed.size(); ++i)
+    {
+        for (std::u32string_view bad : invalid)
+        {
+            std::u32string str{mixed.substr(0, i)};
+            str += bad;
+            str += mixed;
+
+            TESTX((test_fast_conv_check<char32_t, char,
+                   impl_utf32to8<const char32_t*, const char32_t*, char*, true>,
+                   impl_utf32to8<const char32_t*, const char32_t*, char*, false>>(str)));
+            TESTX((test_fast_conv_check<char32_t, char16_t,
+                   impl_utf32to16<const char32_t*, const char32_t*, char16_t*, true>,
+                   impl_utf32to16<const char32_t*, const char32_t*, char16_t*, false>>(str)));
+        }
+    }
+
+    for (std::size_t i = 0; i <= str16.size(); ++i)
+    {
+        for (std::u16string_view bad : ill_formed16)
+        {
+            std::u16string str{std::u16string_view{str16}.substr(0, i)};
+            str += bad;
+            str += str16;
+
+            TESTX((test_fast_conv_check<char16_t, char32_t,
+                   impl_utf16to32<const char16_t*, const char16_t*, char32_t*, true>,
+                   impl_utf16to32<const char16_t*, const char16_t*, char32_t*, false>>(str)));
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,122 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test normalization detection and NFC normalization functions that use fast optimizations for ASCII
+// and code points below the lower bound. Sequences that must stop the fast loop are placed at every position
+// of a mixed string and the result is compared with the result of the functions without the optimizations.
+
+template<bool contiguous>
+test_constexpr int test_fast_norm_detect_utf8(std::string_view str, char32_t norm_bit, char32_t norm_bound, bool css)
+{
+    if (css)
+        return una::detail::norm_detect_css_utf8<const char*, const char*, contiguous>(
+            str.data(), str.data() + str.size(), norm_bit, norm_bound);
+
+    return una::detail::norm_detect_utf8<const char*, const char*, contiguous>(
+        str.data(), str.data() + str.size(), norm_bit, norm_bound);
+}
+
+test_constexpr bool test_fast_norm_detect()
+{
+    // ASCII run, Latin-1, Cyrillic, CJK and the bounds of NFKC/NFKD, NFD, NFC
+    const std::string_view mixed = "ASCII run 0123456789 \xC3\xA9t\xC3\xA9 \xD0\x96\xE4\xB8\x96 "
+                                   "\xC2\x9F\xC2\xA0\xC2\xBF\xC3\x80\xCB\xBF\xCC\x80 End";
+
+    const std::string_view inserts[] = {
+        "\xCC\x81",         // U+0301 Quick_Check=Maybe in NFC
+        "\xCC\x81\xCC\xA3", // U+0301 U+0323 not in canonical order
+        "\xC3\x80",         // U+00C0 Quick_Check=No in NFD
+        "\xC2\xA0",         // U+00A0 Quick_Check=No in NFKC/NFKD
+        "\x80",             // Ill-formed
+        "\xC3",             // Truncated
+        "\xC1\x81"          // Overlong
+    };
+
+    const char32_t forms[][2] = {
+        {una::detail::norm_bit_nfc, una::detail::norm_bound_nfc},
+        {una::detail::norm_bit_nfd, una::detail::norm_bound_nfd},
+        {una::detail::norm_bit_nfkc, una::detail::norm_bound_nfkc},
+        {una::detail::norm_bit_nfkd, una::detail::norm_bound_nfkd}
+    };
+
+    for (const auto& form : forms)
+    {
+        for (bool css : {false, true})
+        {
+            TESTX(test_fast_norm_detect_utf8<true>(mixed, form[0], form[1], css) ==
+                  test_fast_norm_detect_utf8<false>(mixed, form[0], form[1], css));
+
+            for (std::size_t i = 0; i <= mixed.size(); i += 3)
+            {
+                for (std::string_view insert : inserts)
+                {
+                    std::string str{mixed.substr(0, i)};
+                    str += insert;
+                    str += mixed.substr(i);
+
+                    TESTX(test_fast_norm_detect_utf8<true>(str, form[0], form[1], css) ==
+                          test_fast_norm_detect_utf8<false>(str, form[0], form[1], css));
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+template<bool contiguous>
+test_constexpr std::string test_fast_norm_to_nfc_utf8(std::string_view str)
+{
+    std::string result(str.size() * una::detail::impl_x_norm_to_nfc_utf8, 0);
+    result.resize(una::detail::impl_norm_to_nfc_utf8<const char*, const char*, char*, contiguous>(
+        str.data(), str.data() + str.size(), result.data()));
+    return result;
+}
+
+test_constexpr bool test_fast_norm_to_nfc()
+{
+    // ASCII run, Latin-1 that can be composed, Cyrillic, CJK and the bound of NFC
+    const std::string_view mixed = "ASCII run 0123456789 e\xC3\xA9t\xC3\xA9 A\xC3\x84 \xD0\x96\xE4\xB8\x96 "
+                                   "\xC2\x9F\xC2\xA0\xC2\xBF\xC3\x80\xCB\xBF\xCC\x80 End of the string";
+
+    const std::string_view inserts[] = {
+        "\xCC\x81",         // U+0301 composes with the previous code point
+        "\xCC\x84",         // U+0304 composes with U+00C4
+        "\xCC\x81\xCC\xA3", // U+0301 U+0323 not in canonical order
+        "\xCD\x84",         // U+0344 Quick_Check=No in NFC
+        "\xE1\x85\xA1",     // U+1161 Quick_Check=Maybe in NFC
+        "\x80",             // Ill-formed
+        "\xC3",             // Truncated
+        "\xC1\x81"          // Overlong
+    };
+
+    TESTX(test_fast_norm_to_nfc_utf8<true>(mixed) == test_fast_norm_to_nfc_utf8<false>(mixed));
+    TESTX(test_fast_norm_to_nfc_utf8<true>(mixed) == mixed);
+
+    for (std::size_t i = 0; i <= mixed.size(); i += 3)
+    {
+        for (std::string_view insert : inserts)
+        {
+            std::string str{mixed.substr(0, i)};
+            str += insert;
+            str += mixed.substr(i);
+
+            TESTX(test_fast_norm_to_nfc_utf8<true>(str) == test_fast_norm_to_nfc_utf8<false>(str));
+        }
+    }
+
+    // Composition with the last code point of the span
+    TESTX(test_fast_norm_to_nfc_utf8<true>("ABCDEFGHIJe\xCC\x81") == "ABCDEFGHIJ\xC3\xA9");
+    TESTX(test_fast_norm_to_nfc_utf8<true>("ABCDEFGHI\xC3\x84\xCC\x84") == "ABCDEFGHI\xC7\x9E");
+    TESTX(test_fast_norm_to_nfc_utf8<true>("ABCDEFGHI\xC3\x84\xCC\x84" "ABCDEFGHI") == "ABCDEFGHI\xC7\x9E" "ABCDEFGHI");
+
+    // U+00A8 has a trailing non-starter in NFKD so CGJ must be inserted before the 30th non-starter
+    std::string str = "ABCDEFGHI\xC2\xA8";
+    for (std::size_t i = 0; i < 30; ++i)
+        str += "\xCC\x96";
+    TESTX(test_fast_norm_to_nfc_utf8<true>(str) == test_fast_norm_to_nfc_utf8<false>(str));
+    TESTX(test_fast_norm_to_nfc_utf8<true>(str).size() == str.size() + 2);
+
+    return true;
+}
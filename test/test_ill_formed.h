@@ -0,0 +1,39 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Ill-formed strings that are shared by the tests of conversion functions,
+// a test appends the strings that are specific to its feature with test_ill_formed_utf8_with etc.
+// The last string ends with an incomplete sequence.
+
+constexpr std::string_view test_ill_formed_utf8[] = {
+    "",
+    "ABC",
+    "\xD0\x9F\xD1\x80\xE4\xBD\xA0\xE5\xA5\xBD\xC2\xA9 Ab\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF",
+    "\x80\xBF\xC2\xE0\xA0\xF0\x9F\x98\xF5\xFF",                     // Stray and truncated
+    "\xE0\x80\x80\xED\xA0\x80\xF0\x8F\xBF\xBF\xF4\x90\x80\x80",     // Overlong, surrogates, out of range
+    "ABCDEFGHIJKLMNOP\xC0\xAF" "ABCDEFGHIJKLMNOP\x80",               // After the fast paths
+    "AB\xF0\x9F\x98"                                                // Truncated at the end
+};
+
+constexpr std::u16string_view test_ill_formed_utf16[] = {
+    u"",
+    u"A\x0410\xFF21\xD835\xDC00\xD835\xDC01",
+    u"\xD800\xDC00\xDC00\xD800" u"A\xD800\xD800\xDC00",             // Lone and reversed surrogates
+    u"ABCDEFGH\xDC00" u"ABCDEFGH\xD800",                            // After the fast paths
+    u"AB\xD835"                                                     // High surrogate at the end
+};
+
+test_constexpr std::vector<std::string_view> test_ill_formed_utf8_with(std::initializer_list<std::string_view> specific)
+{
+    std::vector<std::string_view> result{std::begin(test_ill_formed_utf8), std::end(test_ill_formed_utf8)};
+    result.insert(result.end(), specific);
+    return result;
+}
+
+test_constexpr std::vector<std::u16string_view> test_ill_formed_utf16_with(std::initializer_list<std::u16string_view> specific)
+{
+    std::vector<std::u16string_view> result{std::begin(test_ill_formed_utf16), std::end(test_ill_formed_utf16)};
+    result.insert(result.end(), specific);
+    return result;
+}
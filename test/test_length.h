@@ -0,0 +1,84 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test length functions and una::exact conversion functions with ill-formed sequences
+// the length must always be the same as the length of the result of lenient conversion.
+// Single code points are tested in test_conv_and_iter.h
+
+test_constexpr bool test_length_utf8()
+{
+    const std::vector<std::string_view> strings = test_ill_formed_utf8_with({
+        "\xD0\x90\xD0\x91\xD0\x92",
+        "\xEF\xBC\xA1\xEF\xBC\xA2\xEF\xBC\xA3",
+        "\xF0\x9D\x90\x80\xF0\x9D\x90\x81\xF0\x9D\x90\x82",
+        "A\xD0\x90\xEF\xBC\xA1\xF0\x9D\x90\x80",
+        test_fast_conv_mixed_utf8,                                  // Long enough for fast functions
+        "ABCDEFGH\xF0\x9D\x90\x80\xF0\x9D\x90",                     // Truncated at the end
+        "ABCDEFGH\xE0\x80\x80\xF0\x9D\x90\x80" "ABCDEFGH"
+    });
+
+    for (std::string_view str : strings)
+    {
+        TESTX(una::utf16_length_from_utf8(str) == una::utf8to16u(str).size());
+        TESTX(una::count_codepoints_utf8(str) == una::utf8to32u(str).size());
+    }
+
+    return true;
+}
+
+test_constexpr bool test_length_utf16()
+{
+    const std::u16string_view strings[] = {
+        u"",
+        u"ABC",
+        u"\x0410\x0411\x0412",
+        u"\xFF21\xFF22\xFF23",
+        u"\xD835\xDC00\xD835\xDC01\xD835\xDC02",
+        u"A\x0410\xFF21\xD835\xDC00",
+        u"\xD800",                         // Lone high surrogate
+        u"\xDC00",                         // Lone low surrogate
+        u"\xD800\xD800\xDC00",             // Broken surrogate pair then surrogate pair
+        u"\xDC00\xD800",                   // Reversed surrogate pair
+        u"\xD800" "A",                     // Broken surrogate pair
+        u"\xD835\xDC00\xD800"              // Surrogate pair then lone high surrogate at the end
+    };
+
+    for (std::u16string_view str : strings)
+    {
+        const std::string result = una::utf16to8(str);
+
+        TESTX(una::utf8_length_from_utf16(str) == result.size());
+        TESTX(una::exact::utf16to8(str) == result);
+        TESTX(una::count_codepoints_utf16(str) == una::utf16to32u(str).size());
+    }
+
+    return true;
+}
+
+test_constexpr bool test_length_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"",
+        U"ABC",
+        U"\x0410\x0411\x0412",
+        U"\xFF21\xFF22\xFF23",
+        U"\x0001D400\x0001D401\x0001D402",
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"\xD800\xDC00",                   // Surrogates
+        U"A\x00110000\xFFFFFFFF"           // Out of range
+    };
+
+    for (std::u32string_view str : strings)
+    {
+        const std::string result8 = una::utf32to8(str);
+        const std::u16string result16 = una::utf32to16u(str);
+
+        TESTX(una::utf8_length_from_utf32(str) == result8.size());
+        TESTX(una::utf16_length_from_utf32(str) == result16.size());
+        TESTX(una::exact::utf32to8(str) == result8);
+        TESTX(una::exact::utf32to16u(str) == result16);
+    }
+
+    return true;
+}
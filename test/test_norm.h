@@ -845,6 +845,19 @@ test_constexpr bool test_norm_stream_safe()
     TESTX(una::utf32to16u(NFKC_CGJ) == to_nfkc_utf16(una::utf32to16u(NFKC)));
     TESTX(una::utf32to16u(NFKD_CGJ) == to_nfkd_utf16(una::utf32to16u(NFKD)));
 
+    // 0344 = 0308 0301 in NFD, both are initial non-starters so the next sequence starts with 2 non-starters
+    // and the next CGJ must be inserted 1 code point earlier
+
+    NFC  = U"a" + std::u32string(29, 0x0305) + U"\x0344" + std::u32string(29, 0x0305);
+    NFC_CGJ = U"a" + std::u32string(29, 0x0305) + U"\x034F\x0308\x0301" + std::u32string(28, 0x0305) + U"\x034F\x0305";
+
+    TESTX(una::utf32to8(NFC_CGJ) == una::norm::to_nfc_utf8(una::utf32to8(NFC)));
+    TESTX(una::utf32to8(NFC_CGJ) == una::norm::to_nfd_utf8(una::utf32to8(NFC)));
+    TESTX(una::utf32to16u(NFC_CGJ) == una::norm::to_nfc_utf16(una::utf32to16u(NFC)));
+    TESTX(una::utf32to16u(NFC_CGJ) == una::norm::to_nfd_utf16(una::utf32to16u(NFC)));
+    TESTX(una::norm::is_nfd_utf8(una::utf32to8(NFC_CGJ)));
+    TESTX(una::norm::is_nfd_utf16(una::utf32to16u(NFC_CGJ)));
+
     // Extra test to test that the size of the internal normalization buffer is enough.
     // The following BUF_NFC when decomposes to BUF_NFKD uses the max size of the buffer 51.
     // U+AC01 is LVT hangul that decomposes to 3 starters, U+0300 is non-starter and U+FDFA decomposes to 18 code points.
@@ -869,6 +882,270 @@ test_constexpr bool test_norm_stream_safe()
     return true;
 }
 
+test_constexpr bool test_norm_to_stream_safe()
+{
+    // Note: 0x034F is U+034F COMBINING GRAPHEME JOINER (CGJ) that must be inserted within long sequences (30) of non-starters
+
+    std::u32string str, str_cgj;
+
+    // The same as in test_norm_stream_safe, CGJ must be inserted at the same place
+
+    str = U"\x0F77" + std::u32string(50, 0x0300);
+    str_cgj = str; str_cgj.insert(1 + 30 - 2, 1, 0x034F);
+
+    TESTX(una::norm::to_stream_safe_utf8(una::utf32to8(str)) == una::utf32to8(str_cgj));
+    TESTX(una::norm::to_stream_safe_utf16(una::utf32to16u(str)) == una::utf32to16u(str_cgj));
+    TESTX(una::norm::to_nfc_utf8(una::utf32to8(str)) == una::norm::to_stream_safe_utf8(una::utf32to8(str)));
+
+    // 0344 = 0308 0301 in NFD, both are initial non-starters so the next sequence starts with 2 non-starters
+
+    str = U"a" + std::u32string(29, 0x0305) + U"\x0344" + std::u32string(29, 0x0305);
+    str_cgj = U"a" + std::u32string(29, 0x0305) + U"\x034F\x0344" + std::u32string(28, 0x0305) + U"\x034F\x0305";
+
+    TESTX(una::norm::to_stream_safe_utf8(una::utf32to8(str)) == una::utf32to8(str_cgj));
+    TESTX(una::norm::to_stream_safe_utf16(una::utf32to16u(str)) == una::utf32to16u(str_cgj));
+
+    // The result must be stream-safe after normalization and normalization must not insert CGJ again
+
+    TESTX(una::norm::is_nfd_utf8(una::norm::to_nfd_utf8(una::utf32to8(str))));
+    TESTX(una::norm::is_nfd_utf16(una::norm::to_nfd_utf16(una::utf32to16u(str))));
+    TESTX(una::norm::to_nfd_utf8(una::utf32to8(str)) == una::norm::to_nfd_utf8(una::utf32to8(str_cgj)));
+    TESTX(una::norm::to_nfd_utf16(una::utf32to16u(str)) == una::norm::to_nfd_utf16(una::utf32to16u(str_cgj)));
+
+    // The text is not normalized, ill-formed sequences are replaced
+
+    TESTX(una::norm::to_stream_safe_utf8("e\xCC\x81 \x80") == "e\xCC\x81 \xEF\xBF\xBD");
+    TESTX(una::norm::to_stream_safe_utf16(u"e\x0301 \xD800") == u"e\x0301 \xFFFD");
+    TESTX(una::norm::to_stream_safe_utf8("").empty());
+    TESTX(una::norm::to_stream_safe_utf16(u"").empty());
+
+    return true;
+}
+
+test_constexpr bool test_norm_nfc_inplace_all()
+{
+    // The strings are built from all combinations of the pieces so the untouched prefix
+    // ends before and after all kinds of code points, the result must always be the same as NFC.
+    // 00A8 and 0F77 have trailing non-starters in NFKD, 0F73 and FF9E have initial non-starters in NFKD
+    // so CGJ is inserted in some combinations with 29 non-starters.
+
+    const std::u32string non_starters(29, 0x0316);
+
+    const std::u32string_view pieces[] = {
+        U"ABCDEFGHIJ", U"\x00C0\x00E9", U"\x00A8", U"e", U"\x0301", U"\x0301\x0323", U"\x0344",
+        U"\x1100", U"\x1161", U"\xAC00\x11A8", U"\x0F73", U"\x0F77", U"\xFF9E", U"\x4E16", non_starters
+    };
+
+    for (std::u32string_view piece1 : pieces)
+    {
+        for (std::u32string_view piece2 : pieces)
+        {
+            for (std::u32string_view piece3 : pieces)
+            {
+                const std::u32string str32 = std::u32string{piece1} + std::u32string{piece2} + std::u32string{piece3};
+
+                const std::string str8 = una::utf32to8(str32);
+                const std::string nfc8 = una::norm::to_nfc_utf8(str8);
+                std::string inplace8 = str8;
+                una::norm::to_nfc_utf8_inplace(inplace8);
+                TESTX(inplace8 == nfc8);
+                const una::norm::cow_string<char> cow8 = una::norm::to_nfc_utf8_cow(str8);
+                TESTX(cow8.view() == nfc8);
+                TESTX(cow8.owns() || cow8.view().data() == str8.data());
+
+                const std::u16string str16 = una::utf32to16u(str32);
+                const std::u16string nfc16 = una::norm::to_nfc_utf16(str16);
+                std::u16string inplace16 = str16;
+                una::norm::to_nfc_utf16_inplace(inplace16);
+                TESTX(inplace16 == nfc16);
+                const una::norm::cow_string<char16_t> cow16 = una::norm::to_nfc_utf16_cow(str16);
+                TESTX(cow16.view() == nfc16);
+                TESTX(cow16.owns() || cow16.view().data() == str16.data());
+            }
+        }
+    }
+
+    return true;
+}
+
+test_constexpr bool test_norm_nfc_inplace()
+{
+    // Already in NFC
+    const std::string_view nfc = "ABCDEFGHIJ\xC3\xA9\xD0\x96\xE4\xB8\x96\xEA\xB0\x80";
+    TESTX(!una::norm::to_nfc_utf8_cow(nfc).owns());
+    TESTX(una::norm::to_nfc_utf8_cow(nfc).view().data() == nfc.data());
+    TESTX(una::norm::to_nfc_utf8_cow(nfc).to_string() == nfc);
+    TESTX(!una::norm::to_nfc_utf16_cow(u"ABC\x00E9").owns());
+    TESTX(una::norm::to_nfc_utf8_cow("").view().empty());
+
+    // Already in NFC but U+0303 has NFC_Quick_Check=Maybe so the prefix ends before it
+    const std::string_view nfc_maybe = "ABCDEFGHIJx\xCC\x83" "ABC";
+    TESTX(!una::norm::to_nfc_utf8_cow(nfc_maybe).owns());
+    TESTX(una::norm::to_nfc_utf8_cow(nfc_maybe).view().data() == nfc_maybe.data());
+    TESTX(!una::norm::to_nfc_utf16_cow(u"ABCx\x0303").owns());
+    std::string str_maybe{nfc_maybe};
+    const char* const str_maybe_data = str_maybe.data();
+    una::norm::to_nfc_utf8_inplace(str_maybe);
+    TESTX(str_maybe == nfc_maybe);
+    TESTX(str_maybe.data() == str_maybe_data);
+    std::u16string str16_maybe = u"ABCx\x0303";
+    una::norm::to_nfc_utf16_inplace(str16_maybe);
+    TESTX(str16_maybe == u"ABCx\x0303");
+
+    // The segment with Quick_Check=Maybe is the same in NFC so the scan continues after it
+    const std::string_view nfc_maybe2 = "x\xCC\x83" "ABC" "x\xCC\x83" "ABC";
+    TESTX(!una::norm::to_nfc_utf8_cow(nfc_maybe2).owns());
+    TESTX(una::norm::to_nfc_utf8_cow("x\xCC\x83" "ABCe\xCC\x81" "ABC").to_string() == "x\xCC\x83" "ABC\xC3\xA9" "ABC");
+    str_maybe = "x\xCC\x83" "ABCe\xCC\x81" "ABC";
+    una::norm::to_nfc_utf8_inplace(str_maybe);
+    TESTX(str_maybe == "x\xCC\x83" "ABC\xC3\xA9" "ABC");
+    // U+11A8 has Quick_Check=Maybe and composes with the previous syllable
+    TESTX(una::norm::to_nfc_utf16_cow(u"\xAC00\x11A8" u"ABC").to_string() == u"\xAC01" u"ABC");
+    TESTX(!una::norm::to_nfc_utf16_cow(u"\xAC01\x11A8" u"ABC").owns());
+
+    // The prefix is untouched and the rest is normalized
+    std::string str = "ABCDEFGHIJe\xCC\x81" "ABC";
+    una::norm::to_nfc_utf8_inplace(str);
+    TESTX(str == "ABCDEFGHIJ\xC3\xA9" "ABC");
+    TESTX(una::norm::to_nfc_utf8_cow("ABCDEFGHIJe\xCC\x81" "ABC").owns());
+    TESTX(una::norm::to_nfc_utf8_cow("ABCDEFGHIJe\xCC\x81" "ABC").to_string() == "ABCDEFGHIJ\xC3\xA9" "ABC");
+
+    // Ill-formed
+    str = "ABCDEFGHIJ\x80" "ABC";
+    una::norm::to_nfc_utf8_inplace(str);
+    TESTX(str == "ABCDEFGHIJ\xEF\xBF\xBD" "ABC");
+    std::u16string str16 = u"ABC\xDC00";
+    una::norm::to_nfc_utf16_inplace(str16);
+    TESTX(str16 == u"ABC\xFFFD");
+
+    // CGJ must be inserted (see test_norm_stream_safe)
+    str = "ABCDEFGHIJ\xC2\xA8";
+    for (std::size_t i = 0; i < 30; ++i)
+        str += "\xCC\x96";
+    const std::string nfc_cgj = una::norm::to_nfc_utf8(str);
+    TESTX(nfc_cgj.size() == str.size() + 2);
+    TESTX(una::norm::to_nfc_utf8_cow(str).view() == nfc_cgj);
+    una::norm::to_nfc_utf8_inplace(str);
+    TESTX(str == nfc_cgj);
+
+    return true;
+}
+
+test_constexpr bool test_norm_nfkc_chunks()
+{
+    // NFKC and NFKD functions normalize long strings by chunks split at stable starters
+    // so the result must be the same as the result of the views that don't use chunks.
+    // The run of non-starters is longer than a chunk so it cannot be split and CGJ is inserted there.
+
+    std::string str8;
+    for (std::size_t i = 0; str8.size() < 5000; ++i)
+    {
+        str8 += "ABC \xEF\xBC\xA1\xEF\xBE\x9E\xEF\xBE\x9E\xC2\xA8\xCC\x81\xE1\x84\x80\xE1\x85\xA1\xEF\xAC\x81\x80";
+        if (i % 7 == 0)
+            str8 += "\xE2\x84\xAB\xCC\xA3";
+        if (i == 20)
+        {
+            for (std::size_t j = 0; j < 1500; ++j)
+                str8 += (j % 2) ? "\xCC\x81" : "\xCC\x96";
+        }
+    }
+    const std::u16string str16 = una::utf8to16u(str8);
+
+    TESTX(una::norm::to_nfkc_utf8(str8) == to_nfkc_utf8(str8));
+    TESTX(una::norm::to_nfkd_utf8(str8) == to_nfkd_utf8(str8));
+    TESTX(una::norm::to_nfkc_utf16(str16) == to_nfkc_utf16(str16));
+    TESTX(una::norm::to_nfkd_utf16(str16) == to_nfkd_utf16(str16));
+
+    return true;
+}
+
+template<class Dst, class View>
+test_constexpr Dst test_norm_join_chunks(View&& view)
+{
+    Dst dst;
+    for (auto chunk : view)
+    {
+        if (chunk.empty()) // Chunks are never empty
+            return Dst{};
+        dst += chunk;
+    }
+    return dst;
+}
+
+test_constexpr bool test_norm_utf_views()
+{
+    // UTF-8/UTF-16 views must produce the same result as the normalization functions
+
+    TESTX(test_norm_join_chunks<std::string>(std::string_view{"Å\xCC\xA3 ｶﾞ \x80"} | una::views::norm::nfc_utf8) == "Ạ\xCC\x8A ｶﾞ \xEF\xBF\xBD");
+    TESTX(test_norm_join_chunks<std::string>(std::string_view{"Å\xCC\xA3 ｶﾞ \x80"} | una::views::norm::nfd_utf8) == "A\xCC\xA3\xCC\x8A ｶﾞ \xEF\xBF\xBD");
+    TESTX(test_norm_join_chunks<std::string>(std::string_view{"Å\xCC\xA3 ｶﾞ \x80"} | una::views::norm::nfkc_utf8) == "Ạ\xCC\x8A ガ \xEF\xBF\xBD");
+    TESTX(test_norm_join_chunks<std::string>(std::string_view{"Å\xCC\xA3 ｶﾞ \x80"} | una::views::norm::nfkd_utf8) == "A\xCC\xA3\xCC\x8A カ\xE3\x82\x99 \xEF\xBF\xBD");
+
+    TESTX(test_norm_join_chunks<std::u16string>(std::u16string_view{u"Å\x0323 ｶﾞ \xD800"} | una::views::norm::nfc_utf16) == u"Ạ\x030A ｶﾞ \xFFFD");
+    TESTX(test_norm_join_chunks<std::u16string>(std::u16string_view{u"Å\x0323 ｶﾞ \xD800"} | una::views::norm::nfd_utf16) == u"A\x0323\x030A ｶﾞ \xFFFD");
+    TESTX(test_norm_join_chunks<std::u16string>(std::u16string_view{u"Å\x0323 ｶﾞ \xD800"} | una::views::norm::nfkc_utf16) == u"Ạ\x030A ガ \xFFFD");
+    TESTX(test_norm_join_chunks<std::u16string>(std::u16string_view{u"Å\x0323 ｶﾞ \xD800"} | una::views::norm::nfkd_utf16) == u"A\x0323\x030A カ\x3099 \xFFFD");
+
+    TESTX((std::string_view{} | una::views::norm::nfc_utf8).begin() == una::sentinel);
+    TESTX((std::u16string_view{} | una::views::norm::nfd_utf16).begin() == una::sentinel);
+
+    // Class template argument deduction
+    TESTX(*una::ranges::norm::nfc_utf8_view{std::string_view{"A\xCC\x8A"}}.begin() == "Å");
+    TESTX(*una::ranges::norm::nfd_utf16_view{std::u16string_view{u"Å"}}.begin() == u"A\x030A");
+
+    return true;
+}
+
+test_constexpr bool test_norm_utf_views_long()
+{
+    // The output is split into many chunks and a long run of non-starters
+    // exhausts the buffer of the normalization algorithm so CGJ is inserted there
+
+    std::string str8;
+    for (std::size_t i = 0; str8.size() < 20000; ++i)
+    {
+        str8 += "ABC \xEF\xBC\xA1\xEF\xBE\x9E\xEF\xBE\x9E\xC2\xA8\xCC\x81\xE1\x84\x80\xE1\x85\xA1\xEF\xAC\x81\x80";
+        str8 += "\xE2\x84\xAB\xCC\xA3 \xD0\x98\xCC\x86 \xF0\x9D\x85\x9E\xF0\x9D\x85\xA5 \xE6\x9D\xB1\xE4\xBA\xAC";
+        if (i % 50 == 0)
+        {
+            for (std::size_t j = 0; j < 100; ++j)
+                str8 += (j % 2) ? "\xCC\x81" : "\xCC\x96";
+        }
+    }
+    const std::u16string str16 = una::utf8to16u(str8);
+
+    TESTX(test_norm_join_chunks<std::string>(str8 | una::views::norm::nfc_utf8) == una::norm::to_nfc_utf8(str8));
+    TESTX(test_norm_join_chunks<std::string>(str8 | una::views::norm::nfd_utf8) == una::norm::to_nfd_utf8(str8));
+    TESTX(test_norm_join_chunks<std::string>(str8 | una::views::norm::nfkc_utf8) == una::norm::to_nfkc_utf8(str8));
+    TESTX(test_norm_join_chunks<std::string>(str8 | una::views::norm::nfkd_utf8) == una::norm::to_nfkd_utf8(str8));
+
+    TESTX(test_norm_join_chunks<std::u16string>(str16 | una::views::norm::nfc_utf16) == una::norm::to_nfc_utf16(str16));
+    TESTX(test_norm_join_chunks<std::u16string>(str16 | una::views::norm::nfd_utf16) == una::norm::to_nfd_utf16(str16));
+    TESTX(test_norm_join_chunks<std::u16string>(str16 | una::views::norm::nfkc_utf16) == una::norm::to_nfkc_utf16(str16));
+    TESTX(test_norm_join_chunks<std::u16string>(str16 | una::views::norm::nfkd_utf16) == una::norm::to_nfkd_utf16(str16));
+
+    // The cached begin and the copy of the iterator must keep their own chunks
+    auto view8 = str8 | una::views::norm::nfc_utf8;
+    TESTX(test_norm_join_chunks<std::string>(view8) == una::norm::to_nfc_utf8(str8));
+    TESTX(test_norm_join_chunks<std::string>(view8) == una::norm::to_nfc_utf8(str8));
+
+    auto view16 = str16 | una::views::norm::nfkd_utf16;
+    TESTX(test_norm_join_chunks<std::u16string>(view16) == una::norm::to_nfkd_utf16(str16));
+    TESTX(test_norm_join_chunks<std::u16string>(view16) == una::norm::to_nfkd_utf16(str16));
+
+    std::string result8;
+    for (auto it = view8.begin(); it != view8.end();)
+        result8 += *it++;
+    TESTX(result8 == una::norm::to_nfc_utf8(str8));
+
+    std::u16string result16;
+    for (auto it = view16.begin(); it != view16.end();)
+        result16 += *it++;
+    TESTX(result16 == una::norm::to_nfkd_utf16(str16));
+
+    return true;
+}
+
 test_constexpr std::string to_nfc_utf8(std::string_view str)
 {
     return str | una::views::utf8 | una::views::norm::nfc | una::ranges::to_utf8<std::string>();
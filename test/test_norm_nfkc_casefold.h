@@ -0,0 +1,130 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// If it fails a compiler messed up the UTF-8 encoding of this file.
+// If the compiler is MSVC then /utf-8 command line option must be used.
+static_assert(U'㋡' == 0x32E1);
+
+test_constexpr bool test_norm_nfkc_casefold()
+{
+    TESTX(una::norm::to_nfkc_casefold_utf8("Straße ẞ") == "strasse ss");
+    TESTX(una::norm::to_nfkc_casefold_utf8("ＡＢＣ ﬁ Ǆ ㈎") == "abc fi dž (가)");
+    TESTX(una::norm::to_nfkc_casefold_utf8("İstanbul") == "i\xCC\x87stanbul");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xE2\x84\xA6 \xE2\x84\xAB") == "ω å"); // U+2126 U+212B
+    TESTX(una::norm::to_nfkc_casefold_utf8("ｶﾞ ᾈ") == "ガ ἀι");
+    // Default_Ignorable_Code_Point is removed: U+00AD, U+3164, U+E0001
+    TESTX(una::norm::to_nfkc_casefold_utf8("A\xC2\xAD" "B \xE3\x85\xA4\xE1\x84\x80\xE1\x85\xA1 C\xF3\xA0\x80\x81") == "ab 가 c");
+    // U+0345 is mapped to the starter U+03B9 before canonical ordering so the non-starters
+    // after it stay after it, U+FF9E is mapped to the non-starter U+3099 (the results are from ICU)
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xE1\xBE\x90\xCC\xA3") == "\xE1\xBC\xA0\xCE\xB9\xCC\xA3");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xE1\xBE\x90\xF3\xA0\x80\x81\xCC\xA3") == "\xE1\xBC\xA0\xCE\xB9\xCC\xA3");
+    TESTX(una::norm::to_nfkc_casefold_utf8("a\xCD\x85\xCC\x96") == "a\xCE\xB9\xCC\x96");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xCE\xB1\xCD\x85\xCC\x81") == "\xCE\xB1\xCE\xAF");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xE1\xBE\x80\xE0\xBD\xB1") == "\xE1\xBC\x80\xCE\xB9\xE0\xBD\xB1");
+    TESTX(una::norm::to_nfkc_casefold_utf8("a\xCD\x85\xEF\xBE\x9E") == "a\xCE\xB9\xE3\x82\x99");
+    // A removed code point does not block canonical ordering and composition
+    TESTX(una::norm::to_nfkc_casefold_utf8("a\xCC\x81\xC2\xAD\xCC\x96") == "\xC3\xA1\xCC\x96");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\x80") == "\xEF\xBF\xBD");
+    TESTX(una::norm::to_nfkc_casefold_utf8("") == "");
+
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"Straße ẞ") == u"strasse ss");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"ＡＢＣ ﬁ Ǆ ㈎") == u"abc fi dž (가)");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"İstanbul") == u"i\x0307stanbul");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\x2126 \x212B") == u"ω å");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"ｶﾞ ᾈ") == u"ガ ἀι");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"A\x00AD" u"B \x3164\x1100\x1161 C\xDB40\xDC01") == u"ab 가 c");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\x1F90\x0323") == u"\x1F20\x03B9\x0323");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\x1F90\xDB40\xDC01\x0323") == u"\x1F20\x03B9\x0323");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"a\x0345\x0316") == u"a\x03B9\x0316");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\x03B1\x0345\x0301") == u"\x03B1\x03AF");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\x1F80\x0F71") == u"\x1F00\x03B9\x0F71");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"a\x0345\xFF9E") == u"a\x03B9\x3099");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"a\x0301\x00AD\x0316") == u"\x00E1\x0316");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\xD800") == u"\xFFFD");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"") == u"");
+
+    return true;
+}
+
+test_constexpr bool test_norm_nfkc_casefold_stable()
+{
+    // The result must be stable: NFKC_Casefold(X) == NFKC_Casefold(NFKC_Casefold(X))
+    // so CGJ that is inserted after 30 non-starters must not be in the result
+
+    std::string str = "a";
+    std::string str_nfc = "\xC3\xA1"; // U+00E1
+    for (std::size_t i = 0; i < 40; ++i)
+        str += "\xCC\x81";
+    for (std::size_t i = 0; i < 39; ++i)
+        str_nfc += "\xCC\x81";
+    std::string str_mixed = "A";
+    for (std::size_t i = 0; i < 25; ++i)
+        str_mixed += "\xCC\x81\xCC\x96";
+    // U+0345 is mapped to a starter, U+FF9E is mapped to a non-starter
+    std::string str_iota = "a";
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 20; ++j)
+            str_iota += "\xCC\x81";
+        str_iota += "\xCD\x85\xEF\xBE\x9E";
+        for (std::size_t j = 0; j < 15; ++j)
+            str_iota += "\xCC\x96";
+    }
+
+    TESTX(una::norm::to_nfkc_casefold_utf8(str) == str_nfc);
+    TESTX(una::norm::to_nfkc_casefold_utf8(una::norm::to_nfkc_casefold_utf8(str)) ==
+          una::norm::to_nfkc_casefold_utf8(str));
+    TESTX(una::norm::to_nfkc_casefold_utf8(una::norm::to_nfkc_casefold_utf8(str_mixed)) ==
+          una::norm::to_nfkc_casefold_utf8(str_mixed));
+    TESTX(una::norm::to_nfkc_casefold_utf8(str_mixed).find("\xCD\x8F") == std::string::npos);
+    TESTX(una::norm::to_nfkc_casefold_utf8(una::norm::to_nfkc_casefold_utf8(str_iota)) ==
+          una::norm::to_nfkc_casefold_utf8(str_iota));
+
+    const std::u16string str16 = una::utf8to16u(str);
+    const std::u16string str16_nfc = una::utf8to16u(str_nfc);
+    const std::u16string str16_mixed = una::utf8to16u(str_mixed);
+    const std::u16string str16_iota = una::utf8to16u(str_iota);
+
+    TESTX(una::norm::to_nfkc_casefold_utf16(str16) == str16_nfc);
+    TESTX(una::norm::to_nfkc_casefold_utf16(una::norm::to_nfkc_casefold_utf16(str16)) ==
+          una::norm::to_nfkc_casefold_utf16(str16));
+    TESTX(una::norm::to_nfkc_casefold_utf16(una::norm::to_nfkc_casefold_utf16(str16_mixed)) ==
+          una::norm::to_nfkc_casefold_utf16(str16_mixed));
+    TESTX(una::norm::to_nfkc_casefold_utf16(str16_mixed).find(u'\x034F') == std::u16string::npos);
+    TESTX(una::norm::to_nfkc_casefold_utf16(una::norm::to_nfkc_casefold_utf16(str16_iota)) ==
+          una::norm::to_nfkc_casefold_utf16(str16_iota));
+
+    return true;
+}
+
+test_constexpr bool test_norm_nfkc_casefold_long()
+{
+    // Must be the same as NFKC -> full case folding -> NFKC if there are no code points
+    // that are removed, the string is long enough to be split into chunks
+
+    std::string str;
+    for (std::size_t i = 0; i < 300; ++i)
+    {
+        str += "The Quick Brown Fox Straße ÉCOLE naïve ﬁne Ｆｕｌｌ ｶﾞ ㈎ Ǆ İ Å\xCC\xA3\xCC\x81 ";
+        str += "ᄀ\xE1\x85\xA1\xE1\x86\xA8 ΣΑΣ Привет 東京 ᾐ ᾈ ᾳ \xE1\xBE\x90\xCC\xA3 \x80";
+        if (i == 100)
+        {
+            str += "A";
+            for (std::size_t j = 0; j < 40; ++j)
+                str += "\xCC\x81";
+        }
+    }
+
+    const std::u16string str16 = una::utf8to16u(str);
+
+    std::string expected = una::norm::to_nfkc_utf8(una::cases::to_casefold_utf8(una::norm::to_nfkc_utf8(str)));
+    // NFKC_Casefold removes U+034F CGJ that NFKC inserts after 30 non-starters
+    for (std::size_t pos = expected.find("\xCD\x8F"); pos != std::string::npos; pos = expected.find("\xCD\x8F", pos))
+        expected.erase(pos, 2);
+
+    TESTX(una::norm::to_nfkc_casefold_utf8(str) == expected);
+    TESTX(una::norm::to_nfkc_casefold_utf16(str16) == una::utf8to16u(expected));
+
+    return true;
+}
@@ -0,0 +1,124 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test una::offset_index the offsets are compared with the offsets that are found
+// with UTF-8 view by a scan from the start of the text for every offset.
+
+inline bool test_offset_index_check(const una::offset_index& index, std::string_view str)
+{
+    // The start of every code point in UTF-8, UTF-16 and code points and the end of the text
+    struct start { std::size_t utf8, utf16, codepoint; };
+    std::vector<start> starts;
+
+    una::ranges::utf8_view<std::string_view> view{str};
+    std::size_t i16 = 0, i32 = 0;
+    for (auto it = view.begin(); it != view.end(); ++it)
+    {
+        starts.push_back({static_cast<std::size_t>(it.begin() - str.begin()), i16, i32});
+        i16 += (*it >= 0x10000) ? 2u : 1u;
+        i32 += 1;
+    }
+    starts.push_back({str.size(), i16, i32});
+
+    std::size_t s = 0;
+    for (std::size_t i = 0; i <= str.size() + 1; ++i)
+    {
+        // The offset in the middle of a code point is rounded down
+        while (s + 1 < starts.size() && starts[s + 1].utf8 <= i)
+            ++s;
+
+        TESTX(index.utf16_offset(i) == starts[s].utf16);
+        TESTX(index.codepoint_index(i) == starts[s].codepoint);
+    }
+
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        TESTX(index.utf8_offset_from_utf16(starts[i].utf16) == starts[i].utf8);
+        TESTX(index.utf8_offset_from_codepoint(starts[i].codepoint) == starts[i].utf8);
+        TESTX(index.utf16_offset_from_codepoint(starts[i].codepoint) == starts[i].utf16);
+        TESTX(index.codepoint_index_from_utf16(starts[i].utf16) == starts[i].codepoint);
+
+        // The middle of a surrogate pair
+        if (i + 1 < starts.size() && starts[i + 1].utf16 - starts[i].utf16 == 2)
+            TESTX(index.utf8_offset_from_utf16(starts[i].utf16 + 1) == starts[i].utf8);
+    }
+
+    // Out of range
+    TESTX(index.utf8_offset_from_utf16(i16 + 1) == str.size());
+    TESTX(index.utf8_offset_from_codepoint(i32 + 1) == str.size());
+
+    return true;
+}
+
+inline std::string test_offset_index_make(std::size_t size)
+{
+    const std::string_view mixed =
+        "\xD0\x9F\xD1\x80\xE4\xBD\xA0\xE5\xA5\xBD\xC2\xA9 Ab\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF\xE4\xB8\x96\xD0\x96"
+        "\x80\xE4\xBD" "A\xF0\x9F\x98\xED\xA0\x80"; // Ill-formed
+
+    std::string str;
+    while (str.size() < size)
+        str += mixed;
+
+    return str;
+}
+
+inline bool test_offset_index()
+{
+    TESTX(test_offset_index_check(una::offset_index{}, ""));
+    TESTX(test_offset_index_check(una::offset_index{"ABC"}, "ABC"));
+
+    const std::string str = test_offset_index_make(1000);
+    TESTX(test_offset_index_check(una::offset_index{str}, str));
+
+    // Incomplete sequence at the end
+    const std::string str2 = str + "\xF0\x9F\x98";
+    TESTX(test_offset_index_check(una::offset_index{str2}, str2));
+
+    return true;
+}
+
+inline bool test_offset_index_update()
+{
+    const std::string str = test_offset_index_make(400);
+
+    const std::string_view inserts[] = {
+        "", "A", "\xD0\x96", "\x80", "\x9F\x98\x80", "\xF0\x9F", // Can complete or break a sequence
+        "\xF0\x9F\x98\x80\xE4\xB8\x96\xD0\x96 ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789 "
+        "\xF0\x9F\x98\x80\xE4\xB8\x96\xD0\x96 ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789 "
+        "\xF0\x9F\x98\x80\xE4\xB8\x96\xD0\x96 ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789 "
+    };
+
+    for (std::size_t pos = 0; pos <= str.size(); pos += 19)
+    {
+        for (std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{100}})
+        {
+            if (pos + count > str.size())
+                continue;
+
+            for (std::string_view insert : inserts)
+            {
+                una::offset_index index{str};
+
+                std::string edited = str;
+                edited.replace(pos, count, insert);
+                index.update(edited, pos, count, insert.size());
+
+                TESTX(test_offset_index_check(index, edited));
+            }
+        }
+    }
+
+    // Several edits in a row
+    std::string edited = str;
+    una::offset_index index{edited};
+    for (std::size_t pos = 0; pos + 10 < edited.size(); pos += 97)
+    {
+        edited.replace(pos, 3, inserts[pos % 7]);
+        index.update(edited, pos, 3, inserts[pos % 7].size());
+    }
+    TESTX(test_offset_index_check(index, edited));
+
+    return true;
+}
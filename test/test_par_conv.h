@@ -0,0 +1,108 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test parallel conversion and validation functions, the source is split between threads
+// at different points so ill-formed sequences are placed near the split points too.
+// The result and the error position must always be the same as for the usual functions.
+
+inline std::string test_par_conv_make_utf8(std::size_t size)
+{
+    const std::string_view mixed =
+        "\xD0\x9F\xD1\x80\xE4\xBD\xA0\xE5\xA5\xBD\xC2\xA9 Ab"
+        "\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF\xE4\xB8\x96\xD0\x96";
+
+    std::string str;
+    while (str.size() < size)
+        str += mixed;
+
+    return str;
+}
+
+inline bool test_par_conv_utf8()
+{
+    const std::string str = test_par_conv_make_utf8(1024 * 1024);
+    const std::u16string str16 = una::utf8to16u(str);
+    const std::u32string str32 = una::utf8to32u(str);
+
+    for (std::size_t threads = 1; threads <= 5; ++threads)
+    {
+        TESTX(una::par::utf8to16u(str, threads) == str16);
+        TESTX(una::par::utf8to32u(str, threads) == str32);
+        TESTX(una::par::utf16to8(str16, threads) == str);
+        TESTX(una::par::utf32to8(str32, threads) == str);
+        TESTX(una::par::utf16to32u(str16, threads) == str32);
+        TESTX(una::par::utf32to16u(str32, threads) == str16);
+        TESTX(una::par::is_valid_utf8(str, threads));
+        TESTX(una::par::is_valid_utf16(str16, threads));
+        TESTX(una::par::is_valid_utf32(str32, threads));
+    }
+
+    // The string is smaller than the minimum part
+    TESTX(una::par::utf8to16u("\xD0\x9F\x80", 4) == u"\x041F\xFFFD");
+
+    return true;
+}
+
+inline bool test_par_conv_error()
+{
+    const std::string mixed = test_par_conv_make_utf8(512 * 1024);
+
+    // Ill-formed sequences near every split point for 4 threads
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        for (std::size_t part = 1; part < 4; ++part)
+        {
+            std::string str = mixed;
+            const std::size_t pos = str.size() / 4 * part - 4 + i;
+            str[pos] = 'A';
+            str[pos + 1] = '\x80';
+
+            una::error error1, error2;
+
+            TESTX(una::par::utf8to16u(str, 4) == una::utf8to16u(str));
+            TESTX(una::par::strict::utf8to16u(str, error1, 4) == una::strict::utf8to16u(str, error2));
+            TESTX(error1 && error2 && error1.pos() == error2.pos());
+            TESTX(!una::par::is_valid_utf8(str, error1, 4) && !una::is_valid_utf8(str, error2));
+            TESTX(error1 && error2 && error1.pos() == error2.pos());
+
+            std::u16string str16 = una::utf8to16u(mixed);
+            const std::size_t pos16 = str16.size() / 4 * part - 2 + i / 2;
+            str16[pos16 - 1] = u'A';
+            str16[pos16] = 0xDC00;
+            TESTX(una::par::utf16to8(str16, 4) == una::utf16to8(str16));
+            TESTX(una::par::strict::utf16to8(str16, error1, 4) == una::strict::utf16to8(str16, error2));
+            TESTX(error1 && error2 && error1.pos() == error2.pos());
+            TESTX(!una::par::is_valid_utf16(str16, error1, 4) && !una::is_valid_utf16(str16, error2));
+            TESTX(error1 && error2 && error1.pos() == error2.pos());
+        }
+    }
+
+    // Ill-formed sequences near the block split points inside of a part (see par_blocks)
+    // and in every part, the workers after the first error stop early
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        std::string str = mixed;
+        for (std::size_t part = 0; part < 4; ++part)
+        {
+            const std::size_t pos = str.size() / 4 * part + una::detail::par_block * (4 - part) - 4 + i;
+            str[pos] = 'A';
+            str[pos + 1] = '\x80';
+        }
+
+        una::error error1, error2;
+
+        TESTX(una::par::strict::utf8to16u(str, error1, 4) == una::strict::utf8to16u(str, error2));
+        TESTX(error1 && error2 && error1.pos() == error2.pos());
+        TESTX(una::par::strict::utf8to32u(str, error1, 4) == una::strict::utf8to32u(str, error2));
+        TESTX(error1 && error2 && error1.pos() == error2.pos());
+        TESTX(!una::par::is_valid_utf8(str, error1, 4) && !una::is_valid_utf8(str, error2));
+        TESTX(error1 && error2 && error1.pos() == error2.pos());
+    }
+
+    una::error error;
+    TESTX(una::par::strict::utf8to16u(mixed, error, 4) == una::utf8to16u(mixed) && !error);
+    TESTX(una::par::is_valid_utf8(mixed, error, 4) && !error);
+
+    return true;
+}
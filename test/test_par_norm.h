@@ -0,0 +1,65 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test parallel normalization functions, the source is split between threads
+// at stable starters so the code points that interact with each other in normalization
+// (combining marks, Hangul, long runs of non-starters, ill-formed sequences) are placed
+// near the split points too. The result must always be the same as for the usual functions.
+
+inline std::string test_par_norm_make_utf8(std::size_t size)
+{
+    const std::string_view mixed =
+        "A\xCC\x81\xCC\xA3" "e\xCC\x81"                     // A + U+0301 + U+0323, e + U+0301
+        "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"             // Hangul L+V+T
+        "\xC3\x85\xEF\xBE\x9E" "Z\x80"                      // U+00C5, U+FF9E, ill-formed
+        "\xE4\xB8\x96\xE1\xBA\xA0\xCC\x86 Ab";              // U+4E16, U+1EA0 + U+0306
+
+    std::string str;
+    while (str.size() < size)
+        str += mixed;
+
+    return str;
+}
+
+inline bool test_par_norm_utf8()
+{
+    const std::string str = test_par_norm_make_utf8(1024 * 1024);
+    const std::string nfc = una::norm::to_nfc_utf8(str);
+    const std::string nfd = una::norm::to_nfd_utf8(str);
+
+    for (std::size_t threads = 1; threads <= 5; ++threads)
+    {
+        TESTX(una::norm::par::to_nfc_utf8(str, threads) == nfc);
+        TESTX(una::norm::par::to_nfd_utf8(str, threads) == nfd);
+    }
+
+    // The string is smaller than the minimum part
+    TESTX(una::norm::par::to_nfc_utf8("A\xCC\x8A", 4) == "\xC3\x85");
+
+    // Runs of non-starters (more than 30 for CGJ insertion) near every split point for 4 threads
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        std::string s = test_par_norm_make_utf8(512 * 1024);
+        for (std::size_t part = 1; part < 4; ++part)
+        {
+            std::size_t pos = s.size() / 4 * part - 40 + i * 9;
+            while ((s[pos] & 0xC0) == 0x80)
+                ++pos;
+            std::string marks = "\xE1\x84\x80";
+            for (std::size_t j = 0; j < 35; ++j)
+                marks += (j % 2) ? "\xCC\x81" : "\xCC\xA3";
+            s.insert(pos, marks);
+        }
+        TESTX(una::norm::par::to_nfc_utf8(s, 4) == una::norm::to_nfc_utf8(s));
+        TESTX(una::norm::par::to_nfd_utf8(s, 4) == una::norm::to_nfd_utf8(s));
+    }
+
+    // No stable starters at all so everything goes to one part
+    std::string marks;
+    while (marks.size() < 512 * 1024)
+        marks += "\xCC\x81\xCC\xA3";
+    TESTX(una::norm::par::to_nfc_utf8(marks, 4) == una::norm::to_nfc_utf8(marks));
+
+    return true;
+}
@@ -123,6 +123,84 @@ test_constexpr bool test_short_func_conv()
     TESTX(una::is_valid_utf8(u8str, error));
 #endif // __cpp_lib_char8_t
 
+//---------------------------------------------
+// una::exact namespace and length functions
+//---------------------------------------------
+
+    TESTX(una::exact::utf16to8(u16str) == str);
+    TESTX(una::exact::utf32to8(u32str) == str);
+    TESTX(una::exact::utf32to16u(u32str) == u16str);
+
+    TESTX(una::utf8_length_from_utf16(u16str) == 3);
+    TESTX(una::utf8_length_from_utf32(u32str) == 3);
+    TESTX(una::utf16_length_from_utf32(u32str) == 3);
+    TESTX(una::utf16_length_from_utf8(str) == 3);
+    TESTX(una::count_codepoints_utf8(str) == 3);
+    TESTX(una::count_codepoints_utf16(u16str) == 3);
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    TESTX(una::exact::utf16to8(wstr) == str);
+    TESTX(una::exact::utf32to16(u32str) == wstr);
+
+    TESTX(una::utf8_length_from_utf16(wstr) == 3);
+    TESTX(una::count_codepoints_utf16(wstr) == 3);
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+    TESTX(una::exact::utf32to8(wstr) == str);
+    TESTX(una::exact::utf32to16u(wstr) == u16str);
+
+    TESTX(una::utf8_length_from_utf32(wstr) == 3);
+    TESTX(una::utf16_length_from_utf32(wstr) == 3);
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+#ifdef __cpp_lib_char8_t
+    TESTX(una::exact::utf16to8u(u16str) == u8str);
+    TESTX(una::exact::utf32to8u(u32str) == u8str);
+    TESTX(una::utf16_length_from_utf8(u8str) == 3);
+    TESTX(una::count_codepoints_utf8(u8str) == 3);
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    TESTX(una::exact::utf16to8u(wstr) == u8str);
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+    TESTX(una::exact::utf32to8u(wstr) == u8str);
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+#endif // __cpp_lib_char8_t
+
+// Conversion functions that write to a buffer
+
+#ifdef __cpp_lib_span
+    {
+        char buf8[3] = {};
+        char16_t buf16[3] = {};
+        char32_t buf32[3] = {};
+        una::conv_state state;
+
+        TESTX(una::utf8to16_into(str, buf16).written == 3);
+        TESTX(una::utf16to8_into(u16str, buf8).written == 3);
+        TESTX(una::utf8to32_into(str, buf32).written == 3);
+        TESTX(una::utf32to8_into(u32str, buf8).written == 3);
+        TESTX(una::utf16to32_into(u16str, buf32).written == 3);
+        TESTX(una::utf32to16_into(u32str, buf16).written == 3);
+        TESTX(una::utf8to16_into(str, buf16, state).written == 3);
+        TESTX(una::utf16to8_into(u16str, buf8, state).written == 3);
+        TESTX(una::utf8to32_into(str, buf32, state).written == 3);
+        TESTX(una::utf32to8_into(u32str, buf8, state).written == 3);
+        TESTX(una::utf16to32_into(u16str, buf32, state).written == 3);
+        TESTX(una::utf32to16_into(u32str, buf16, state).written == 3);
+
+        TESTX(una::strict::utf8to16_into(str, buf16).written == 3);
+        TESTX(una::strict::utf16to8_into(u16str, buf8).written == 3);
+        TESTX(una::strict::utf8to32_into(str, buf32).written == 3);
+        TESTX(una::strict::utf32to8_into(u32str, buf8).written == 3);
+        TESTX(una::strict::utf16to32_into(u16str, buf32).written == 3);
+        TESTX(una::strict::utf32to16_into(u32str, buf16).written == 3);
+        TESTX(una::strict::utf8to16_into(str, buf16, state).written == 3);
+        TESTX(una::strict::utf16to8_into(u16str, buf8, state).written == 3);
+        TESTX(una::strict::utf8to32_into(str, buf32, state).written == 3);
+        TESTX(una::strict::utf32to8_into(u32str, buf8, state).written == 3);
+        TESTX(una::strict::utf16to32_into(u16str, buf32, state).written == 3);
+        TESTX(una::strict::utf32to16_into(u32str, buf16, state).written == 3);
+    }
+#endif // __cpp_lib_span
+
     return true;
 }
 
@@ -278,6 +356,9 @@ test_constexpr bool test_short_func_norm()
 #ifndef UNI_ALGO_DISABLE_PROP
     TESTX(una::norm::to_unaccent_utf8(str) == str);
 #endif // UNI_ALGO_DISABLE_PROP
+    TESTX(una::norm::to_nfc_utf8_cow(str).view() == str);
+    una::norm::to_nfc_utf8_inplace(str);
+    TESTX(una::norm::is_nfc_utf8(str));
 
     TESTX(una::norm::is_nfc_utf8(str));
     TESTX(una::norm::is_nfd_utf8(str));
@@ -308,6 +389,9 @@ test_constexpr bool test_short_func_norm()
 #ifndef UNI_ALGO_DISABLE_PROP
     TESTX(una::norm::to_unaccent_utf16(u16str) == u16str);
 #endif // UNI_ALGO_DISABLE_PROP
+    TESTX(una::norm::to_nfc_utf16_cow(u16str).view() == u16str);
+    una::norm::to_nfc_utf16_inplace(u16str);
+    TESTX(una::norm::is_nfc_utf16(u16str));
 
     TESTX(una::norm::is_nfc_utf16(u16str));
     TESTX(una::norm::is_nfd_utf16(u16str));
@@ -337,6 +421,9 @@ test_constexpr bool test_short_func_norm()
 #ifndef UNI_ALGO_DISABLE_PROP
     TESTX(una::norm::to_unaccent_utf16(wstr) == wstr);
 #endif // UNI_ALGO_DISABLE_PROP
+    TESTX(una::norm::to_nfc_utf16_cow(wstr).view() == wstr);
+    una::norm::to_nfc_utf16_inplace(wstr);
+    TESTX(una::norm::is_nfc_utf16(wstr));
 
     TESTX(una::norm::is_nfc_utf16(wstr));
     TESTX(una::norm::is_nfd_utf16(wstr));
@@ -368,6 +455,9 @@ test_constexpr bool test_short_func_norm()
 #ifndef UNI_ALGO_DISABLE_PROP
     TESTX(una::norm::to_unaccent_utf8(u8str) == u8str);
 #endif // UNI_ALGO_DISABLE_PROP
+    TESTX(una::norm::to_nfc_utf8_cow(u8str).view() == u8str);
+    una::norm::to_nfc_utf8_inplace(u8str);
+    TESTX(una::norm::is_nfc_utf8(u8str));
 
     TESTX(una::norm::is_nfc_utf8(u8str));
     TESTX(una::norm::is_nfd_utf8(u8str));
@@ -0,0 +1,106 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test una::stream_converter the result must always be the same as the result
+// of the conversion of the whole string no matter how the string is split into chunks.
+
+template<typename From, typename To, typename FnWhole>
+test_constexpr bool test_stream_conv_check(std::basic_string_view<From> str, FnWhole fn_whole)
+{
+    const std::basic_string<To> whole = fn_whole(str);
+
+    // Chunks of the same size
+    for (std::size_t size = 1; size <= 5; ++size)
+    {
+        una::stream_converter<From, To> converter;
+        std::basic_string<To> result;
+        for (std::size_t i = 0; i < str.size(); i += size)
+            converter.convert(str.substr(i, size), result);
+        converter.finish(result);
+        TESTX(!converter.pending());
+        TESTX(result == whole);
+    }
+
+    // Two chunks split at every position
+    for (std::size_t i = 0; i <= str.size(); ++i)
+    {
+        una::stream_converter<From, To> converter;
+        std::basic_string<To> result;
+        converter.convert(str.substr(0, i), result);
+        converter.convert(str.substr(i), result);
+        converter.finish(result);
+        TESTX(result == whole);
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_conv_utf8()
+{
+    for (std::string_view str : test_ill_formed_utf8)
+    {
+        TESTX((test_stream_conv_check<char, char16_t>(str, [](std::string_view s) { return una::utf8to16u(s); })));
+        TESTX((test_stream_conv_check<char, char32_t>(str, [](std::string_view s) { return una::utf8to32u(s); })));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_conv_utf16()
+{
+    for (std::u16string_view str : test_ill_formed_utf16)
+    {
+        TESTX((test_stream_conv_check<char16_t, char>(str, [](std::u16string_view s) { return una::utf16to8(s); })));
+        TESTX((test_stream_conv_check<char16_t, char32_t>(str, [](std::u16string_view s) { return una::utf16to32u(s); })));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_conv_utf32()
+{
+    const std::u32string_view strings[] = {
+        U"",
+        U"A\x0410\xFF21\x0001D400\x0010FFFF",
+        U"A\xD800\xDC00\x00110000\xFFFFFFFF"                            // Surrogates and out of range
+    };
+
+    for (std::u32string_view str : strings)
+    {
+        TESTX((test_stream_conv_check<char32_t, char>(str, [](std::u32string_view s) { return una::utf32to8(s); })));
+        TESTX((test_stream_conv_check<char32_t, char16_t>(str, [](std::u32string_view s) { return una::utf32to16u(s); })));
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_conv_pending()
+{
+    una::stream_converter<char, char16_t> converter;
+    std::u16string result;
+
+    converter.convert("A\xF0\x9F", result);
+    TESTX(converter.pending() && result == u"A");
+    converter.convert("\x98", result);
+    TESTX(converter.pending() && result == u"A");
+    converter.convert("", result); // Empty chunk is not the end of the input
+    TESTX(converter.pending() && result == u"A");
+    converter.convert("\x80", result);
+    TESTX(!converter.pending() && result == u"A\xD83D\xDE00");
+
+    converter.convert("\xE4\xBD", result);
+    TESTX(converter.pending());
+    converter.finish(result);
+    TESTX(!converter.pending() && result == u"A\xD83D\xDE00\xFFFD");
+
+    converter.convert("\xE4\xBD", result);
+    TESTX(converter.pending());
+    converter.reset();
+    TESTX(!converter.pending());
+    converter.convert("B", result);
+    converter.finish(result);
+    TESTX(result == u"A\xD83D\xDE00\xFFFD" u"B");
+
+    return true;
+}
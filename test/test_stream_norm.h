@@ -0,0 +1,142 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test una::norm::stream_normalizer the result must always be the same as the result
+// of the normalization of the whole string no matter how the string is split into chunks.
+
+template<typename Form, typename UTF, typename FnWhole>
+test_constexpr bool test_stream_norm_check(std::basic_string_view<UTF> str, FnWhole fn_whole)
+{
+    const std::basic_string<UTF> whole = fn_whole(str);
+
+    // Chunks of the same size
+    for (std::size_t size = 1; size <= 5; ++size)
+    {
+        una::norm::stream_normalizer<Form, UTF> normalizer;
+        std::basic_string<UTF> result;
+        for (std::size_t i = 0; i < str.size(); i += size)
+            normalizer.normalize(str.substr(i, size), result);
+        normalizer.finish(result);
+        TESTX(!normalizer.pending());
+        TESTX(result == whole);
+    }
+
+    // Two chunks split at every position
+    for (std::size_t i = 0; i <= str.size(); ++i)
+    {
+        una::norm::stream_normalizer<Form, UTF> normalizer;
+        std::basic_string<UTF> result;
+        normalizer.normalize(str.substr(0, i), result);
+        normalizer.normalize(str.substr(i), result);
+        normalizer.finish(result);
+        TESTX(result == whole);
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_norm_utf8()
+{
+    const std::string_view strings[] = {
+        "",
+        "ABC",
+        "A\xCC\x8A\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xC3\x85\xCC\xA3\xCC\x81" "Z\xEF\xBE\x9E" "\xC2\xA8",
+        "\xE1\xBE\x82\xCC\x81\xCC\x95\xCC\xA3" "a\xCC\xA3\xCC\x82" "e\xCC\x81\xCC\x81 \xEA\xB0\x80\xE1\x86\xA8",
+        "A\xF0\x9F\x98\xCC\x81\x80" "B\xE1\x84" "C\xED\xA0\x80\xCC\x81",                         // Ill-formed
+    };
+
+    for (std::string_view str : strings)
+    {
+        TESTX((test_stream_norm_check<una::norm::nfc, char>(str, [](std::string_view s) { return una::norm::to_nfc_utf8(s); })));
+        TESTX((test_stream_norm_check<una::norm::nfd, char>(str, [](std::string_view s) { return una::norm::to_nfd_utf8(s); })));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        TESTX((test_stream_norm_check<una::norm::nfkc, char>(str, [](std::string_view s) { return una::norm::to_nfkc_utf8(s); })));
+        TESTX((test_stream_norm_check<una::norm::nfkd, char>(str, [](std::string_view s) { return una::norm::to_nfkd_utf8(s); })));
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_norm_utf16()
+{
+    const std::u16string_view strings[] = {
+        u"",
+        u"ABC",
+        u"A\x030A\x1100\x1161\x11A8\x00C5\x0323\x0301Z\xFF9E\x00A8\xD834\xDD5E\xD834\xDD65",
+        u"A\xD800\x0301\xDC00" u"B\xD834",                                                     // Ill-formed
+    };
+
+    for (std::u16string_view str : strings)
+    {
+        TESTX((test_stream_norm_check<una::norm::nfc, char16_t>(str, [](std::u16string_view s) { return una::norm::to_nfc_utf16(s); })));
+        TESTX((test_stream_norm_check<una::norm::nfd, char16_t>(str, [](std::u16string_view s) { return una::norm::to_nfd_utf16(s); })));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        TESTX((test_stream_norm_check<una::norm::nfkc, char16_t>(str, [](std::u16string_view s) { return una::norm::to_nfkc_utf16(s); })));
+        TESTX((test_stream_norm_check<una::norm::nfkd, char16_t>(str, [](std::u16string_view s) { return una::norm::to_nfkd_utf16(s); })));
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+    }
+
+    return true;
+}
+
+test_constexpr bool test_stream_norm_stream_safe()
+{
+    // CGJ must be inserted within long sequences of non-starters (see test_norm_stream_safe)
+    std::string str = "A";
+    for (std::size_t i = 0; i < 50; ++i)
+        str += "\xCC\x80";
+
+    TESTX((test_stream_norm_check<una::norm::nfc, char>(str, [](std::string_view s) { return una::norm::to_nfc_utf8(s); })));
+    TESTX((test_stream_norm_check<una::norm::nfd, char>(str, [](std::string_view s) { return una::norm::to_nfd_utf8(s); })));
+
+    return true;
+}
+
+test_constexpr bool test_stream_norm_long()
+{
+    // The chunks are decoded and the result is encoded by blocks (see stream_normalizer::block_size)
+    // so the string must be longer than the blocks
+    std::string str;
+    std::u16string str16;
+    for (std::size_t i = 0; i < 30; ++i)
+    {
+        str += "A\xCC\x8A\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xC3\x85\xCC\xA3\xCC\x81" "Z\xEF\xBE\x9E\xF0\x9D\x85\x9E";
+        str16 += u"A\x030A\x1100\x1161\x11A8\x00C5\x0323\x0301Z\xFF9E\xD834\xDD5E";
+    }
+
+    TESTX((test_stream_norm_check<una::norm::nfc, char>(str, [](std::string_view s) { return una::norm::to_nfc_utf8(s); })));
+    TESTX((test_stream_norm_check<una::norm::nfd, char>(str, [](std::string_view s) { return una::norm::to_nfd_utf8(s); })));
+    TESTX((test_stream_norm_check<una::norm::nfc, char16_t>(str16, [](std::u16string_view s) { return una::norm::to_nfc_utf16(s); })));
+    TESTX((test_stream_norm_check<una::norm::nfd, char16_t>(str16, [](std::u16string_view s) { return una::norm::to_nfd_utf16(s); })));
+
+    return true;
+}
+
+test_constexpr bool test_stream_norm_pending()
+{
+    una::norm::stream_normalizer<una::norm::nfc, char> normalizer;
+    std::string result;
+
+    // The last code point is never written because it can be composed with the next one
+    normalizer.normalize("ABe", result);
+    TESTX(normalizer.pending() && result == "AB");
+    normalizer.normalize("\xCC", result);
+    TESTX(normalizer.pending() && result == "AB");
+    normalizer.normalize("\x81", result);
+    TESTX(normalizer.pending() && result == "AB");
+    normalizer.normalize("C", result);
+    TESTX(normalizer.pending() && result == "AB\xC3\xA9");
+    normalizer.finish(result);
+    TESTX(!normalizer.pending() && result == "AB\xC3\xA9" "C");
+
+    normalizer.normalize("e\xCC", result);
+    normalizer.reset();
+    TESTX(!normalizer.pending());
+    normalizer.normalize("D", result);
+    normalizer.finish(result);
+    TESTX(result == "AB\xC3\xA9" "CD");
+
+    return true;
+}